@@ -522,6 +522,62 @@ extern DECLSPEC SDL_AudioStream * SDLCALL SDL_NewAudioStream(const SDL_AudioForm
                                            const Uint8 dst_channels,
                                            const int dst_rate);
 
+/**
+ *  \brief The resampling algorithm used by an SDL_AudioStream
+ */
+typedef enum
+{
+    SDL_AUDIO_RESAMPLE_SINC,    /**< Kaiser-windowed sinc, or libsamplerate if SDL_HINT_AUDIO_RESAMPLING_MODE selects it (the default) */
+    SDL_AUDIO_RESAMPLE_LINEAR,  /**< Linear interpolation between two frames, the fastest and lowest quality */
+    SDL_AUDIO_RESAMPLE_CUBIC    /**< Cubic (Catmull-Rom) interpolation over four frames */
+} SDL_AudioResampleQuality;
+
+/**
+ *  Set the resampling algorithm used by an audio stream
+ *
+ *  New streams use SDL_AUDIO_RESAMPLE_SINC, unless SDL_HINT_AUDIO_RESAMPLING_MODE
+ *  is "linear" or "cubic". This is best done before any data is put into the
+ *  stream; switching away from libsamplerate drops the data it buffered.
+ *
+ *  \param stream The stream to change
+ *  \param quality The resampling algorithm to use
+ *  \return 0 on success, or -1 on error.
+ *
+ *  \sa SDL_AudioStreamGetResampleQuality
+ *  \sa SDL_NewAudioStream
+ */
+extern DECLSPEC int SDLCALL SDL_AudioStreamSetResampleQuality(SDL_AudioStream *stream, SDL_AudioResampleQuality quality);
+
+/**
+ *  Get the resampling algorithm used by an audio stream
+ *
+ *  \sa SDL_AudioStreamSetResampleQuality
+ */
+extern DECLSPEC SDL_AudioResampleQuality SDLCALL SDL_AudioStreamGetResampleQuality(SDL_AudioStream *stream);
+
+/**
+ *  Set the gain applied to an audio stream when a device mixes it
+ *
+ *  This only matters while the stream is bound with SDL_BindAudioStream(),
+ *  and may be called at any time from any thread; it takes effect the next
+ *  time the device mixes. New streams have a gain of 1.0.
+ *
+ *  \param stream The stream to change
+ *  \param gain The factor to scale the stream's samples by, 0.0 or more
+ *  \return 0 on success, or -1 on error.
+ *
+ *  \sa SDL_AudioStreamGetGain
+ *  \sa SDL_BindAudioStream
+ */
+extern DECLSPEC int SDLCALL SDL_AudioStreamSetGain(SDL_AudioStream *stream, float gain);
+
+/**
+ *  Get the gain applied to an audio stream when a device mixes it
+ *
+ *  \sa SDL_AudioStreamSetGain
+ */
+extern DECLSPEC float SDLCALL SDL_AudioStreamGetGain(SDL_AudioStream *stream);
+
 /**
  *  Add data to be converted/resampled to the stream
  *
@@ -662,7 +718,9 @@ extern DECLSPEC void SDLCALL SDL_MixAudioFormat(Uint8 * dst,
  *  or queue audio with this function, but not both.
  *
  *  You should not call SDL_LockAudio() on the device before queueing; SDL
- *  handles locking internally for this function.
+ *  handles locking internally for this function. It never waits on the
+ *  audio thread, and once the queue has grown to hold your usual backlog
+ *  it stops allocating memory.
  *
  *  \param dev The device ID to which we will queue audio.
  *  \param data The data to queue to the device for later playback.
@@ -708,7 +766,8 @@ extern DECLSPEC int SDLCALL SDL_QueueAudio(SDL_AudioDeviceID dev, const void *da
  *  the audio callback, or dequeue audio with this function, but not both.
  *
  *  You should not call SDL_LockAudio() on the device before queueing; SDL
- *  handles locking internally for this function.
+ *  handles locking internally for this function. It never waits on the
+ *  audio thread.
  *
  *  \param dev The device ID from which we will dequeue audio.
  *  \param data A pointer into where audio data should be copied.
@@ -781,7 +840,8 @@ extern DECLSPEC Uint32 SDLCALL SDL_GetQueuedAudioSize(SDL_AudioDeviceID dev);
  *  the audio callback, but not both.
  *
  *  You should not call SDL_LockAudio() on the device before clearing the
- *  queue; SDL handles locking internally for this function.
+ *  queue; SDL handles locking internally for this function. The memory the
+ *  queue used is kept for later queueing rather than freed.
  *
  *  This function always succeeds and thus returns void.
  *
@@ -792,6 +852,50 @@ extern DECLSPEC Uint32 SDLCALL SDL_GetQueuedAudioSize(SDL_AudioDeviceID dev);
  */
 extern DECLSPEC void SDLCALL SDL_ClearQueuedAudio(SDL_AudioDeviceID dev);
 
+/**
+ *  Have an open playback device mix an audio stream into its output.
+ *
+ *  The device must have been opened without a callback, like for
+ *  SDL_QueueAudio(); queued audio and any number of bound streams play
+ *  together. The stream must output AUDIO_F32SYS with the channels and
+ *  frequency the device was opened with. SDL converts the stream's input
+ *  on the audio thread as the device needs it, scales it by the stream's
+ *  gain (see SDL_AudioStreamSetGain()) and sums it with the other streams
+ *  in float, clipping the result to -1.0 .. 1.0.
+ *
+ *  While a stream is bound, keep feeding it with SDL_AudioStreamPut() and
+ *  SDL_AudioStreamFlush(). These don't lock the device or wait on the audio
+ *  thread, but as with any audio stream, only one thread may call them at a
+ *  time. SDL_AudioStreamGet(), SDL_AudioStreamAvailable(),
+ *  SDL_AudioStreamClear() and SDL_AudioStreamSetResampleQuality() don't work
+ *  until the stream is unbound again.
+ *
+ *  A stream can only be bound to one device at a time. Closing the device
+ *  unbinds all of its streams, and freeing a stream unbinds it first.
+ *
+ *  \param dev The device ID to mix the stream into.
+ *  \param stream The audio stream to mix.
+ *  \return 0 on success, or -1 on error.
+ *
+ *  \sa SDL_UnbindAudioStream
+ *  \sa SDL_AudioStreamSetGain
+ *  \sa SDL_QueueAudio
+ */
+extern DECLSPEC int SDLCALL SDL_BindAudioStream(SDL_AudioDeviceID dev, SDL_AudioStream *stream);
+
+/**
+ *  Stop mixing an audio stream into the device it is bound to.
+ *
+ *  Input the device hasn't used yet is converted and stays in the stream, so
+ *  it can be read with SDL_AudioStreamGet() or cleared. Unbinding a stream
+ *  that isn't bound does nothing.
+ *
+ *  \param stream The audio stream to unbind.
+ *
+ *  \sa SDL_BindAudioStream
+ */
+extern DECLSPEC void SDLCALL SDL_UnbindAudioStream(SDL_AudioStream *stream);
+
 
 /**
  *  \name Audio lock functions
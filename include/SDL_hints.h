@@ -152,6 +152,54 @@ extern "C" {
  */
 #define SDL_HINT_RENDER_VSYNC               "SDL_RENDER_VSYNC"
 
+/**
+ *  \brief  A variable controlling whether the 2D render API records drawing commands and submits them in batches.
+ *
+ *  This variable can be set to the following values:
+ *    "0"       - Drawing calls are passed to the render backend immediately
+ *    "1"       - Drawing calls are queued and submitted at SDL_RenderPresent(),
+ *                SDL_RenderReadPixels(), SDL_SetRenderTarget() or SDL_RenderFlush()
+ *
+ *  By default SDL does not batch drawing commands. The hint is checked when
+ *  the renderer is created.
+ */
+#define SDL_HINT_RENDER_BATCHING            "SDL_RENDER_BATCHING"
+
+/**
+ *  \brief  A variable controlling how many threads the software renderer draws with.
+ *
+ *  This variable can be set to the following values:
+ *    "1"       - Draw on the calling thread only
+ *    "N"       - Split the render target into bands of rows drawn by N threads
+ *    "auto"    - Use one thread per CPU core
+ *
+ *  Threads draw the queued commands, so more than one thread turns on
+ *  SDL_HINT_RENDER_BATCHING for that renderer. Lines and scaled or rotated
+ *  copies are still drawn on a single thread. The output is the same as
+ *  drawing on a single thread.
+ *
+ *  By default the software renderer draws on the calling thread. The hint is
+ *  checked when the renderer is created.
+ */
+#define SDL_HINT_RENDER_SW_THREADS          "SDL_RENDER_SW_THREADS"
+
+/**
+ *  \brief  A variable controlling how many threads large software blits use.
+ *
+ *  This variable can be set to the following values:
+ *    "1"       - Blit on the calling thread only
+ *    "N"       - Split large blits into bands of rows blitted by N threads
+ *    "auto"    - Use one thread per CPU core
+ *
+ *  This applies to SDL_BlitSurface() and to nearest and linear filtered
+ *  SDL_BlitScaled() between surfaces of the same format. Small blits and
+ *  blits from a surface to itself are always done on the calling thread.
+ *  The output is the same as blitting on a single thread.
+ *
+ *  By default blits are done on the calling thread.
+ */
+#define SDL_HINT_BLIT_THREADS               "SDL_BLIT_THREADS"
+
 /**
  *  \brief  A variable controlling whether the screensaver is enabled. 
  *
@@ -843,7 +891,10 @@ extern "C" {
  *  for capture. SDL_AudioCVT always uses the default resampler (although this
  *  might change for SDL 2.1).
  *
- *  This hint is currently only checked at audio subsystem initialization.
+ *  This hint is currently only checked at audio subsystem initialization,
+ *  except for "linear" and "cubic", which are checked whenever an
+ *  SDL_AudioStream is created and can be changed per stream with
+ *  SDL_AudioStreamSetResampleQuality().
  *
  *  This variable can be set to the following values:
  *
@@ -851,6 +902,8 @@ extern "C" {
  *    "1" or "fast"    - Use fast, slightly higher quality resampling, if available
  *    "2" or "medium"  - Use medium quality resampling, if available
  *    "3" or "best"    - Use high quality resampling, if available
+ *    "linear"         - Use SDL's internal linear interpolation, the cheapest
+ *    "cubic"          - Use SDL's internal cubic interpolation
  */
 #define SDL_HINT_AUDIO_RESAMPLING_MODE   "SDL_AUDIO_RESAMPLING_MODE"
 
@@ -51,6 +51,15 @@ typedef struct SDL_Point
     int y;
 } SDL_Point;
 
+/**
+ *  \brief  The structure that defines a point, with floating point coordinates
+ */
+typedef struct SDL_FPoint
+{
+    float x;
+    float y;
+} SDL_FPoint;
+
 /**
  *  \brief A rectangle, with the origin at the upper left.
  *
@@ -67,6 +76,17 @@ typedef struct SDL_Rect
     int w, h;
 } SDL_Rect;
 
+/**
+ *  \brief A rectangle with floating point coordinates, with the origin at the upper left.
+ */
+typedef struct SDL_FRect
+{
+    float x;
+    float y;
+    float w;
+    float h;
+} SDL_FRect;
+
 /**
  *  \brief Returns true if point resides inside a rectangle.
  */
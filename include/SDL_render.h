@@ -115,6 +115,29 @@ typedef enum
     SDL_FLIP_VERTICAL = 0x00000002     /**< flip vertically */
 } SDL_RendererFlip;
 
+/**
+ *  \brief Vertex structure for SDL_RenderGeometry()
+ */
+typedef struct SDL_Vertex
+{
+    SDL_FPoint position;        /**< Vertex position, in SDL_Renderer coordinates  */
+    SDL_Color  color;           /**< Vertex color */
+    SDL_FPoint tex_coord;       /**< Normalized texture coordinates, if needed */
+} SDL_Vertex;
+
+/**
+ *  \brief Rendering statistics of a frame, see SDL_RenderGetStats()
+ */
+typedef struct SDL_RenderStats
+{
+    Uint32 draw_calls;          /**< Drawing commands, clears included */
+    Uint32 texture_uploads;     /**< Texture updates and unlocks of streaming textures */
+    Uint64 upload_bytes;        /**< Bytes of pixel data uploaded to textures */
+    Uint64 pixels_filled;       /**< Target pixels drawn without blending */
+    Uint64 pixels_blended;      /**< Target pixels drawn with blending */
+    Uint32 backend_us;          /**< Microseconds spent in the render backend */
+} SDL_RenderStats;
+
 /**
  *  \brief A structure representing rendering state
  */
@@ -835,6 +858,52 @@ extern DECLSPEC int SDLCALL SDL_RenderCopyEx(SDL_Renderer * renderer,
                                            const SDL_Point *center,
                                            const SDL_RendererFlip flip);
 
+/**
+ *  \brief Render a list of triangles, optionally using a texture and indices into the vertex array.
+ *
+ *  \param renderer The rendering context.
+ *  \param texture  The SDL texture to use, or NULL for untextured triangles.
+ *  \param vertices The vertices.
+ *  \param num_vertices The number of vertices.
+ *  \param indices  An array of vertex indices, three per triangle, or NULL to
+ *                  take the vertices three at a time in order.
+ *  \param num_indices The number of indices.
+ *
+ *  The vertex color is multiplied with the texture color and modulation. The
+ *  texture blend mode is used for textured triangles, the draw blend mode
+ *  otherwise.
+ *
+ *  \return 0 on success, or -1 if the operation is not supported
+ */
+extern DECLSPEC int SDLCALL SDL_RenderGeometry(SDL_Renderer * renderer,
+                                               SDL_Texture * texture,
+                                               const SDL_Vertex * vertices, int num_vertices,
+                                               const int * indices, int num_indices);
+
+/**
+ *  \brief Copy many portions of one texture to the current rendering target.
+ *
+ *  \param renderer The renderer which should copy parts of a texture.
+ *  \param texture  The source texture.
+ *  \param srcrects An array of source rectangles, or NULL to copy the entire
+ *                  texture each time.
+ *  \param dstrects An array of destination rectangles.
+ *  \param colors   An array of colors multiplied with the texture color and
+ *                  alpha modulation for each copy, or NULL.
+ *  \param count    The number of copies.
+ *
+ *  This draws the same as calling SDL_RenderCopy() once per rectangle, but
+ *  lets the renderer draw all of the copies at once.
+ *
+ *  \return 0 on success, or -1 on error
+ */
+extern DECLSPEC int SDLCALL SDL_RenderCopyBatch(SDL_Renderer * renderer,
+                                                SDL_Texture * texture,
+                                                const SDL_Rect * srcrects,
+                                                const SDL_Rect * dstrects,
+                                                const SDL_Color * colors,
+                                                int count);
+
 /**
  *  \brief Read pixels from the current rendering target.
  *
@@ -860,6 +929,38 @@ extern DECLSPEC int SDLCALL SDL_RenderReadPixels(SDL_Renderer * renderer,
  */
 extern DECLSPEC void SDLCALL SDL_RenderPresent(SDL_Renderer * renderer);
 
+/**
+ *  \brief Force the rendering context to submit any queued drawing commands.
+ *
+ *  When SDL_HINT_RENDER_BATCHING is enabled, drawing calls are recorded and
+ *  only passed to the render backend at SDL_RenderPresent() and other points
+ *  where the queued output is needed. Call this before mixing SDL rendering
+ *  with direct access to the backend, e.g. OpenGL calls.
+ *
+ *  \param renderer The renderer whose queued commands should be executed.
+ *
+ *  \return 0 on success, or -1 if one of the queued commands failed.
+ */
+extern DECLSPEC int SDLCALL SDL_RenderFlush(SDL_Renderer * renderer);
+
+/**
+ *  \brief Get the rendering statistics of the last frame.
+ *
+ *  \param renderer The renderer to query.
+ *  \param stats    A pointer filled in with the statistics gathered between
+ *                  the last two calls to SDL_RenderPresent().
+ *
+ *  The pixel counts are the areas of the drawn shapes in target pixels,
+ *  before clipping, with one pixel per point and line pixel. The backend
+ *  time is measured around the calls into the render backend, including
+ *  presenting the frame. For hardware renderers this is the time to submit
+ *  the work, which the GPU may finish later.
+ *
+ *  \return 0 on success, or -1 on error
+ */
+extern DECLSPEC int SDLCALL SDL_RenderGetStats(SDL_Renderer * renderer,
+                                               SDL_RenderStats * stats);
+
 /**
  *  \brief Destroy the specified texture.
  *
@@ -491,6 +491,20 @@ extern DECLSPEC int SDLCALL SDL_SoftStretch(SDL_Surface * src,
                                             SDL_Surface * dst,
                                             const SDL_Rect * dstrect);
 
+/**
+ *  \brief Perform a bilinear filtered stretch blit between two surfaces of the
+ *         same 32-bit pixel format.
+ *
+ *  The blend mode and modulation of the source surface are ignored, the
+ *  filtered pixels are copied to the destination.
+ *
+ *  \return 0 on success, or -1 on error
+ */
+extern DECLSPEC int SDLCALL SDL_SoftStretchLinear(SDL_Surface * src,
+                                                  const SDL_Rect * srcrect,
+                                                  SDL_Surface * dst,
+                                                  const SDL_Rect * dstrect);
+
 #define SDL_BlitScaled SDL_UpperBlitScaled
 
 /**
@@ -509,6 +523,35 @@ extern DECLSPEC int SDLCALL SDL_LowerBlitScaled
     (SDL_Surface * src, SDL_Rect * srcrect,
     SDL_Surface * dst, SDL_Rect * dstrect);
 
+/**
+ *  \brief The formula used for converting between YUV and RGB
+ */
+typedef enum
+{
+    SDL_YUV_CONVERSION_JPEG,        /**< Full range JPEG, the default */
+    SDL_YUV_CONVERSION_BT601,       /**< BT.601 limited range */
+    SDL_YUV_CONVERSION_BT709,       /**< BT.709 limited range */
+    SDL_YUV_CONVERSION_AUTOMATIC    /**< BT.601 for SD content, BT.709 for HD content */
+} SDL_YUV_CONVERSION_MODE;
+
+/**
+ *  \brief Set the YUV conversion mode used by SDL_ConvertPixels() and the
+ *         software renderer
+ */
+extern DECLSPEC void SDLCALL SDL_SetYUVConversionMode(SDL_YUV_CONVERSION_MODE mode);
+
+/**
+ *  \brief Get the YUV conversion mode
+ */
+extern DECLSPEC SDL_YUV_CONVERSION_MODE SDLCALL SDL_GetYUVConversionMode(void);
+
+/**
+ *  \brief Get the YUV conversion mode, returning the correct mode for the
+ *         resolution when the current conversion mode is
+ *         SDL_YUV_CONVERSION_AUTOMATIC
+ */
+extern DECLSPEC SDL_YUV_CONVERSION_MODE SDLCALL SDL_GetYUVConversionModeForResolution(int width, int height);
+
 
 /* Ends C function definitions when using C++ */
 #ifdef __cplusplus
@@ -42,6 +42,7 @@
 extern int SDL_HelperWindowCreate(void);
 extern int SDL_HelperWindowDestroy(void);
 #endif
+extern void SDL_QuitBlitThreads(void);
 
 
 /* The initialized subsystems */
@@ -357,6 +358,7 @@ SDL_Quit(void)
     SDL_TicksQuit();
 #endif
 
+    SDL_QuitBlitThreads();
     SDL_ClearHints();
     SDL_AssertionsQuit();
     SDL_LogResetPriorities();
@@ -516,6 +516,52 @@ SDL_RemoveAudioDevice(const int iscapture, void *handle)
 
 /* buffer queueing support... */
 
+/* Sums the bound streams in float and adds that to whatever was dequeued. */
+static void
+mix_bound_streams(SDL_AudioDevice *device, Uint8 *stream, int len, const SDL_bool dequeued)
+{
+    const SDL_AudioFormat format = device->callbackspec.format;
+    const int samplesize = SDL_AUDIO_BITSIZE(format) / 8;
+    float *mix = device->mix_buffer;
+    float *scratch = device->mix_buffer + device->mix_samples;
+
+    while (len >= samplesize) {
+        const int samples = SDL_min(len / samplesize, device->mix_samples);
+        const int chunk = samples * samplesize;
+        SDL_bool mixed = SDL_FALSE;
+        int i;
+
+        SDL_memset(mix, '\0', samples * sizeof (float));
+        for (i = 0; i < device->num_bound_streams; i++) {
+            if (SDL_AudioStreamMixBound(device->bound_streams[i], mix, scratch, samples * sizeof (float)) > 0) {
+                mixed = SDL_TRUE;
+            }
+        }
+
+        if (mixed) {
+            /* the integer converters don't clip, so keep the sum in range. */
+            for (i = 0; i < samples; i++) {
+                mix[i] = SDL_max(SDL_min(mix[i], 1.0f), -1.0f);
+            }
+
+            if (device->mix_cvt.needed) {
+                device->mix_cvt.buf = (Uint8 *) mix;
+                device->mix_cvt.len = samples * sizeof (float);
+                SDL_ConvertAudio(&device->mix_cvt);
+            }
+
+            if (dequeued) {
+                SDL_MixAudioFormat(stream, (const Uint8 *) mix, format, chunk, SDL_MIX_MAXVOLUME);
+            } else {
+                SDL_memcpy(stream, mix, chunk);
+            }
+        }
+
+        stream += chunk;
+        len -= chunk;
+    }
+}
+
 static void SDLCALL
 SDL_BufferQueueDrainCallback(void *userdata, Uint8 *stream, int len)
 {
@@ -527,13 +573,14 @@ SDL_BufferQueueDrainCallback(void *userdata, Uint8 *stream, int len)
     SDL_assert(!device->iscapture);  /* this shouldn't ever happen, right?! */
     SDL_assert(len >= 0);  /* this shouldn't ever happen, right?! */
 
-    dequeued = SDL_ReadFromDataQueue(device->buffer_queue, stream, len);
-    stream += dequeued;
-    len -= (int) dequeued;
+    dequeued = SDL_ReadFromAudioRing(device->buffer_queue, stream, len);
 
-    if (len > 0) {  /* fill any remaining space in the stream with silence. */
-        SDL_assert(SDL_CountDataQueue(device->buffer_queue) == 0);
-        SDL_memset(stream, device->spec.silence, len);
+    if (dequeued < (size_t) len) {  /* fill any remaining space in the stream with silence. */
+        SDL_memset(stream + dequeued, device->spec.silence, len - dequeued);
+    }
+
+    if (device->num_bound_streams > 0) {
+        mix_bound_streams(device, stream, len, dequeued > 0);
     }
 }
 
@@ -547,10 +594,11 @@ SDL_BufferQueueFillCallback(void *userdata, Uint8 *stream, int len)
     SDL_assert(device->iscapture);  /* this shouldn't ever happen, right?! */
     SDL_assert(len >= 0);  /* this shouldn't ever happen, right?! */
 
-    /* note that if this needs to allocate more space and run out of memory,
-       we have no choice but to quietly drop the data and hope it works out
-       later, but you probably have bigger problems in this case anyhow. */
-    SDL_WriteToDataQueue(device->buffer_queue, stream, len);
+    /* this only allocates if the app falls behind further than it ever has.
+       If that runs out of memory, we have no choice but to quietly drop the
+       data and hope it works out later, but you probably have bigger
+       problems in this case anyhow. */
+    SDL_WriteToAudioRing(device->buffer_queue, stream, len);
 }
 
 int
@@ -568,9 +616,9 @@ SDL_QueueAudio(SDL_AudioDeviceID devid, const void *data, Uint32 len)
     }
 
     if (len > 0) {
-        current_audio.impl.LockDevice(device);
-        rc = SDL_WriteToDataQueue(device->buffer_queue, data, len);
-        current_audio.impl.UnlockDevice(device);
+        SDL_LockMutex(device->queue_lock);
+        rc = SDL_WriteToAudioRing(device->buffer_queue, data, len);
+        SDL_UnlockMutex(device->queue_lock);
     }
 
     return rc;
@@ -589,9 +637,9 @@ SDL_DequeueAudio(SDL_AudioDeviceID devid, void *data, Uint32 len)
         return 0;  /* just report zero bytes dequeued. */
     }
 
-    current_audio.impl.LockDevice(device);
-    rc = (Uint32) SDL_ReadFromDataQueue(device->buffer_queue, data, len);
-    current_audio.impl.UnlockDevice(device);
+    SDL_LockMutex(device->queue_lock);
+    rc = (Uint32) SDL_ReadFromAudioRing(device->buffer_queue, data, len);
+    SDL_UnlockMutex(device->queue_lock);
     return rc;
 }
 
@@ -607,13 +655,15 @@ SDL_GetQueuedAudioSize(SDL_AudioDeviceID devid)
 
     /* Nothing to do unless we're set up for queueing. */
     if (device->callbackspec.callback == SDL_BufferQueueDrainCallback) {
-        current_audio.impl.LockDevice(device);
-        retval = ((Uint32) SDL_CountDataQueue(device->buffer_queue)) + current_audio.impl.GetPendingBytes(device);
-        current_audio.impl.UnlockDevice(device);
+        retval = (Uint32) SDL_CountAudioRing(device->buffer_queue);
+        /* Most backends have nothing pending; don't hold up the audio thread for them. */
+        if (current_audio.impl.GetPendingBytes != SDL_AudioGetPendingBytes_Default) {
+            current_audio.impl.LockDevice(device);
+            retval += current_audio.impl.GetPendingBytes(device);
+            current_audio.impl.UnlockDevice(device);
+        }
     } else if (device->callbackspec.callback == SDL_BufferQueueFillCallback) {
-        current_audio.impl.LockDevice(device);
-        retval = (Uint32) SDL_CountDataQueue(device->buffer_queue);
-        current_audio.impl.UnlockDevice(device);
+        retval = (Uint32) SDL_CountAudioRing(device->buffer_queue);
     }
 
     return retval;
@@ -624,15 +674,108 @@ SDL_ClearQueuedAudio(SDL_AudioDeviceID devid)
 {
     SDL_AudioDevice *device = get_audio_device(devid);
 
+    if (!device || !device->buffer_queue) {
+        return;  /* nothing to do. */
+    }
+
+    /* Only the app's end of the ring is ours; the packets stay pooled for reuse. */
+    SDL_LockMutex(device->queue_lock);
+    if (device->iscapture) {
+        SDL_ReadFromAudioRing(device->buffer_queue, NULL, SDL_CountAudioRing(device->buffer_queue));
+    } else {
+        SDL_DiscardAudioRing(device->buffer_queue);
+    }
+    SDL_UnlockMutex(device->queue_lock);
+}
+
+static int
+prepare_bound_mixing(SDL_AudioDevice *device)
+{
+    const SDL_AudioSpec *spec = &device->callbackspec;
+
+    if (SDL_BuildAudioCVT(&device->mix_cvt, AUDIO_F32SYS, spec->channels, spec->freq,
+                          spec->format, spec->channels, spec->freq) < 0) {
+        return -1;  /* SDL_BuildAudioCVT should have called SDL_SetError. */
+    }
+
+    device->mix_samples = spec->size / (SDL_AUDIO_BITSIZE(spec->format) / 8);
+    device->mix_buffer = (float *) SDL_malloc(device->mix_samples * 2 * sizeof (float));
+    if (!device->mix_buffer) {
+        return SDL_OutOfMemory();
+    }
+    return 0;
+}
+
+int
+SDL_BindAudioStream(SDL_AudioDeviceID devid, SDL_AudioStream *stream)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
+    SDL_AudioStream **streams;
+    int rc;
+
     if (!device) {
+        return -1;  /* get_audio_device() will have set the error state */
+    } else if (!stream) {
+        return SDL_InvalidParamError("stream");
+    } else if (device->iscapture) {
+        return SDL_SetError("This is a capture device, binding streams not allowed");
+    } else if (device->callbackspec.callback != SDL_BufferQueueDrainCallback) {
+        return SDL_SetError("Audio device has a callback, binding streams not allowed");
+    }
+
+    current_audio.impl.LockDevice(device);
+
+    if (!device->mix_buffer && (prepare_bound_mixing(device) < 0)) {
+        rc = -1;
+    } else {
+        streams = (SDL_AudioStream **) SDL_realloc(device->bound_streams, (device->num_bound_streams + 1) * sizeof (SDL_AudioStream *));
+        if (!streams) {
+            rc = SDL_OutOfMemory();
+        } else {
+            device->bound_streams = streams;
+            rc = SDL_AudioStreamBeginBinding(stream, devid, &device->callbackspec);
+            if (rc == 0) {
+                streams[device->num_bound_streams++] = stream;
+            }
+        }
+    }
+
+    current_audio.impl.UnlockDevice(device);
+
+    return rc;
+}
+
+void
+SDL_UnbindAudioStream(SDL_AudioStream *stream)
+{
+    SDL_AudioDevice *device;
+    int i;
+
+    if (!stream) {
+        SDL_InvalidParamError("stream");
+        return;
+    } else if (!SDL_AudioStreamGetBinding(stream)) {
         return;  /* nothing to do. */
     }
 
-    /* Blank out the device and release the mutex. Free it afterwards. */
+    /* closing a device unbinds its streams, so this is still open. */
+    device = get_audio_device(SDL_AudioStreamGetBinding(stream));
+    SDL_assert(device != NULL);
+    if (!device) {
+        return;
+    }
+
     current_audio.impl.LockDevice(device);
 
-    /* Keep up to two packets in the pool to reduce future malloc pressure. */
-    SDL_ClearDataQueue(device->buffer_queue, SDL_AUDIOBUFFERQUEUE_PACKETLEN * 2);
+    for (i = 0; i < device->num_bound_streams; i++) {
+        if (device->bound_streams[i] == stream) {
+            device->num_bound_streams--;
+            SDL_memmove(&device->bound_streams[i], &device->bound_streams[i + 1],
+                        (device->num_bound_streams - i) * sizeof (SDL_AudioStream *));
+            break;
+        }
+    }
+    SDL_AudioStreamEndBinding(stream);
 
     current_audio.impl.UnlockDevice(device);
 }
@@ -1046,6 +1189,8 @@ SDL_GetAudioDeviceName(int index, int iscapture)
 static void
 close_audio_device(SDL_AudioDevice * device)
 {
+    int i;
+
     if (!device) {
         return;
     }
@@ -1074,7 +1219,16 @@ close_audio_device(SDL_AudioDevice * device)
         current_audio.impl.CloseDevice(device);
     }
 
-    SDL_FreeDataQueue(device->buffer_queue);
+    for (i = 0; i < device->num_bound_streams; i++) {
+        SDL_AudioStreamEndBinding(device->bound_streams[i]);
+    }
+    SDL_free(device->bound_streams);
+    SDL_free(device->mix_buffer);
+
+    SDL_FreeAudioRing(device->buffer_queue);
+    if (device->queue_lock != NULL) {
+        SDL_DestroyMutex(device->queue_lock);
+    }
 
     SDL_free(device);
 }
@@ -1342,8 +1496,9 @@ open_audio_device(const char *devname, int iscapture,
 
     if (device->spec.callback == NULL) {  /* use buffer queueing? */
         /* pool a few packets to start. Enough for two callbacks. */
-        device->buffer_queue = SDL_NewDataQueue(SDL_AUDIOBUFFERQUEUE_PACKETLEN, obtained->size * 2);
-        if (!device->buffer_queue) {
+        device->buffer_queue = SDL_NewAudioRing(SDL_AUDIOBUFFERQUEUE_PACKETLEN, obtained->size * 2);
+        device->queue_lock = SDL_CreateMutex();
+        if (!device->buffer_queue || !device->queue_lock) {
             close_audio_device(device);
             SDL_SetError("Couldn't create audio buffer queue");
             return 0;
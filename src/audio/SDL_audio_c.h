@@ -74,6 +74,14 @@ extern SDL_AudioFilter SDL_Convert_F32_to_S32;
 extern int SDL_PrepareResampleFilter(void);
 extern void SDL_FreeResampleFilter(void);
 
+/* Hooks for SDL_BindAudioStream(). The device holds its mixer lock while it begins,
+   ends or mixes a binding. SDL_AudioStreamMixBound() adds up to (len) bytes of the stream's output, times its
+   gain, to (mix), using (scratch) as temporary space, and returns the bytes it added. */
+extern int SDL_AudioStreamBeginBinding(SDL_AudioStream *stream, SDL_AudioDeviceID devid, const SDL_AudioSpec *spec);
+extern void SDL_AudioStreamEndBinding(SDL_AudioStream *stream);
+extern SDL_AudioDeviceID SDL_AudioStreamGetBinding(SDL_AudioStream *stream);
+extern int SDL_AudioStreamMixBound(SDL_AudioStream *stream, float *mix, float *scratch, const int len);
+
 #endif /* SDL_audio_c_h_ */
 
 /* vi: set ts=4 sw=4 expandtab: */
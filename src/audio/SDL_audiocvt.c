@@ -32,6 +32,7 @@
 #include "SDL_loadso.h"
 #include "SDL_assert.h"
 #include "../SDL_dataqueue.h"
+#include "SDL_audioring.h"
 #include "SDL_cpuinfo.h"
 
 #define DEBUG_AUDIOSTREAM 0
@@ -40,6 +41,15 @@
 #define HAVE_SSE3_INTRINSICS 1
 #endif
 
+#ifdef __SSE2__
+#define HAVE_SSE2_INTRINSICS 1
+#endif
+
+#if (defined(__ARM_NEON) || defined(__ARM_NEON__)) && SDL_BYTEORDER == SDL_LIL_ENDIAN
+#define HAVE_NEON_INTRINSICS 1
+#include <arm_neon.h>
+#endif
+
 #if HAVE_SSE3_INTRINSICS
 /* Convert from stereo to mono. Average left and right. */
 static void SDLCALL
@@ -460,14 +470,6 @@ SDL_PrepareResampleFilter(void)
     return 0;
 }
 
-void
-SDL_FreeResampleFilter(void)
-{
-    SDL_free(ResamplerFilter);
-    SDL_free(ResamplerFilterDifference);
-    ResamplerFilter = NULL;
-    ResamplerFilterDifference = NULL;
-}
 
 static int
 ResamplerPadding(const int inrate, const int outrate)
@@ -480,15 +482,352 @@ ResamplerPadding(const int inrate, const int outrate)
     return RESAMPLER_SAMPLES_PER_ZERO_CROSSING;
 }
 
+/* Each output frame is made from RESAMPLER_TAPS input frames: the one at or
+   before it, the RESAMPLER_ZERO_CROSSINGS ones before that (the left wing of
+   the filter) and the RESAMPLER_ZERO_CROSSINGS + 1 after it (the right wing).
+   The weights only depend on the phase, the position of the output frame
+   between two input frames. */
+#define RESAMPLER_TAPS ((RESAMPLER_ZERO_CROSSINGS + 1) * 2)
+
+/* Ratios with up to this many phases get a table of weights, which covers
+   the common ones like 44100 to 48000 Hz (160 phases) and 2:1 (one or two). */
+#define RESAMPLER_MAX_PHASES 512
+#define RESAMPLER_CACHED_RATIOS 8
+
+typedef struct
+{
+    int inrate;
+    int outrate;
+    int divisor;        /* the phase of a frame divided by this is its index */
+    float *weights;     /* RESAMPLER_TAPS for each phase */
+} SDL_ResamplerPhases;
+
+static SDL_ResamplerPhases ResamplerPhases[RESAMPLER_CACHED_RATIOS];
+
+/* The filter table has RESAMPLER_SAMPLES_PER_ZERO_CROSSING entries between
+   zero crossings; the weights between entries are linearly interpolated. */
+static void
+ResamplerWeights(const float interpolation1, float *weights)
+{
+    const float interpolation2 = 1.0f - interpolation1;
+    const float position1 = interpolation1 * RESAMPLER_SAMPLES_PER_ZERO_CROSSING;
+    const float position2 = interpolation2 * RESAMPLER_SAMPLES_PER_ZERO_CROSSING;
+    const int filterindex1 = (int) position1;
+    const int filterindex2 = (int) position2;
+    const float fraction1 = position1 - filterindex1;
+    const float fraction2 = position2 - filterindex2;
+    int j;
+
+    for (j = 0; j <= RESAMPLER_ZERO_CROSSINGS; j++) {
+        const int index1 = filterindex1 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING);
+        const int index2 = filterindex2 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING);
+        weights[RESAMPLER_ZERO_CROSSINGS - j] = (index1 < RESAMPLER_FILTER_SIZE) ?
+            ResamplerFilter[index1] + (fraction1 * ResamplerFilterDifference[index1]) : 0.0f;
+        weights[RESAMPLER_ZERO_CROSSINGS + 1 + j] = (index2 < RESAMPLER_FILTER_SIZE) ?
+            ResamplerFilter[index2] + (fraction2 * ResamplerFilterDifference[index2]) : 0.0f;
+    }
+}
+
+static int
+ResamplerGCD(int a, int b)
+{
+    while (b) {
+        const int t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+/* Builds the table of weights for a ratio ahead of time, so the audio thread
+   doesn't have to. It's fine if this fails, the weights are then computed
+   for each frame. */
+static void
+SDL_PrepareResamplerPhases(const int inrate, const int outrate)
+{
+    const int divisor = ResamplerGCD(inrate, outrate);
+    const int phases = outrate / divisor;
+    int i;
+
+    if (phases > RESAMPLER_MAX_PHASES) {
+        return;
+    }
+
+    SDL_AtomicLock(&ResampleFilterSpinlock);
+    for (i = 0; i < RESAMPLER_CACHED_RATIOS; i++) {
+        SDL_ResamplerPhases *entry = &ResamplerPhases[i];
+        if (entry->weights && entry->inrate == inrate && entry->outrate == outrate) {
+            break;
+        }
+        if (!entry->weights) {
+            float *weights = (float *) SDL_malloc(phases * RESAMPLER_TAPS * sizeof (float));
+            int phase;
+            if (weights) {
+                for (phase = 0; phase < phases; phase++) {
+                    ResamplerWeights(((float) (phase * divisor)) / ((float) outrate), &weights[phase * RESAMPLER_TAPS]);
+                }
+                entry->inrate = inrate;
+                entry->outrate = outrate;
+                entry->divisor = divisor;
+                entry->weights = weights;
+            }
+            break;
+        }
+    }
+    SDL_AtomicUnlock(&ResampleFilterSpinlock);
+}
+
+static const SDL_ResamplerPhases *
+SDL_GetResamplerPhases(const int inrate, const int outrate)
+{
+    const SDL_ResamplerPhases *retval = NULL;
+    int i;
+
+    SDL_AtomicLock(&ResampleFilterSpinlock);
+    for (i = 0; i < RESAMPLER_CACHED_RATIOS && ResamplerPhases[i].weights; i++) {
+        if (ResamplerPhases[i].inrate == inrate && ResamplerPhases[i].outrate == outrate) {
+            retval = &ResamplerPhases[i];
+            break;
+        }
+    }
+    SDL_AtomicUnlock(&ResampleFilterSpinlock);
+    return retval;
+}
+
+/* Makes one output frame of 'chans' channels from RESAMPLER_TAPS input frames */
+typedef void (*SDL_ResampleFrameFunc)(const int chans, const float *src, const float *weights, float *dst);
+
+static void
+SDL_ResampleFrame_Scalar(const int chans, const float *src, const float *weights, float *dst)
+{
+    int chan, i;
+
+    for (chan = 0; chan < chans; chan++) {
+        float outsample = 0.0f;
+        for (i = 0; i < RESAMPLER_TAPS; i++) {
+            outsample += src[(i * chans) + chan] * weights[i];
+        }
+        dst[chan] = outsample;
+    }
+}
+
+#if HAVE_SSE2_INTRINSICS
+static void
+SDL_ResampleFrame_SSE2(const int chans, const float *src, const float *weights, float *dst)
+{
+    int chan = 0, i;
+
+    if (chans == 1) {
+        __m128 sum = _mm_mul_ps(_mm_loadu_ps(src), _mm_loadu_ps(weights));
+        for (i = 4; i < RESAMPLER_TAPS; i += 4) {
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(src + i), _mm_loadu_ps(weights + i)));
+        }
+        sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+        _mm_store_ss(dst, _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 1, 1, 1))));
+        return;
+    } else if (chans == 2) {
+        /* Two frames at a time, with each weight used for both channels */
+        __m128 sum = _mm_setzero_ps();
+        for (i = 0; i < RESAMPLER_TAPS; i += 4) {
+            const __m128 w = _mm_loadu_ps(weights + i);
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(src + (i * 2)), _mm_unpacklo_ps(w, w)));
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(src + (i * 2) + 4), _mm_unpackhi_ps(w, w)));
+        }
+        _mm_storel_pi((__m64 *) dst, _mm_add_ps(sum, _mm_movehl_ps(sum, sum)));
+        return;
+    }
+
+    /* Four channels at a time */
+    for (; chan + 4 <= chans; chan += 4) {
+        __m128 sum = _mm_setzero_ps();
+        for (i = 0; i < RESAMPLER_TAPS; i++) {
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(src + (i * chans) + chan), _mm_set1_ps(weights[i])));
+        }
+        _mm_storeu_ps(dst + chan, sum);
+    }
+    for (; chan < chans; chan++) {
+        float outsample = 0.0f;
+        for (i = 0; i < RESAMPLER_TAPS; i++) {
+            outsample += src[(i * chans) + chan] * weights[i];
+        }
+        dst[chan] = outsample;
+    }
+}
+#endif
+
+#if HAVE_NEON_INTRINSICS
+static void
+SDL_ResampleFrame_NEON(const int chans, const float *src, const float *weights, float *dst)
+{
+    int chan = 0, i;
+
+    if (chans == 1) {
+        float32x4_t sum = vmulq_f32(vld1q_f32(src), vld1q_f32(weights));
+        float32x2_t half;
+        for (i = 4; i < RESAMPLER_TAPS; i += 4) {
+            sum = vmlaq_f32(sum, vld1q_f32(src + i), vld1q_f32(weights + i));
+        }
+        half = vadd_f32(vget_low_f32(sum), vget_high_f32(sum));
+        dst[0] = vget_lane_f32(vpadd_f32(half, half), 0);
+        return;
+    } else if (chans == 2) {
+        float32x4_t sum = vdupq_n_f32(0.0f);
+        for (i = 0; i < RESAMPLER_TAPS; i += 4) {
+            const float32x4_t w = vld1q_f32(weights + i);
+            const float32x4x2_t pairs = vzipq_f32(w, w);
+            sum = vmlaq_f32(sum, vld1q_f32(src + (i * 2)), pairs.val[0]);
+            sum = vmlaq_f32(sum, vld1q_f32(src + (i * 2) + 4), pairs.val[1]);
+        }
+        vst1_f32(dst, vadd_f32(vget_low_f32(sum), vget_high_f32(sum)));
+        return;
+    }
+
+    for (; chan + 4 <= chans; chan += 4) {
+        float32x4_t sum = vdupq_n_f32(0.0f);
+        for (i = 0; i < RESAMPLER_TAPS; i++) {
+            sum = vmlaq_n_f32(sum, vld1q_f32(src + (i * chans) + chan), weights[i]);
+        }
+        vst1q_f32(dst + chan, sum);
+    }
+    for (; chan < chans; chan++) {
+        float outsample = 0.0f;
+        for (i = 0; i < RESAMPLER_TAPS; i++) {
+            outsample += src[(i * chans) + chan] * weights[i];
+        }
+        dst[chan] = outsample;
+    }
+}
+#endif
+
+/* The cheaper resamplers only look at the two (linear) or four (cubic)
+   frames around the output frame, and compute their weights as they go. */
+typedef void (*SDL_ResamplerWeightsFunc)(const float interpolation, float *weights);
+
+static void
+LinearWeights(const float interpolation, float *weights)
+{
+    weights[0] = 1.0f - interpolation;
+    weights[1] = interpolation;
+}
+
+/* Catmull-Rom spline through the two frames on each side */
+static void
+CubicWeights(const float interpolation, float *weights)
+{
+    const float t = interpolation;
+    const float t2 = t * t;
+    const float t3 = t2 * t;
+    weights[0] = (-0.5f * t3) + t2 - (0.5f * t);
+    weights[1] = (1.5f * t3) - (2.5f * t2) + 1.0f;
+    weights[2] = (-1.5f * t3) + (2.0f * t2) + (0.5f * t);
+    weights[3] = (0.5f * t3) - (0.5f * t2);
+}
+
+static void
+SDL_ResampleFrame_Linear(const int chans, const float *src, const float *weights, float *dst)
+{
+    int chan;
+
+    for (chan = 0; chan < chans; chan++) {
+        dst[chan] = (src[chan] * weights[0]) + (src[chans + chan] * weights[1]);
+    }
+}
+
+static void
+SDL_ResampleFrame_Cubic(const int chans, const float *src, const float *weights, float *dst)
+{
+    int chan;
+
+    for (chan = 0; chan < chans; chan++) {
+        dst[chan] = (src[chan] * weights[0]) + (src[chans + chan] * weights[1]) +
+                    (src[(chans * 2) + chan] * weights[2]) + (src[(chans * 3) + chan] * weights[3]);
+    }
+}
+
+static SDL_ResampleFrameFunc
+SDL_ChooseResampleFrameFunc(void)
+{
+#if HAVE_NEON_INTRINSICS
+    if (SDL_HasNEON()) {
+        return SDL_ResampleFrame_NEON;
+    }
+#endif
+#if HAVE_SSE2_INTRINSICS
+    if (SDL_HasSSE2()) {
+        return SDL_ResampleFrame_SSE2;
+    }
+#endif
+    return SDL_ResampleFrame_Scalar;
+}
+
+/* Linear or cubic resampling of the frames that don't reach into the
+   padding, advancing the position. Kept apart from SDL_ResampleAudio() so
+   the loops keep everything in registers. Returns the frames made. */
+static int
+SDL_ResampleInterpolated(const int taps, const int chans,
+                         const float *inbuf, const int inframes,
+                         float *dst, const int maxoutframes,
+                         int *_srcindex, int *_phase,
+                         const int srcstep, const int phasestep, const int phaseunits)
+{
+    const float phasescale = 1.0f / ((float) phaseunits);
+    int srcindex = *_srcindex;
+    int phase = *_phase;
+    int i, chan;
+
+    if (taps == 2) {
+        for (i = 0; i < maxoutframes && srcindex + 2 <= inframes; i++) {
+            const float *src = &inbuf[srcindex * chans];
+            const float t = phase * phasescale;
+            for (chan = 0; chan < chans; chan++) {
+                dst[chan] = src[chan] + (t * (src[chans + chan] - src[chan]));
+            }
+            dst += chans;
+            srcindex += srcstep;
+            phase += phasestep;
+            if (phase >= phaseunits) {
+                phase -= phaseunits;
+                srcindex++;
+            }
+        }
+    } else {
+        for (i = 0; i < maxoutframes && srcindex + 3 <= inframes; i++) {
+            const float *src = &inbuf[(srcindex - 1) * chans];
+            const float t = phase * phasescale;
+            for (chan = 0; chan < chans; chan++) {
+                /* CubicWeights(), factored by powers of t */
+                const float p0 = src[chan];
+                const float p1 = src[chans + chan];
+                const float p2 = src[(chans * 2) + chan];
+                const float p3 = src[(chans * 3) + chan];
+                const float a = (1.5f * (p1 - p2)) + (0.5f * (p3 - p0));
+                const float b = p0 - (2.5f * p1) + (2.0f * p2) - (0.5f * p3);
+                const float c = 0.5f * (p2 - p0);
+                dst[chan] = (((((a * t) + b) * t) + c) * t) + p1;
+            }
+            dst += chans;
+            srcindex += srcstep;
+            phase += phasestep;
+            if (phase >= phaseunits) {
+                phase -= phaseunits;
+                srcindex++;
+            }
+        }
+    }
+
+    *_srcindex = srcindex;
+    *_phase = phase;
+    return i;
+}
+
 /* lpadding and rpadding are expected to be buffers of (ResamplePadding(inrate, outrate) * chans * sizeof (float)) bytes. */
 static int
-SDL_ResampleAudio(const int chans, const int inrate, const int outrate,
+SDL_ResampleAudio(const SDL_AudioResampleQuality quality,
+                        const int chans, const int inrate, const int outrate,
                         const float *lpadding, const float *rpadding,
                         const float *inbuf, const int inbuflen,
                         float *outbuf, const int outbuflen)
 {
-    const double finrate = (double) inrate;
-    const double outtimeincr = 1.0 / ((float) outrate);
     const double  ratio = ((float) outrate) / ((float) inrate);
     const int paddinglen = ResamplerPadding(inrate, outrate);
     const int framelen = chans * (int)sizeof (float);
@@ -496,46 +835,106 @@ SDL_ResampleAudio(const int chans, const int inrate, const int outrate,
     const int wantedoutframes = (int) ((inbuflen / framelen) * ratio);  /* outbuflen isn't total to write, it's total available. */
     const int maxoutframes = outbuflen / framelen;
     const int outframes = SDL_min(wantedoutframes, maxoutframes);
+    const SDL_bool sinc = (quality == SDL_AUDIO_RESAMPLE_SINC);
+    const int taps = sinc ? RESAMPLER_TAPS : ((quality == SDL_AUDIO_RESAMPLE_CUBIC) ? 4 : 2);
+    const int lefttaps = (taps / 2) - 1;  /* frames before the one at or before the output frame */
+    const SDL_ResamplerPhases *phases = sinc ? SDL_GetResamplerPhases(inrate, outrate) : NULL;
+    /* With a table of weights, phases are counted in table entries */
+    const int phaseunits = phases ? (outrate / phases->divisor) : outrate;
+    const int srcstep = inrate / outrate;
+    const int phasestep = (inrate % outrate) / (outrate / phaseunits);
+    const float phasescale = 1.0f / ((float) phaseunits);
+    const SDL_ResamplerWeightsFunc getweights = sinc ? ResamplerWeights : ((taps == 4) ? CubicWeights : LinearWeights);
+    const SDL_ResampleFrameFunc resample = sinc ? SDL_ChooseResampleFrameFunc() : ((taps == 4) ? SDL_ResampleFrame_Cubic : SDL_ResampleFrame_Linear);
+    float edge[RESAMPLER_TAPS * 8];
+    float weights[RESAMPLER_TAPS];
     float *dst = outbuf;
-    double outtime = 0.0;
+    int srcindex = 0;   /* the input frame at or before the output frame */
+    int phase = 0;      /* how far past it the output frame is, in 1/phaseunits of a frame */
     int i, j, chan;
 
-    for (i = 0; i < outframes; i++) {
-        const int srcindex = (int) (outtime * inrate);
-        const double intime = ((double) srcindex) / finrate;
-        const double innexttime = ((double) (srcindex + 1)) / finrate;
-        const double interpolation1 = 1.0 - ((innexttime - outtime) / (innexttime - intime));
-        const int filterindex1 = (int) (interpolation1 * RESAMPLER_SAMPLES_PER_ZERO_CROSSING);
-        const double interpolation2 = 1.0 - interpolation1;
-        const int filterindex2 = (int) (interpolation2 * RESAMPLER_SAMPLES_PER_ZERO_CROSSING);
-
-        for (chan = 0; chan < chans; chan++) {
-            float outsample = 0.0f;
-
-            /* do this twice to calculate the sample, once for the "left wing" and then same for the right. */
-            /* !!! FIXME: do both wings in one loop */
-            for (j = 0; (filterindex1 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING)) < RESAMPLER_FILTER_SIZE; j++) {
-                const int srcframe = srcindex - j;
-                /* !!! FIXME: we can bubble this conditional out of here by doing a pre loop. */
-                const float insample = (srcframe < 0) ? lpadding[((paddinglen + srcframe) * chans) + chan] : inbuf[(srcframe * chans) + chan];
-                outsample += (float)(insample * (ResamplerFilter[filterindex1 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING)] + (interpolation1 * ResamplerFilterDifference[filterindex1 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING)])));
-            }
-
-            for (j = 0; (filterindex2 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING)) < RESAMPLER_FILTER_SIZE; j++) {
-                const int srcframe = srcindex + 1 + j;
-                /* !!! FIXME: we can bubble this conditional out of here by doing a post loop. */
-                const float insample = (srcframe >= inframes) ? rpadding[((srcframe - inframes) * chans) + chan] : inbuf[(srcframe * chans) + chan];
-                outsample += (float)(insample * (ResamplerFilter[filterindex2 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING)] + (interpolation2 * ResamplerFilterDifference[filterindex2 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING)])));
-            }
-            *(dst++) = outsample;
+    SDL_assert(chans <= 8);
+
+/* Finds the weights for the current phase and moves to the next output frame */
+#define RESAMPLER_WEIGHTS() \
+    (phases ? &phases->weights[phase * RESAMPLER_TAPS] : \
+     (getweights(phase * phasescale, weights), weights))
+#define RESAMPLER_NEXT() { \
+        dst += chans; \
+        srcindex += srcstep; \
+        phase += phasestep; \
+        if (phase >= phaseunits) { \
+            phase -= phaseunits; \
+            srcindex++; \
+        } \
+    }
+/* Copies the taps of a frame near the ends, which reach into the padding */
+#define RESAMPLER_EDGE() { \
+        for (j = 0; j < taps; j++) { \
+            const int srcframe = srcindex - lefttaps + j; \
+            const float *insample; \
+            if (srcframe < 0) { \
+                insample = &lpadding[(paddinglen + srcframe) * chans]; \
+            } else if (srcframe >= inframes) { \
+                insample = &rpadding[(srcframe - inframes) * chans]; \
+            } else { \
+                insample = &inbuf[srcframe * chans]; \
+            } \
+            for (chan = 0; chan < chans; chan++) { \
+                edge[(j * chans) + chan] = insample[chan]; \
+            } \
+        } \
+    }
+
+    /* Frames whose left wing starts in the padding */
+    for (i = 0; i < outframes && srcindex < lefttaps; i++) {
+        RESAMPLER_EDGE();
+        resample(chans, edge, RESAMPLER_WEIGHTS(), dst);
+        RESAMPLER_NEXT();
+    }
+
+    /* Frames entirely within the input */
+    if (sinc) {
+        for (; i < outframes && (srcindex - lefttaps) + taps <= inframes; i++) {
+            resample(chans, &inbuf[(srcindex - lefttaps) * chans], RESAMPLER_WEIGHTS(), dst);
+            RESAMPLER_NEXT();
         }
+    } else {
+        const int count = SDL_ResampleInterpolated(taps, chans, inbuf, inframes, dst, outframes - i,
+                                                   &srcindex, &phase, srcstep, phasestep, phaseunits);
+        dst += count * chans;
+        i += count;
+    }
 
-        outtime += outtimeincr;
+    /* Frames whose right wing ends in the padding */
+    for (; i < outframes; i++) {
+        RESAMPLER_EDGE();
+        resample(chans, edge, RESAMPLER_WEIGHTS(), dst);
+        RESAMPLER_NEXT();
     }
+#undef RESAMPLER_WEIGHTS
+#undef RESAMPLER_NEXT
+#undef RESAMPLER_EDGE
 
     return outframes * chans * sizeof (float);
 }
 
+void
+SDL_FreeResampleFilter(void)
+{
+    int i;
+
+    SDL_free(ResamplerFilter);
+    SDL_free(ResamplerFilterDifference);
+    ResamplerFilter = NULL;
+    ResamplerFilterDifference = NULL;
+
+    for (i = 0; i < RESAMPLER_CACHED_RATIOS; i++) {
+        SDL_free(ResamplerPhases[i].weights);
+        ResamplerPhases[i].weights = NULL;
+    }
+}
+
 int
 SDL_ConvertAudio(SDL_AudioCVT * cvt)
 {
@@ -730,7 +1129,7 @@ SDL_ResampleCVT(SDL_AudioCVT *cvt, const int chans, const SDL_AudioFormat format
         return;
     }
 
-    cvt->len_cvt = SDL_ResampleAudio(chans, inrate, outrate, padding, padding, src, srclen, dst, dstlen);
+    cvt->len_cvt = SDL_ResampleAudio(SDL_AUDIO_RESAMPLE_SINC, chans, inrate, outrate, padding, padding, src, srclen, dst, dstlen);
 
     SDL_free(padding);
 
@@ -790,6 +1189,7 @@ SDL_BuildAudioResampleCVT(SDL_AudioCVT * cvt, const int dst_channels,
     if (SDL_PrepareResampleFilter() < 0) {
         return -1;
     }
+    SDL_PrepareResamplerPhases(src_rate, dst_rate);
 
     /* Update (cvt) with filter details... */
     if (SDL_AddAudioCVTFilter(cvt, filter) < 0) {
@@ -1105,9 +1505,16 @@ struct _SDL_AudioStream
     int resampler_padding_samples;
     float *resampler_padding;
     void *resampler_state;
+    SDL_AudioResampleQuality resample_quality;
     SDL_ResampleAudioStreamFunc resampler_func;
     SDL_ResetAudioStreamResamplerFunc reset_resampler_func;
     SDL_CleanupAudioStreamResamplerFunc cleanup_resampler_func;
+    SDL_atomic_t gain;  /* float bits, so the app can change it while the device mixes. */
+    SDL_AudioDeviceID bound_device;
+    SDL_AudioRing *bound_input;
+    Uint8 *bound_chunk;
+    int bound_chunk_len;
+    int bound_pending;
 };
 
 static Uint8 *
@@ -1234,7 +1641,7 @@ SDL_ResampleAudioStream(SDL_AudioStream *stream, const void *_inbuf, const int i
 
     SDL_assert(inbuf != ((const float *) outbuf));  /* SDL_AudioStreamPut() shouldn't allow in-place resamples. */
 
-    retval = SDL_ResampleAudio(chans, inrate, outrate, lpadding, rpadding, inbuf, inbuflen, outbuf, outbuflen);
+    retval = SDL_ResampleAudio(stream->resample_quality, chans, inrate, outrate, lpadding, rpadding, inbuf, inbuflen, outbuf, outbuflen);
 
     /* update our left padding with end of current input, for next run. */
     SDL_memcpy((lpadding + paddingsamples) - (cpy / sizeof (float)), inbufend - cpy, cpy);
@@ -1255,6 +1662,43 @@ SDL_CleanupAudioStreamResampler(SDL_AudioStream *stream)
     SDL_free(stream->resampler_state);
 }
 
+static int
+SetupBuiltinResampling(SDL_AudioStream *stream)
+{
+    stream->resampler_state = SDL_calloc(stream->resampler_padding_samples, sizeof (float));
+    if (!stream->resampler_state) {
+        return SDL_OutOfMemory();
+    }
+
+    /* Linear and cubic resampling don't need the filter */
+    if (stream->resample_quality == SDL_AUDIO_RESAMPLE_SINC) {
+        if (SDL_PrepareResampleFilter() < 0) {
+            SDL_free(stream->resampler_state);
+            stream->resampler_state = NULL;
+            return -1;
+        }
+        SDL_PrepareResamplerPhases(stream->src_rate, stream->dst_rate);
+    }
+
+    stream->resampler_func = SDL_ResampleAudioStream;
+    stream->reset_resampler_func = SDL_ResetAudioStreamResampler;
+    stream->cleanup_resampler_func = SDL_CleanupAudioStreamResampler;
+    return 0;
+}
+
+static SDL_AudioResampleQuality
+GetResampleQualityHint(void)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_AUDIO_RESAMPLING_MODE);
+
+    if (hint && SDL_strcasecmp(hint, "linear") == 0) {
+        return SDL_AUDIO_RESAMPLE_LINEAR;
+    } else if (hint && SDL_strcasecmp(hint, "cubic") == 0) {
+        return SDL_AUDIO_RESAMPLE_CUBIC;
+    }
+    return SDL_AUDIO_RESAMPLE_SINC;
+}
+
 SDL_AudioStream *
 SDL_NewAudioStream(const SDL_AudioFormat src_format,
                    const Uint8 src_channels,
@@ -1290,6 +1734,8 @@ SDL_NewAudioStream(const SDL_AudioFormat src_format,
     retval->pre_resample_channels = pre_resample_channels;
     retval->packetlen = packetlen;
     retval->rate_incr = ((double) dst_rate) / ((double) src_rate);
+    retval->resample_quality = GetResampleQualityHint();
+    SDL_AudioStreamSetGain(retval, 1.0f);
     retval->resampler_padding_samples = ResamplerPadding(retval->src_rate, retval->dst_rate) * pre_resample_channels;
     retval->resampler_padding = (float *) SDL_calloc(retval->resampler_padding_samples, sizeof (float));
 
@@ -1325,27 +1771,14 @@ SDL_NewAudioStream(const SDL_AudioFormat src_format,
         }
 
 #ifdef HAVE_LIBSAMPLERATE_H
-        SetupLibSampleRateResampling(retval);
+        if (retval->resample_quality == SDL_AUDIO_RESAMPLE_SINC) {
+            SetupLibSampleRateResampling(retval);
+        }
 #endif
 
-        if (!retval->resampler_func) {
-            retval->resampler_state = SDL_calloc(retval->resampler_padding_samples, sizeof (float));
-            if (!retval->resampler_state) {
-                SDL_FreeAudioStream(retval);
-                SDL_OutOfMemory();
-                return NULL;
-            }
-
-            if (SDL_PrepareResampleFilter() < 0) {
-                SDL_free(retval->resampler_state);
-                retval->resampler_state = NULL;
-                SDL_FreeAudioStream(retval);
-                return NULL;
-            }
-
-            retval->resampler_func = SDL_ResampleAudioStream;
-            retval->reset_resampler_func = SDL_ResetAudioStreamResampler;
-            retval->cleanup_resampler_func = SDL_CleanupAudioStreamResampler;
+        if (!retval->resampler_func && SetupBuiltinResampling(retval) < 0) {
+            SDL_FreeAudioStream(retval);
+            return NULL;
         }
 
         /* Convert us to the final format after resampling. */
@@ -1493,6 +1926,10 @@ SDL_AudioStreamPutInternal(SDL_AudioStream *stream, const void *buf, int len, in
     return buflen ? SDL_WriteToDataQueue(stream->queue, resamplebuf, buflen) : 0;
 }
 
+static int SDL_AudioStreamConvertInput(SDL_AudioStream *stream, const void *buf, int len);
+static int SDL_AudioStreamFlushInput(SDL_AudioStream *stream);
+static int SDL_AudioStreamPutBound(SDL_AudioStream *stream, const void *buf, int len);
+
 int
 SDL_AudioStreamPut(SDL_AudioStream *stream, const void *buf, int len)
 {
@@ -1516,8 +1953,16 @@ SDL_AudioStreamPut(SDL_AudioStream *stream, const void *buf, int len)
         return 0;  /* nothing to do. */
     } else if ((len % stream->src_sample_frame_size) != 0) {
         return SDL_SetError("Can't add partial sample frames");
+    } else if (stream->bound_input) {
+        return SDL_AudioStreamPutBound(stream, buf, len);
     }
 
+    return SDL_AudioStreamConvertInput(stream, buf, len);
+}
+
+static int
+SDL_AudioStreamConvertInput(SDL_AudioStream *stream, const void *buf, int len)
+{
     if (!stream->cvt_before_resampling.needed &&
         (stream->dst_rate == stream->src_rate) &&
         !stream->cvt_after_resampling.needed) {
@@ -1562,8 +2007,16 @@ int SDL_AudioStreamFlush(SDL_AudioStream *stream)
 {
     if (!stream) {
         return SDL_InvalidParamError("stream");
+    } else if (stream->bound_input) {
+        return SDL_AudioStreamPutBound(stream, NULL, 0);
     }
 
+    return SDL_AudioStreamFlushInput(stream);
+}
+
+static int
+SDL_AudioStreamFlushInput(SDL_AudioStream *stream)
+{
     #if DEBUG_AUDIOSTREAM
     printf("AUDIOSTREAM: flushing! staging_buffer_filled=%d bytes\n", stream->staging_buffer_filled);
     #endif
@@ -1626,6 +2079,8 @@ SDL_AudioStreamGet(SDL_AudioStream *stream, void *buf, int len)
         return 0;  /* nothing to do. */
     } else if ((len % stream->dst_sample_frame_size) != 0) {
         return SDL_SetError("Can't request partial sample frames");
+    } else if (stream->bound_input) {
+        return SDL_SetError("Audio stream is bound to a device");
     }
 
     return (int) SDL_ReadFromDataQueue(stream->queue, buf, len);
@@ -1635,7 +2090,7 @@ SDL_AudioStreamGet(SDL_AudioStream *stream, void *buf, int len)
 int
 SDL_AudioStreamAvailable(SDL_AudioStream *stream)
 {
-    return stream ? (int) SDL_CountDataQueue(stream->queue) : 0;
+    return (stream && !stream->bound_input) ? (int) SDL_CountDataQueue(stream->queue) : 0;
 }
 
 void
@@ -1643,6 +2098,8 @@ SDL_AudioStreamClear(SDL_AudioStream *stream)
 {
     if (!stream) {
         SDL_InvalidParamError("stream");
+    } else if (stream->bound_input) {
+        SDL_SetError("Audio stream is bound to a device");
     } else {
         SDL_ClearDataQueue(stream->queue, stream->packetlen * 2);
         if (stream->reset_resampler_func) {
@@ -1653,11 +2110,212 @@ SDL_AudioStreamClear(SDL_AudioStream *stream)
     }
 }
 
+int
+SDL_AudioStreamSetResampleQuality(SDL_AudioStream *stream, SDL_AudioResampleQuality quality)
+{
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    } else if ((quality != SDL_AUDIO_RESAMPLE_SINC) && (quality != SDL_AUDIO_RESAMPLE_LINEAR) && (quality != SDL_AUDIO_RESAMPLE_CUBIC)) {
+        return SDL_InvalidParamError("quality");
+    } else if (stream->bound_input) {
+        return SDL_SetError("Audio stream is bound to a device");
+    }
+
+    if (stream->src_rate != stream->dst_rate) {
+#ifdef HAVE_LIBSAMPLERATE_H
+        /* libsamplerate only stands in for the sinc resampler */
+        if (quality != SDL_AUDIO_RESAMPLE_SINC && stream->resampler_func == SDL_ResampleAudioStream_SRC) {
+            SRC_STATE *state = (SRC_STATE *) stream->resampler_state;
+            stream->resample_quality = quality;
+            if (SetupBuiltinResampling(stream) < 0) {
+                stream->resample_quality = SDL_AUDIO_RESAMPLE_SINC;
+                stream->resampler_state = state;
+                return -1;
+            }
+            SRC_src_delete(state);
+        }
+#endif
+        if (quality == SDL_AUDIO_RESAMPLE_SINC && stream->resampler_func == SDL_ResampleAudioStream) {
+            if (SDL_PrepareResampleFilter() < 0) {
+                return -1;
+            }
+            SDL_PrepareResamplerPhases(stream->src_rate, stream->dst_rate);
+        }
+    }
+
+    stream->resample_quality = quality;
+    return 0;
+}
+
+SDL_AudioResampleQuality
+SDL_AudioStreamGetResampleQuality(SDL_AudioStream *stream)
+{
+    if (!stream) {
+        SDL_InvalidParamError("stream");
+        return SDL_AUDIO_RESAMPLE_SINC;
+    }
+    return stream->resample_quality;
+}
+
+int
+SDL_AudioStreamSetGain(SDL_AudioStream *stream, float gain)
+{
+    union { float f; int i; } bits;
+
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    } else if (!(gain >= 0.0f)) {
+        return SDL_InvalidParamError("gain");
+    }
+
+    bits.f = gain;
+    SDL_AtomicSet(&stream->gain, bits.i);
+    return 0;
+}
+
+float
+SDL_AudioStreamGetGain(SDL_AudioStream *stream)
+{
+    union { float f; int i; } bits;
+
+    if (!stream) {
+        SDL_InvalidParamError("stream");
+        return 0.0f;
+    }
+
+    bits.i = SDL_AtomicGet(&stream->gain);
+    return bits.f;
+}
+
+/* A stream bound to a device is fed on the app's thread and drained on the
+   audio thread. SDL_AudioStreamPut() and SDL_AudioStreamFlush() only append
+   a record to a lock-free ring then: an Sint32 byte count followed by that
+   much input, or a count of zero for a flush. The audio thread converts
+   records as it needs output, so a huge put can't stall it. */
+static int
+SDL_AudioStreamPutBound(SDL_AudioStream *stream, const void *buf, int len)
+{
+    const Sint32 header = (Sint32) len;
+
+    /* reserve first, so the header never goes out without its data. */
+    if (SDL_ReserveAudioRing(stream->bound_input, sizeof (header) + len) < 0) {
+        return -1;
+    } else if (SDL_WriteToAudioRing(stream->bound_input, &header, sizeof (header)) < 0) {
+        return -1;
+    }
+    return (len > 0) ? SDL_WriteToAudioRing(stream->bound_input, buf, len) : 0;
+}
+
+/* Converts the next chunk of a bound stream's input; SDL_FALSE if there is none yet. */
+static SDL_bool
+SDL_AudioStreamPumpBound(SDL_AudioStream *stream)
+{
+    int amount, got;
+
+    if (stream->bound_pending == 0) {
+        Sint32 header;
+        if (SDL_CountAudioRing(stream->bound_input) < sizeof (header)) {
+            return SDL_FALSE;
+        }
+        SDL_ReadFromAudioRing(stream->bound_input, &header, sizeof (header));
+        if (header == 0) {
+            SDL_AudioStreamFlushInput(stream);
+            return SDL_TRUE;
+        }
+        stream->bound_pending = header;
+    }
+
+    /* the data may not be published yet if we caught the header alone. */
+    amount = SDL_min(stream->bound_pending, stream->bound_chunk_len);
+    got = (int) SDL_ReadFromAudioRing(stream->bound_input, stream->bound_chunk, amount);
+    if (got == 0) {
+        return SDL_FALSE;
+    }
+
+    SDL_assert(got == amount);
+    stream->bound_pending -= got;
+
+    /* if this fails...oh well. The device will play silence for it. */
+    SDL_AudioStreamConvertInput(stream, stream->bound_chunk, got);
+    return SDL_TRUE;
+}
+
+int
+SDL_AudioStreamBeginBinding(SDL_AudioStream *stream, SDL_AudioDeviceID devid, const SDL_AudioSpec *spec)
+{
+    const int framesize = stream->src_sample_frame_size;
+
+    if (stream->bound_device) {
+        return SDL_SetError("Audio stream is already bound to a device");
+    } else if ((stream->dst_format != AUDIO_F32SYS) || (stream->dst_channels != spec->channels) || (stream->dst_rate != spec->freq)) {
+        return SDL_SetError("Audio stream must output AUDIO_F32SYS at the device's channels and frequency");
+    }
+
+    stream->bound_chunk_len = SDL_max(stream->packetlen / framesize, 1) * framesize;
+    stream->bound_chunk = (Uint8 *) SDL_malloc(stream->bound_chunk_len);
+    if (!stream->bound_chunk) {
+        return SDL_OutOfMemory();
+    }
+
+    stream->bound_input = SDL_NewAudioRing(stream->packetlen, stream->packetlen * 2);
+    if (!stream->bound_input) {
+        SDL_free(stream->bound_chunk);
+        stream->bound_chunk = NULL;
+        return -1;
+    }
+
+    stream->bound_pending = 0;
+    stream->bound_device = devid;
+    return 0;
+}
+
+void
+SDL_AudioStreamEndBinding(SDL_AudioStream *stream)
+{
+    /* Convert whatever is left, so the app can get it as usual. */
+    while (SDL_AudioStreamPumpBound(stream)) {
+        /* keep going. */
+    }
+
+    SDL_FreeAudioRing(stream->bound_input);
+    SDL_free(stream->bound_chunk);
+    stream->bound_input = NULL;
+    stream->bound_chunk = NULL;
+    stream->bound_device = 0;
+}
+
+SDL_AudioDeviceID
+SDL_AudioStreamGetBinding(SDL_AudioStream *stream)
+{
+    return stream->bound_device;
+}
+
+int
+SDL_AudioStreamMixBound(SDL_AudioStream *stream, float *mix, float *scratch, const int len)
+{
+    const float gain = SDL_AudioStreamGetGain(stream);
+    int got, i;
+
+    /* Only convert as much input as this buffer needs. */
+    while ((((int) SDL_CountDataQueue(stream->queue)) < len) && SDL_AudioStreamPumpBound(stream)) {
+        /* keep going. */
+    }
+
+    got = (int) SDL_ReadFromDataQueue(stream->queue, scratch, len);
+    for (i = 0; i < (int) (got / sizeof (float)); i++) {
+        mix[i] += scratch[i] * gain;
+    }
+    return got;
+}
+
 /* dispose of a stream */
 void
 SDL_FreeAudioStream(SDL_AudioStream *stream)
 {
     if (stream) {
+        if (stream->bound_device) {
+            SDL_UnbindAudioStream(stream);
+        }
         if (stream->cleanup_resampler_func) {
             stream->cleanup_resampler_func(stream);
         }
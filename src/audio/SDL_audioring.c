@@ -0,0 +1,285 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2017 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../SDL_internal.h"
+
+#include "SDL.h"
+#include "SDL_atomic.h"
+#include "SDL_audioring.h"
+
+typedef struct SDL_AudioRingPacket
+{
+    struct SDL_AudioRingPacket *next;  /* next packet in the ring, or in a free list. */
+    Uint8 data[SDL_VARIABLE_LENGTH_ARRAY];
+} SDL_AudioRingPacket;
+
+struct SDL_AudioRing
+{
+    size_t packet_size;
+
+    /* Owned by the producer. */
+    SDL_AudioRingPacket *tail;  /* packet being written. */
+    size_t tail_pos;  /* bytes written to tail. */
+    SDL_AudioRingPacket *pool;  /* spare packets, ready to be linked in. */
+    size_t pool_len;
+
+    /* Owned by the consumer. */
+    SDL_AudioRingPacket *head;  /* packet being read. */
+    size_t head_pos;  /* bytes read from head. */
+
+    /* Shared. The byte totals wrap around; only their difference matters. */
+    SDL_atomic_t written;
+    SDL_atomic_t read;
+    SDL_atomic_t discard;  /* the consumer skips ahead to this total; never behind read for long. */
+    void *recycled;  /* packets the consumer is done with, as an atomic stack. */
+};
+
+static void
+SDL_FreeAudioRingPackets(SDL_AudioRingPacket *packet)
+{
+    while (packet) {
+        SDL_AudioRingPacket *next = packet->next;
+        SDL_free(packet);
+        packet = next;
+    }
+}
+
+SDL_AudioRing *
+SDL_NewAudioRing(const size_t _packetlen, const size_t initialslack)
+{
+    SDL_AudioRing *ring = (SDL_AudioRing *) SDL_calloc(1, sizeof (SDL_AudioRing));
+
+    if (!ring) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+
+    ring->packet_size = _packetlen;
+    ring->head = (SDL_AudioRingPacket *) SDL_malloc(sizeof (SDL_AudioRingPacket) + _packetlen);
+    if (!ring->head) {
+        SDL_free(ring);
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    ring->head->next = NULL;
+    ring->tail = ring->head;
+
+    if (SDL_ReserveAudioRing(ring, initialslack) < 0) {
+        SDL_FreeAudioRing(ring);
+        return NULL;
+    }
+
+    return ring;
+}
+
+void
+SDL_FreeAudioRing(SDL_AudioRing *ring)
+{
+    if (ring) {
+        SDL_FreeAudioRingPackets(ring->head);  /* head's chain ends with tail. */
+        SDL_FreeAudioRingPackets(ring->pool);
+        SDL_FreeAudioRingPackets((SDL_AudioRingPacket *) ring->recycled);
+        SDL_free(ring);
+    }
+}
+
+int
+SDL_ReserveAudioRing(SDL_AudioRing *ring, const size_t len)
+{
+    const size_t packet_size = ring->packet_size;
+    const size_t room = packet_size - ring->tail_pos;
+    size_t needed;
+
+    if (len <= room) {
+        return 0;
+    }
+
+    needed = ((len - room) + (packet_size - 1)) / packet_size;
+
+    if (ring->pool_len < needed) {
+        /* Take back everything the consumer has finished with first. */
+        SDL_AudioRingPacket *packet = (SDL_AudioRingPacket *) SDL_AtomicSetPtr(&ring->recycled, NULL);
+        while (packet) {
+            SDL_AudioRingPacket *next = packet->next;
+            packet->next = ring->pool;
+            ring->pool = packet;
+            ring->pool_len++;
+            packet = next;
+        }
+    }
+
+    while (ring->pool_len < needed) {
+        SDL_AudioRingPacket *packet = (SDL_AudioRingPacket *) SDL_malloc(sizeof (SDL_AudioRingPacket) + packet_size);
+        if (!packet) {
+            return SDL_OutOfMemory();
+        }
+        packet->next = ring->pool;
+        ring->pool = packet;
+        ring->pool_len++;
+    }
+
+    return 0;
+}
+
+int
+SDL_WriteToAudioRing(SDL_AudioRing *ring, const void *_data, const size_t _len)
+{
+    const size_t packet_size = ring ? ring->packet_size : 0;
+    const Uint8 *data = (const Uint8 *) _data;
+    size_t len = _len;
+
+    if (!ring) {
+        return SDL_InvalidParamError("ring");
+    } else if (_len > (size_t) (SDL_MAX_SINT32 - ((Uint32) SDL_AtomicGet(&ring->written) - (Uint32) SDL_AtomicGet(&ring->read)))) {
+        /* discarded bytes count here too, until the consumer skips them. */
+        return SDL_SetError("Too much data in audio ring");
+    } else if (SDL_ReserveAudioRing(ring, _len) < 0) {
+        return -1;
+    }
+
+    while (len > 0) {
+        size_t cpy;
+
+        if (ring->tail_pos == packet_size) {
+            SDL_AudioRingPacket *packet = ring->pool;
+            SDL_assert(packet != NULL);  /* SDL_ReserveAudioRing() made sure of this. */
+            ring->pool = packet->next;
+            ring->pool_len--;
+            packet->next = NULL;
+            ring->tail->next = packet;
+            ring->tail = packet;
+            ring->tail_pos = 0;
+        }
+
+        cpy = SDL_min(len, packet_size - ring->tail_pos);
+        SDL_memcpy(ring->tail->data + ring->tail_pos, data, cpy);
+        ring->tail_pos += cpy;
+        data += cpy;
+        len -= cpy;
+    }
+
+    /* The data and any new packet links must land before the consumer sees the new total. */
+    SDL_MemoryBarrierRelease();
+    SDL_AtomicAdd(&ring->written, (int) _len);
+
+    return 0;
+}
+
+void
+SDL_DiscardAudioRing(SDL_AudioRing *ring)
+{
+    if (ring) {
+        const int written = SDL_AtomicGet(&ring->written);
+        int discard;
+        /* A CAS rather than SDL_AtomicSet(), which may only be an acquire:
+           the consumer trusts the packets up to here once it sees the mark. */
+        do {
+            discard = SDL_AtomicGet(&ring->discard);
+        } while (!SDL_AtomicCAS(&ring->discard, discard, written));
+    }
+}
+
+static void
+SDL_AdvanceAudioRing(SDL_AudioRing *ring, Uint8 *buf, size_t len)
+{
+    while (len > 0) {
+        size_t cpy;
+
+        if (ring->head_pos == ring->packet_size) {
+            /* The producer moved on from this packet before publishing what
+               follows it, so it's ours to give back. */
+            SDL_AudioRingPacket *packet = ring->head;
+            void *top;
+            ring->head = packet->next;
+            ring->head_pos = 0;
+            do {
+                top = SDL_AtomicGetPtr(&ring->recycled);
+                packet->next = (SDL_AudioRingPacket *) top;
+            } while (!SDL_AtomicCASPtr(&ring->recycled, top, packet));
+        }
+
+        cpy = SDL_min(len, ring->packet_size - ring->head_pos);
+        if (buf) {
+            SDL_memcpy(buf, ring->head->data + ring->head_pos, cpy);
+            buf += cpy;
+        }
+        ring->head_pos += cpy;
+        len -= cpy;
+    }
+}
+
+size_t
+SDL_ReadFromAudioRing(SDL_AudioRing *ring, void *_buf, const size_t _len)
+{
+    Uint32 discard, read;
+    size_t len;
+
+    if (!ring) {
+        return 0;
+    }
+
+    discard = (Uint32) SDL_AtomicGet(&ring->discard);
+    read = (Uint32) SDL_AtomicGet(&ring->read);
+    if ((Sint32) (discard - read) > 0) {
+        /* the producer wrote everything up to discard before asking to drop it. */
+        SDL_MemoryBarrierAcquire();
+        SDL_AdvanceAudioRing(ring, NULL, (size_t) (discard - read));
+        SDL_AtomicAdd(&ring->read, (int) (discard - read));
+        read = discard;
+    }
+
+    len = SDL_CountAudioRing(ring);
+    SDL_MemoryBarrierAcquire();
+    if (len > _len) {
+        len = _len;
+    }
+
+    SDL_AdvanceAudioRing(ring, (Uint8 *) _buf, len);
+    SDL_AtomicAdd(&ring->read, (int) len);
+    read += (Uint32) len;
+
+    /* Drag discard along before the wrapping totals can make an old mark look
+       new again. If the producer just moved it, leave it for the next read. */
+    if ((read - discard) > 0x40000000) {
+        SDL_AtomicCAS(&ring->discard, (int) discard, (int) read);
+    }
+
+    return len;
+}
+
+size_t
+SDL_CountAudioRing(SDL_AudioRing *ring)
+{
+    Uint32 discard, read;
+
+    if (!ring) {
+        return 0;
+    }
+
+    /* Load in this order: whatever discard and read we see, written is at least that far along. */
+    discard = (Uint32) SDL_AtomicGet(&ring->discard);
+    read = (Uint32) SDL_AtomicGet(&ring->read);
+    if ((Sint32) (discard - read) > 0) {
+        read = discard;
+    }
+    return (size_t) ((Uint32) SDL_AtomicGet(&ring->written) - read);
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
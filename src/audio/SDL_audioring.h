@@ -0,0 +1,59 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2017 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#ifndef SDL_audioring_h_
+#define SDL_audioring_h_
+
+/* A byte FIFO for handing audio between exactly one producer thread and
+   exactly one consumer thread without locks. Data lives in a chain of
+   fixed-size packets; packets the consumer is done with go back to the
+   producer through an atomic free list, so once the ring has grown to fit
+   the app's working set nothing is allocated or freed any more.
+
+   SDL_WriteToAudioRing(), SDL_ReserveAudioRing() and SDL_DiscardAudioRing()
+   may only be called by the producer, SDL_ReadFromAudioRing() only by the
+   consumer.
+   SDL_CountAudioRing() may be called from any thread. Creating and
+   freeing the ring need both sides to be idle. */
+
+struct SDL_AudioRing;
+typedef struct SDL_AudioRing SDL_AudioRing;
+
+SDL_AudioRing *SDL_NewAudioRing(const size_t packetlen, const size_t initialslack);
+void SDL_FreeAudioRing(SDL_AudioRing *ring);
+
+/* Makes sure the next writes totalling (len) bytes can't fail. */
+int SDL_ReserveAudioRing(SDL_AudioRing *ring, const size_t len);
+
+/* Writes are all or nothing; the consumer sees the whole block at once. */
+int SDL_WriteToAudioRing(SDL_AudioRing *ring, const void *data, const size_t len);
+
+/* Drops everything written so far. The consumer skips it on its next
+   read; SDL_CountAudioRing() leaves it out right away. */
+void SDL_DiscardAudioRing(SDL_AudioRing *ring);
+
+/* Reads up to (len) bytes. If (buf) is NULL the data is discarded. */
+size_t SDL_ReadFromAudioRing(SDL_AudioRing *ring, void *buf, const size_t len);
+
+size_t SDL_CountAudioRing(SDL_AudioRing *ring);
+
+#endif /* SDL_audioring_h_ */
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -27,6 +27,22 @@
 #include "SDL_audio.h"
 #include "SDL_sysaudio.h"
 
+#ifdef __SSE2__
+#define HAVE_SSE2_INTRINSICS 1
+#endif
+
+#if (defined(__ARM_NEON) || defined(__ARM_NEON__)) && SDL_BYTEORDER == SDL_LIL_ENDIAN
+#define HAVE_NEON_INTRINSICS 1
+#include <arm_neon.h>
+#endif
+
+#if defined(__ALTIVEC__) && SDL_BYTEORDER == SDL_BIG_ENDIAN
+#define HAVE_ALTIVEC_INTRINSICS 1
+#ifdef HAVE_ALTIVEC_H
+#include <altivec.h>
+#endif
+#endif
+
 /* This table is used to add two sound values together and pin
  * the value to avoid overflow.  (used with permission from ARDI)
  * Changed to use 0xFE instead of 0xFF for better sound quality.
@@ -86,6 +102,341 @@ static const Uint8 mix8[] = {
 #define ADJUST_VOLUME_U8(s, v)  (s = (((s-128)*v)/SDL_MIX_MAXVOLUME)+128)
 
 
+/* The vector mixers work on native endian samples. They mix as many
+   samples as fit their vectors and return how many that was; the scalar
+   code below does the rest. Volume scaling truncates toward zero, like
+   ADJUST_VOLUME, so the results are the same as the scalar code's. */
+typedef Uint32 (*SDL_MixAudioFunc)(Uint8 *dst, const Uint8 *src, Uint32 samples, int volume);
+
+static SDL_MixAudioFunc SDL_MixAudio_S8 = NULL;
+static SDL_MixAudioFunc SDL_MixAudio_S16 = NULL;
+static SDL_MixAudioFunc SDL_MixAudio_S32 = NULL;
+static SDL_MixAudioFunc SDL_MixAudio_F32 = NULL;
+
+#if HAVE_SSE2_INTRINSICS
+static Uint32
+SDL_MixAudio_S8_SSE2(Uint8 *dst, const Uint8 *src, Uint32 samples, int volume)
+{
+    const __m128i vol = _mm_set1_epi16((Sint16) volume);
+    const __m128i zero = _mm_setzero_si128();
+    Uint32 i;
+
+    for (i = 0; i + 16 <= samples; i += 16) {
+        __m128i s = _mm_loadu_si128((const __m128i *) (src + i));
+        if (volume != SDL_MIX_MAXVOLUME) {
+            const __m128i sign = _mm_cmpgt_epi8(zero, s);
+            __m128i lo = _mm_mullo_epi16(_mm_unpacklo_epi8(s, sign), vol);
+            __m128i hi = _mm_mullo_epi16(_mm_unpackhi_epi8(s, sign), vol);
+            lo = _mm_srai_epi16(_mm_add_epi16(lo, _mm_srli_epi16(_mm_srai_epi16(lo, 15), 9)), 7);
+            hi = _mm_srai_epi16(_mm_add_epi16(hi, _mm_srli_epi16(_mm_srai_epi16(hi, 15), 9)), 7);
+            s = _mm_packs_epi16(lo, hi);
+        }
+        _mm_storeu_si128((__m128i *) (dst + i), _mm_adds_epi8(_mm_loadu_si128((const __m128i *) (dst + i)), s));
+    }
+    return i;
+}
+
+static Uint32
+SDL_MixAudio_S16_SSE2(Uint8 *dst, const Uint8 *src, Uint32 samples, int volume)
+{
+    const __m128i vol = _mm_set1_epi16((Sint16) volume);
+    Uint32 i;
+
+    for (i = 0; i + 8 <= samples; i += 8) {
+        __m128i s = _mm_loadu_si128((const __m128i *) (src + (i * 2)));
+        if (volume != SDL_MIX_MAXVOLUME) {
+            const __m128i plo = _mm_mullo_epi16(s, vol);
+            const __m128i phi = _mm_mulhi_epi16(s, vol);
+            __m128i lo = _mm_unpacklo_epi16(plo, phi);
+            __m128i hi = _mm_unpackhi_epi16(plo, phi);
+            lo = _mm_srai_epi32(_mm_add_epi32(lo, _mm_srli_epi32(_mm_srai_epi32(lo, 31), 25)), 7);
+            hi = _mm_srai_epi32(_mm_add_epi32(hi, _mm_srli_epi32(_mm_srai_epi32(hi, 31), 25)), 7);
+            s = _mm_packs_epi32(lo, hi);
+        }
+        _mm_storeu_si128((__m128i *) (dst + (i * 2)), _mm_adds_epi16(_mm_loadu_si128((const __m128i *) (dst + (i * 2))), s));
+    }
+    return i;
+}
+
+static Uint32
+SDL_MixAudio_S32_SSE2(Uint8 *dst, const Uint8 *src, Uint32 samples, int volume)
+{
+    const __m128d vol = _mm_set1_pd(((double) volume) / ((double) SDL_MIX_MAXVOLUME));
+    const __m128i maxval = _mm_set1_epi32(0x7FFFFFFF);
+    Uint32 i;
+
+    for (i = 0; i + 4 <= samples; i += 4) {
+        __m128i s = _mm_loadu_si128((const __m128i *) (src + (i * 4)));
+        const __m128i d = _mm_loadu_si128((const __m128i *) (dst + (i * 4)));
+        __m128i sum, overflow;
+        if (volume != SDL_MIX_MAXVOLUME) {
+            /* s * volume needs 39 bits, which a double holds exactly */
+            const __m128i lo = _mm_cvttpd_epi32(_mm_mul_pd(_mm_cvtepi32_pd(s), vol));
+            const __m128i hi = _mm_cvttpd_epi32(_mm_mul_pd(_mm_cvtepi32_pd(_mm_unpackhi_epi64(s, s)), vol));
+            s = _mm_unpacklo_epi64(lo, hi);
+        }
+        /* SSE2 has no saturating 32-bit add; it overflowed if the sign of the sum differs from both inputs */
+        sum = _mm_add_epi32(d, s);
+        overflow = _mm_srai_epi32(_mm_and_si128(_mm_xor_si128(d, sum), _mm_xor_si128(s, sum)), 31);
+        sum = _mm_or_si128(_mm_andnot_si128(overflow, sum),
+                           _mm_and_si128(overflow, _mm_xor_si128(_mm_srai_epi32(d, 31), maxval)));
+        _mm_storeu_si128((__m128i *) (dst + (i * 4)), sum);
+    }
+    return i;
+}
+
+static Uint32
+SDL_MixAudio_F32_SSE2(Uint8 *dst, const Uint8 *src, Uint32 samples, int volume)
+{
+    const __m128 fvolume = _mm_set1_ps((float) volume);
+    const __m128 fmaxvolume = _mm_set1_ps(1.0f / ((float) SDL_MIX_MAXVOLUME));
+    const __m128 max_audioval = _mm_set1_ps(3.402823466e+38F);
+    const __m128 min_audioval = _mm_set1_ps(-3.402823466e+38F);
+    const float *src32 = (const float *) src;
+    float *dst32 = (float *) dst;
+    Uint32 i;
+
+    for (i = 0; i + 4 <= samples; i += 4) {
+        const __m128 s = _mm_mul_ps(_mm_mul_ps(_mm_loadu_ps(src32 + i), fvolume), fmaxvolume);
+        const __m128 sum = _mm_add_ps(_mm_loadu_ps(dst32 + i), s);
+        _mm_storeu_ps(dst32 + i, _mm_min_ps(max_audioval, _mm_max_ps(min_audioval, sum)));
+    }
+    return i;
+}
+#endif
+
+#if HAVE_NEON_INTRINSICS
+static Uint32
+SDL_MixAudio_S8_NEON(Uint8 *dst, const Uint8 *src, Uint32 samples, int volume)
+{
+    Uint32 i;
+
+    for (i = 0; i + 16 <= samples; i += 16) {
+        int8x16_t s = vld1q_s8((const Sint8 *) (src + i));
+        if (volume != SDL_MIX_MAXVOLUME) {
+            int16x8_t lo = vmulq_n_s16(vmovl_s8(vget_low_s8(s)), (Sint16) volume);
+            int16x8_t hi = vmulq_n_s16(vmovl_s8(vget_high_s8(s)), (Sint16) volume);
+            lo = vshrq_n_s16(vaddq_s16(lo, vreinterpretq_s16_u16(vshrq_n_u16(vreinterpretq_u16_s16(vshrq_n_s16(lo, 15)), 9))), 7);
+            hi = vshrq_n_s16(vaddq_s16(hi, vreinterpretq_s16_u16(vshrq_n_u16(vreinterpretq_u16_s16(vshrq_n_s16(hi, 15)), 9))), 7);
+            s = vcombine_s8(vmovn_s16(lo), vmovn_s16(hi));
+        }
+        vst1q_s8((Sint8 *) (dst + i), vqaddq_s8(vld1q_s8((const Sint8 *) (dst + i)), s));
+    }
+    return i;
+}
+
+static Uint32
+SDL_MixAudio_S16_NEON(Uint8 *dst, const Uint8 *src, Uint32 samples, int volume)
+{
+    const Sint16 *src16 = (const Sint16 *) src;
+    Sint16 *dst16 = (Sint16 *) dst;
+    Uint32 i;
+
+    for (i = 0; i + 8 <= samples; i += 8) {
+        int16x8_t s = vld1q_s16(src16 + i);
+        if (volume != SDL_MIX_MAXVOLUME) {
+            int32x4_t lo = vmull_n_s16(vget_low_s16(s), (Sint16) volume);
+            int32x4_t hi = vmull_n_s16(vget_high_s16(s), (Sint16) volume);
+            lo = vshrq_n_s32(vaddq_s32(lo, vreinterpretq_s32_u32(vshrq_n_u32(vreinterpretq_u32_s32(vshrq_n_s32(lo, 31)), 25))), 7);
+            hi = vshrq_n_s32(vaddq_s32(hi, vreinterpretq_s32_u32(vshrq_n_u32(vreinterpretq_u32_s32(vshrq_n_s32(hi, 31)), 25))), 7);
+            s = vcombine_s16(vmovn_s32(lo), vmovn_s32(hi));
+        }
+        vst1q_s16(dst16 + i, vqaddq_s16(vld1q_s16(dst16 + i), s));
+    }
+    return i;
+}
+
+static Uint32
+SDL_MixAudio_S32_NEON(Uint8 *dst, const Uint8 *src, Uint32 samples, int volume)
+{
+    const Sint32 *src32 = (const Sint32 *) src;
+    Sint32 *dst32 = (Sint32 *) dst;
+    Uint32 i;
+
+    for (i = 0; i + 4 <= samples; i += 4) {
+        int32x4_t s = vld1q_s32(src32 + i);
+        if (volume != SDL_MIX_MAXVOLUME) {
+            int64x2_t lo = vmull_n_s32(vget_low_s32(s), volume);
+            int64x2_t hi = vmull_n_s32(vget_high_s32(s), volume);
+            lo = vshrq_n_s64(vaddq_s64(lo, vreinterpretq_s64_u64(vshrq_n_u64(vreinterpretq_u64_s64(vshrq_n_s64(lo, 63)), 57))), 7);
+            hi = vshrq_n_s64(vaddq_s64(hi, vreinterpretq_s64_u64(vshrq_n_u64(vreinterpretq_u64_s64(vshrq_n_s64(hi, 63)), 57))), 7);
+            s = vcombine_s32(vmovn_s64(lo), vmovn_s64(hi));
+        }
+        vst1q_s32(dst32 + i, vqaddq_s32(vld1q_s32(dst32 + i), s));
+    }
+    return i;
+}
+
+static Uint32
+SDL_MixAudio_F32_NEON(Uint8 *dst, const Uint8 *src, Uint32 samples, int volume)
+{
+    const float fmaxvolume = 1.0f / ((float) SDL_MIX_MAXVOLUME);
+    const float fvolume = (float) volume;
+    const float32x4_t max_audioval = vdupq_n_f32(3.402823466e+38F);
+    const float32x4_t min_audioval = vdupq_n_f32(-3.402823466e+38F);
+    const float *src32 = (const float *) src;
+    float *dst32 = (float *) dst;
+    Uint32 i;
+
+    for (i = 0; i + 4 <= samples; i += 4) {
+        const float32x4_t s = vmulq_n_f32(vmulq_n_f32(vld1q_f32(src32 + i), fvolume), fmaxvolume);
+        const float32x4_t sum = vaddq_f32(vld1q_f32(dst32 + i), s);
+        vst1q_f32(dst32 + i, vminq_f32(vmaxq_f32(sum, min_audioval), max_audioval));
+    }
+    return i;
+}
+#endif
+
+#if HAVE_ALTIVEC_INTRINSICS
+/* AltiVec can't store to unaligned addresses, so these leave buffers with
+   an unaligned dst to the scalar code. Unaligned src is fine. */
+#define ALTIVEC_LOAD(type, ptr, perm) ((type) vec_perm(vec_ld(0, (ptr)), vec_ld(15, (ptr)), (perm)))
+
+static Uint32
+SDL_MixAudio_S8_AltiVec(Uint8 *dst, const Uint8 *src, Uint32 samples, int volume)
+{
+    const vector unsigned char perm = vec_lvsl(0, src);
+    const vector signed short vol = (vector signed short) { volume, volume, volume, volume, volume, volume, volume, volume };
+    const vector signed short zero = vec_splat_s16(0);
+    Uint32 i;
+
+    if (((size_t) dst) & 15) {
+        return 0;
+    }
+
+    for (i = 0; i + 16 <= samples; i += 16) {
+        vector signed char s = ALTIVEC_LOAD(vector signed char, src + i, perm);
+        if (volume != SDL_MIX_MAXVOLUME) {
+            vector signed short hi = vec_mladd(vec_unpackh(s), vol, zero);
+            vector signed short lo = vec_mladd(vec_unpackl(s), vol, zero);
+            hi = vec_sra(vec_add(hi, (vector signed short) vec_sr(vec_sra(hi, vec_splat_u16(15)), vec_splat_u16(9))), vec_splat_u16(7));
+            lo = vec_sra(vec_add(lo, (vector signed short) vec_sr(vec_sra(lo, vec_splat_u16(15)), vec_splat_u16(9))), vec_splat_u16(7));
+            s = vec_packs(hi, lo);
+        }
+        vec_st(vec_adds((vector signed char) vec_ld(0, dst + i), s), 0, (vector signed char *) (dst + i));
+    }
+    return i;
+}
+
+static Uint32
+SDL_MixAudio_S16_AltiVec(Uint8 *dst, const Uint8 *src, Uint32 samples, int volume)
+{
+    const vector unsigned char perm = vec_lvsl(0, src);
+    const vector signed short vol = (vector signed short) { volume, volume, volume, volume, volume, volume, volume, volume };
+    /* shift counts are taken modulo 32, so -1 is 31 and -7 is 25 */
+    const vector unsigned int shift31 = vec_splat_u32(-1);
+    const vector unsigned int shift25 = vec_splat_u32(-7);
+    const vector unsigned int shift7 = vec_splat_u32(7);
+    Uint32 i;
+
+    if (((size_t) dst) & 15) {
+        return 0;
+    }
+
+    for (i = 0; i + 8 <= samples; i += 8) {
+        vector signed short s = ALTIVEC_LOAD(vector signed short, src + (i * 2), perm);
+        if (volume != SDL_MIX_MAXVOLUME) {
+            vector signed int even = vec_mule(s, vol);
+            vector signed int odd = vec_mulo(s, vol);
+            even = vec_sra(vec_add(even, (vector signed int) vec_sr(vec_sra(even, shift31), shift25)), shift7);
+            odd = vec_sra(vec_add(odd, (vector signed int) vec_sr(vec_sra(odd, shift31), shift25)), shift7);
+            s = vec_packs(vec_mergeh(even, odd), vec_mergel(even, odd));
+        }
+        vec_st(vec_adds((vector signed short) vec_ld(0, dst + (i * 2)), s), 0, (vector signed short *) (dst + (i * 2)));
+    }
+    return i;
+}
+
+/* AltiVec has no 32-bit multiply, so this only does full volume */
+static Uint32
+SDL_MixAudio_S32_AltiVec(Uint8 *dst, const Uint8 *src, Uint32 samples, int volume)
+{
+    const vector unsigned char perm = vec_lvsl(0, src);
+    Uint32 i;
+
+    if ((((size_t) dst) & 15) || (volume != SDL_MIX_MAXVOLUME)) {
+        return 0;
+    }
+
+    for (i = 0; i + 4 <= samples; i += 4) {
+        const vector signed int s = ALTIVEC_LOAD(vector signed int, src + (i * 4), perm);
+        vec_st(vec_adds((vector signed int) vec_ld(0, dst + (i * 4)), s), 0, (vector signed int *) (dst + (i * 4)));
+    }
+    return i;
+}
+
+static Uint32
+SDL_MixAudio_F32_AltiVec(Uint8 *dst, const Uint8 *src, Uint32 samples, int volume)
+{
+    const vector unsigned char perm = vec_lvsl(0, src);
+    const float fmaxvolume = 1.0f / ((float) SDL_MIX_MAXVOLUME);
+    const float fvolume = (float) volume;
+    const vector float vfvolume = (vector float) { fvolume, fvolume, fvolume, fvolume };
+    const vector float vfmaxvolume = (vector float) { fmaxvolume, fmaxvolume, fmaxvolume, fmaxvolume };
+    const vector float max_audioval = (vector float) { 3.402823466e+38F, 3.402823466e+38F, 3.402823466e+38F, 3.402823466e+38F };
+    const vector float min_audioval = (vector float) { -3.402823466e+38F, -3.402823466e+38F, -3.402823466e+38F, -3.402823466e+38F };
+    const vector float negzero = (vector float) { -0.0f, -0.0f, -0.0f, -0.0f };
+    Uint32 i;
+
+    if (((size_t) dst) & 15) {
+        return 0;
+    }
+
+    for (i = 0; i + 4 <= samples; i += 4) {
+        const vector float s = vec_madd(vec_madd(ALTIVEC_LOAD(vector float, src + (i * 4), perm), vfvolume, negzero), vfmaxvolume, negzero);
+        const vector float sum = vec_add((vector float) vec_ld(0, dst + (i * 4)), s);
+        vec_st(vec_min(vec_max(sum, min_audioval), max_audioval), 0, (vector float *) (dst + (i * 4)));
+    }
+    return i;
+}
+#undef ALTIVEC_LOAD
+#endif
+
+static void
+SDL_ChooseMixers(void)
+{
+    static SDL_bool mixers_chosen = SDL_FALSE;
+
+    if (mixers_chosen) {
+        return;
+    }
+
+#define SET_MIXER_FUNCS(fntype) \
+        SDL_MixAudio_S8 = SDL_MixAudio_S8_##fntype; \
+        SDL_MixAudio_S16 = SDL_MixAudio_S16_##fntype; \
+        SDL_MixAudio_S32 = SDL_MixAudio_S32_##fntype; \
+        SDL_MixAudio_F32 = SDL_MixAudio_F32_##fntype
+
+#if HAVE_SSE2_INTRINSICS
+    if (SDL_HasSSE2()) {
+        SET_MIXER_FUNCS(SSE2);
+    }
+#endif
+#if HAVE_NEON_INTRINSICS
+    if (SDL_HasNEON()) {
+        SET_MIXER_FUNCS(NEON);
+    }
+#endif
+#if HAVE_ALTIVEC_INTRINSICS
+    if (SDL_HasAltiVec()) {
+        SET_MIXER_FUNCS(AltiVec);
+    }
+#endif
+
+#undef SET_MIXER_FUNCS
+
+    mixers_chosen = SDL_TRUE;
+}
+
+/* Runs a vector mixer, if there is one, over the start of the buffer */
+#define MIX_VECTORS(mixer, samplesize) \
+    if (mixer) { \
+        const Uint32 mixed = mixer(dst, src, len, volume); \
+        dst += mixed * (samplesize); \
+        src += mixed * (samplesize); \
+        len -= mixed; \
+    }
+
 void
 SDL_MixAudioFormat(Uint8 * dst, const Uint8 * src, SDL_AudioFormat format,
                    Uint32 len, int volume)
@@ -94,6 +445,8 @@ SDL_MixAudioFormat(Uint8 * dst, const Uint8 * src, SDL_AudioFormat format,
         return;
     }
 
+    SDL_ChooseMixers();
+
     switch (format) {
 
     case AUDIO_U8:
@@ -124,6 +477,7 @@ SDL_MixAudioFormat(Uint8 * dst, const Uint8 * src, SDL_AudioFormat format,
             const int max_audioval = ((1 << (8 - 1)) - 1);
             const int min_audioval = -(1 << (8 - 1));
 
+            MIX_VECTORS(SDL_MixAudio_S8, 1);
             src8 = (Sint8 *) src;
             dst8 = (Sint8 *) dst;
             while (len--) {
@@ -151,6 +505,9 @@ SDL_MixAudioFormat(Uint8 * dst, const Uint8 * src, SDL_AudioFormat format,
             const int min_audioval = -(1 << (16 - 1));
 
             len /= 2;
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+            MIX_VECTORS(SDL_MixAudio_S16, 2);
+#endif
             while (len--) {
                 src1 = ((src[1]) << 8 | src[0]);
                 ADJUST_VOLUME(src1, volume);
@@ -182,6 +539,9 @@ SDL_MixAudioFormat(Uint8 * dst, const Uint8 * src, SDL_AudioFormat format,
             const int min_audioval = -(1 << (16 - 1));
 
             len /= 2;
+#if SDL_BYTEORDER == SDL_BIG_ENDIAN
+            MIX_VECTORS(SDL_MixAudio_S16, 2);
+#endif
             while (len--) {
                 src1 = ((src[0]) << 8 | src[1]);
                 ADJUST_VOLUME(src1, volume);
@@ -260,6 +620,11 @@ SDL_MixAudioFormat(Uint8 * dst, const Uint8 * src, SDL_AudioFormat format,
             const Sint64 min_audioval = -(((Sint64) 1) << (32 - 1));
 
             len /= 4;
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+            MIX_VECTORS(SDL_MixAudio_S32, 4);
+            src32 = (const Uint32 *) src;
+            dst32 = (Uint32 *) dst;
+#endif
             while (len--) {
                 src1 = (Sint64) ((Sint32) SDL_SwapLE32(*src32));
                 src32++;
@@ -286,6 +651,11 @@ SDL_MixAudioFormat(Uint8 * dst, const Uint8 * src, SDL_AudioFormat format,
             const Sint64 min_audioval = -(((Sint64) 1) << (32 - 1));
 
             len /= 4;
+#if SDL_BYTEORDER == SDL_BIG_ENDIAN
+            MIX_VECTORS(SDL_MixAudio_S32, 4);
+            src32 = (const Uint32 *) src;
+            dst32 = (Uint32 *) dst;
+#endif
             while (len--) {
                 src1 = (Sint64) ((Sint32) SDL_SwapBE32(*src32));
                 src32++;
@@ -315,6 +685,11 @@ SDL_MixAudioFormat(Uint8 * dst, const Uint8 * src, SDL_AudioFormat format,
             const double min_audioval = -3.402823466e+38F;
 
             len /= 4;
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+            MIX_VECTORS(SDL_MixAudio_F32, 4);
+            src32 = (const float *) src;
+            dst32 = (float *) dst;
+#endif
             while (len--) {
                 src1 = ((SDL_SwapFloatLE(*src32) * fvolume) * fmaxvolume);
                 src2 = SDL_SwapFloatLE(*dst32);
@@ -344,6 +719,11 @@ SDL_MixAudioFormat(Uint8 * dst, const Uint8 * src, SDL_AudioFormat format,
             const double min_audioval = -3.402823466e+38F;
 
             len /= 4;
+#if SDL_BYTEORDER == SDL_BIG_ENDIAN
+            MIX_VECTORS(SDL_MixAudio_F32, 4);
+            src32 = (const float *) src;
+            dst32 = (float *) dst;
+#endif
             while (len--) {
                 src1 = ((SDL_SwapFloatBE(*src32) * fvolume) * fmaxvolume);
                 src2 = SDL_SwapFloatBE(*dst32);
@@ -366,4 +746,6 @@ SDL_MixAudioFormat(Uint8 * dst, const Uint8 * src, SDL_AudioFormat format,
     }
 }
 
+#undef MIX_VECTORS
+
 /* vi: set ts=4 sw=4 expandtab: */
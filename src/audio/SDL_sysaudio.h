@@ -25,7 +25,7 @@
 
 #include "SDL_mutex.h"
 #include "SDL_thread.h"
-#include "../SDL_dataqueue.h"
+#include "./SDL_audioring.h"
 #include "./SDL_audio_c.h"
 
 /* !!! FIXME: These are wordy and unlocalized... */
@@ -160,8 +160,22 @@ struct SDL_AudioDevice
     SDL_Thread *thread;
     SDL_threadID threadid;
 
-    /* Queued buffers (if app not using callback). */
-    SDL_DataQueue *buffer_queue;
+    /* Queued buffers (if app not using callback). The app is one end of the
+       ring and the audio thread the other, so neither takes mixer_lock for
+       it; queue_lock only keeps app threads from using their end at once. */
+    SDL_AudioRing *buffer_queue;
+    SDL_mutex *queue_lock;
+
+    /* Streams mixed in with the queued buffers, see SDL_BindAudioStream(). */
+    SDL_AudioStream **bound_streams;
+    int num_bound_streams;
+
+    /* Float mixing space for bound streams: mix_samples to sum into, then as
+       many again to pull each stream into. mix_cvt converts the sum to the
+       callback's format. */
+    float *mix_buffer;
+    int mix_samples;
+    SDL_AudioCVT mix_cvt;
 
     /* * * */
     /* Data private to this driver */
@@ -647,3 +647,17 @@
 #define SDL_AudioStreamAvailable SDL_AudioStreamAvailable_REAL
 #define SDL_FreeAudioStream SDL_FreeAudioStream_REAL
 #define SDL_AudioStreamFlush SDL_AudioStreamFlush_REAL
+#define SDL_RenderFlush SDL_RenderFlush_REAL
+#define SDL_RenderGeometry SDL_RenderGeometry_REAL
+#define SDL_RenderCopyBatch SDL_RenderCopyBatch_REAL
+#define SDL_SoftStretchLinear SDL_SoftStretchLinear_REAL
+#define SDL_RenderGetStats SDL_RenderGetStats_REAL
+#define SDL_SetYUVConversionMode SDL_SetYUVConversionMode_REAL
+#define SDL_GetYUVConversionMode SDL_GetYUVConversionMode_REAL
+#define SDL_GetYUVConversionModeForResolution SDL_GetYUVConversionModeForResolution_REAL
+#define SDL_AudioStreamSetResampleQuality SDL_AudioStreamSetResampleQuality_REAL
+#define SDL_AudioStreamGetResampleQuality SDL_AudioStreamGetResampleQuality_REAL
+#define SDL_AudioStreamSetGain SDL_AudioStreamSetGain_REAL
+#define SDL_AudioStreamGetGain SDL_AudioStreamGetGain_REAL
+#define SDL_BindAudioStream SDL_BindAudioStream_REAL
+#define SDL_UnbindAudioStream SDL_UnbindAudioStream_REAL
@@ -27,6 +27,7 @@
 #include "SDL_log.h"
 #include "SDL_render.h"
 #include "SDL_sysrender.h"
+#include "SDL_timer.h"
 #include "software/SDL_render_sw_c.h"
 
 
@@ -46,6 +47,14 @@
         return retval; \
     }
 
+/* Calls into the render backend, adding the time spent to the frame statistics */
+#define TIMED_BACKEND_CALL(renderer, call) \
+    { \
+        const Uint64 backend_start = SDL_GetPerformanceCounter(); \
+        call; \
+        renderer->backend_ticks += SDL_GetPerformanceCounter() - backend_start; \
+    }
+
 /* Predefined blend modes */
 #define SDL_COMPOSE_BLENDMODE(srcColorFactor, dstColorFactor, colorOperation, \
                               srcAlphaFactor, dstAlphaFactor, alphaOperation) \
@@ -107,6 +116,541 @@ static char texture_magic;
 
 static int UpdateLogicalSize(SDL_Renderer *renderer);
 
+static SDL_RenderCommand *
+AllocateRenderCommand(SDL_Renderer *renderer)
+{
+    SDL_RenderCommand *cmd;
+
+    if (renderer->render_command_count == renderer->render_command_allocation) {
+        int newalloc = renderer->render_command_allocation ? renderer->render_command_allocation * 2 : 128;
+        SDL_RenderCommand *ptr = (SDL_RenderCommand *) SDL_realloc(renderer->render_commands, newalloc * sizeof(*ptr));
+        if (!ptr) {
+            SDL_OutOfMemory();
+            return NULL;
+        }
+        renderer->render_commands = ptr;
+        renderer->render_command_allocation = newalloc;
+    }
+
+    cmd = &renderer->render_commands[renderer->render_command_count++];
+    SDL_zerop(cmd);
+    cmd->r = renderer->r;
+    cmd->g = renderer->g;
+    cmd->b = renderer->b;
+    cmd->a = renderer->a;
+    cmd->blendMode = renderer->blendMode;
+    return cmd;
+}
+
+static void *
+AllocateVertexData(SDL_Renderer *renderer, size_t numbytes, size_t *first)
+{
+    void *ptr;
+
+    if (renderer->vertex_data_used + numbytes > renderer->vertex_data_allocation) {
+        size_t newalloc = renderer->vertex_data_allocation ? renderer->vertex_data_allocation : 4096;
+
+        while (newalloc < renderer->vertex_data_used + numbytes) {
+            newalloc *= 2;
+        }
+        ptr = SDL_realloc(renderer->vertex_data, newalloc);
+        if (!ptr) {
+            SDL_OutOfMemory();
+            return NULL;
+        }
+        renderer->vertex_data = ptr;
+        renderer->vertex_data_allocation = newalloc;
+    }
+
+    *first = renderer->vertex_data_used;
+    ptr = (Uint8 *) renderer->vertex_data + renderer->vertex_data_used;
+    renderer->vertex_data_used += numbytes;
+    return ptr;
+}
+
+static SDL_bool
+QueueVertexData(SDL_Renderer *renderer, SDL_RenderCommand *cmd, const void *data, size_t numbytes)
+{
+    void *ptr = AllocateVertexData(renderer, numbytes, &cmd->first);
+
+    if (!ptr) {
+        return SDL_FALSE;
+    }
+    SDL_memcpy(ptr, data, numbytes);
+    return SDL_TRUE;
+}
+
+static void
+CountDrawCall(SDL_Renderer *renderer, double pixels, SDL_BlendMode blendMode)
+{
+    renderer->stats.draw_calls++;
+    if (blendMode == SDL_BLENDMODE_NONE) {
+        renderer->stats.pixels_filled += (Uint64) pixels;
+    } else {
+        renderer->stats.pixels_blended += (Uint64) pixels;
+    }
+}
+
+static double
+GetRectsArea(const SDL_FRect *rects, int count)
+{
+    double area = 0.0;
+    int i;
+
+    for (i = 0; i < count; ++i) {
+        area += (double) rects[i].w * rects[i].h;
+    }
+    return area;
+}
+
+static double
+GetLinesLength(const SDL_FPoint *points, int count)
+{
+    double length = 0.0;
+    int i;
+
+    for (i = 1; i < count; ++i) {
+        length += SDL_max(SDL_fabs(points[i].x - points[i-1].x), SDL_fabs(points[i].y - points[i-1].y)) + 1.0;
+    }
+    return length;
+}
+
+static double
+GetTrianglesArea(const SDL_Vertex *vertices, int num_vertices, const int *indices, int num_indices)
+{
+    const int count = indices ? num_indices : num_vertices;
+    double area = 0.0;
+    int i;
+
+    for (i = 0; i + 3 <= count; i += 3) {
+        const SDL_FPoint *a = &vertices[indices ? indices[i] : i].position;
+        const SDL_FPoint *b = &vertices[indices ? indices[i + 1] : i + 1].position;
+        const SDL_FPoint *c = &vertices[indices ? indices[i + 2] : i + 2].position;
+
+        area += SDL_fabs((double) (b->x - a->x) * (c->y - a->y) - (double) (c->x - a->x) * (b->y - a->y)) / 2.0;
+    }
+    return area;
+}
+
+static double
+GetClearArea(SDL_Renderer *renderer)
+{
+    int w = 0, h = 0;
+
+    SDL_GetRendererOutputSize(renderer, &w, &h);
+    return (double) w * h;
+}
+
+static void
+CountTextureUpload(SDL_Renderer *renderer, SDL_Texture *texture, const SDL_Rect *rect)
+{
+    Uint64 bytes = (Uint64) rect->w * rect->h * SDL_BYTESPERPIXEL(texture->format);
+
+    switch (texture->format) {
+    case SDL_PIXELFORMAT_YV12:
+    case SDL_PIXELFORMAT_IYUV:
+    case SDL_PIXELFORMAT_NV12:
+    case SDL_PIXELFORMAT_NV21:
+        /* The chroma planes add half of the luma plane */
+        bytes += bytes / 2;
+        break;
+    default:
+        break;
+    }
+    renderer->stats.texture_uploads++;
+    renderer->stats.upload_bytes += bytes;
+}
+
+static void
+SetBatchModulation(SDL_Renderer *renderer, SDL_Texture *texture, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+    if (r < 255 || g < 255 || b < 255) {
+        texture->modMode |= SDL_TEXTUREMODULATE_COLOR;
+    } else {
+        texture->modMode &= ~SDL_TEXTUREMODULATE_COLOR;
+    }
+    if (a < 255) {
+        texture->modMode |= SDL_TEXTUREMODULATE_ALPHA;
+    } else {
+        texture->modMode &= ~SDL_TEXTUREMODULATE_ALPHA;
+    }
+    if (r != texture->r || g != texture->g || b != texture->b) {
+        texture->r = r;
+        texture->g = g;
+        texture->b = b;
+        if (renderer->SetTextureColorMod) {
+            renderer->SetTextureColorMod(renderer, texture);
+        }
+    }
+    if (a != texture->a) {
+        texture->a = a;
+        if (renderer->SetTextureAlphaMod) {
+            renderer->SetTextureAlphaMod(renderer, texture);
+        }
+    }
+}
+
+int
+SDL_RenderCopyBatchFallback(SDL_Renderer *renderer, SDL_Texture *texture,
+                            const SDL_Rect *srcrects, const SDL_FRect *dstrects,
+                            const SDL_Color *colors, int count)
+{
+    const Uint8 r = texture->r, g = texture->g, b = texture->b, a = texture->a;
+    int i;
+    int retval = 0;
+
+    for (i = 0; i < count; ++i) {
+        if (colors) {
+            /* The texture modulation is multiplied by the color of each copy */
+            SetBatchModulation(renderer, texture,
+                               (Uint8) ((r * colors[i].r) / 255), (Uint8) ((g * colors[i].g) / 255),
+                               (Uint8) ((b * colors[i].b) / 255), (Uint8) ((a * colors[i].a) / 255));
+        }
+        if (renderer->RenderCopy(renderer, texture, &srcrects[i], &dstrects[i]) < 0) {
+            retval = -1;
+        }
+    }
+    if (colors) {
+        SetBatchModulation(renderer, texture, r, g, b, a);
+    }
+    return retval;
+}
+
+static int
+RunCopyBatch(SDL_Renderer *renderer, SDL_Texture *texture, const SDL_Rect *srcrects,
+             const SDL_FRect *dstrects, const SDL_Color *colors, int count)
+{
+    if (renderer->RenderCopyBatch) {
+        return renderer->RenderCopyBatch(renderer, texture, srcrects, dstrects, colors, count);
+    }
+    return SDL_RenderCopyBatchFallback(renderer, texture, srcrects, dstrects, colors, count);
+}
+
+int
+SDL_RunRenderCommand(SDL_Renderer *renderer, const SDL_RenderCommand *cmd, const void *vertices)
+{
+    const void *data = (const Uint8 *) vertices + cmd->first;
+
+    /* The backends pick up the draw state from the renderer */
+    renderer->r = cmd->r;
+    renderer->g = cmd->g;
+    renderer->b = cmd->b;
+    renderer->a = cmd->a;
+    renderer->blendMode = cmd->blendMode;
+
+    switch (cmd->command) {
+    case SDL_RENDERCMD_CLEAR:
+        return renderer->RenderClear(renderer);
+    case SDL_RENDERCMD_DRAW_POINTS:
+        return renderer->RenderDrawPoints(renderer, (const SDL_FPoint *) data, cmd->count);
+    case SDL_RENDERCMD_DRAW_LINES:
+        return renderer->RenderDrawLines(renderer, (const SDL_FPoint *) data, cmd->count);
+    case SDL_RENDERCMD_FILL_RECTS:
+        return renderer->RenderFillRects(renderer, (const SDL_FRect *) data, cmd->count);
+    case SDL_RENDERCMD_COPY:
+        return renderer->RenderCopy(renderer, cmd->texture, &cmd->srcrect, &cmd->dstrect);
+    case SDL_RENDERCMD_COPY_EX:
+        return renderer->RenderCopyEx(renderer, cmd->texture, &cmd->srcrect, &cmd->dstrect,
+                                      cmd->angle, &cmd->center, cmd->flip);
+    case SDL_RENDERCMD_GEOMETRY:
+        return renderer->RenderGeometry(renderer, cmd->texture, (const SDL_Vertex *) data, cmd->count,
+                                        cmd->num_indices ? (const int *) ((const SDL_Vertex *) data + cmd->count) : NULL,
+                                        cmd->num_indices);
+    case SDL_RENDERCMD_COPY_BATCH:
+        {
+            const SDL_Rect *srcrects = (const SDL_Rect *) data;
+            const SDL_FRect *dstrects = (const SDL_FRect *) (srcrects + cmd->count);
+            const SDL_Color *colors = cmd->colors ? (const SDL_Color *) (dstrects + cmd->count) : NULL;
+
+            return RunCopyBatch(renderer, cmd->texture, srcrects, dstrects, colors, cmd->count);
+        }
+    }
+    return SDL_SetError("Unknown render command");
+}
+
+static int
+FlushRenderCommands(SDL_Renderer *renderer)
+{
+    Uint8 r, g, b, a;
+    SDL_BlendMode blendMode;
+    Uint64 start;
+    int retval = 0;
+
+    if (!renderer->render_command_count) {
+        return 0;
+    }
+
+    r = renderer->r;
+    g = renderer->g;
+    b = renderer->b;
+    a = renderer->a;
+    blendMode = renderer->blendMode;
+
+    start = SDL_GetPerformanceCounter();
+    if (renderer->RunCommandQueue) {
+        retval = renderer->RunCommandQueue(renderer, renderer->render_commands,
+                                           renderer->render_command_count,
+                                           renderer->vertex_data);
+    } else {
+        int i;
+
+        for (i = 0; i < renderer->render_command_count; ++i) {
+            if (SDL_RunRenderCommand(renderer, &renderer->render_commands[i], renderer->vertex_data) < 0) {
+                retval = -1;
+            }
+        }
+    }
+    renderer->backend_ticks += SDL_GetPerformanceCounter() - start;
+
+    renderer->r = r;
+    renderer->g = g;
+    renderer->b = b;
+    renderer->a = a;
+    renderer->blendMode = blendMode;
+
+    renderer->render_command_count = 0;
+    renderer->vertex_data_used = 0;
+
+    return retval;
+}
+
+static int
+QueueCmdClear(SDL_Renderer *renderer)
+{
+    SDL_RenderCommand *cmd;
+
+    CountDrawCall(renderer, GetClearArea(renderer), SDL_BLENDMODE_NONE);
+
+    if (!renderer->batching) {
+        int retval;
+
+        TIMED_BACKEND_CALL(renderer, retval = renderer->RenderClear(renderer));
+        return retval;
+    }
+
+    cmd = AllocateRenderCommand(renderer);
+    if (!cmd) {
+        return -1;
+    }
+    cmd->command = SDL_RENDERCMD_CLEAR;
+    return 0;
+}
+
+static int
+QueueCmdDrawPoints(SDL_Renderer *renderer, const SDL_FPoint *points, int count)
+{
+    SDL_RenderCommand *cmd;
+
+    CountDrawCall(renderer, count, renderer->blendMode);
+
+    if (!renderer->batching) {
+        int retval;
+
+        TIMED_BACKEND_CALL(renderer, retval = renderer->RenderDrawPoints(renderer, points, count));
+        return retval;
+    }
+
+    cmd = AllocateRenderCommand(renderer);
+    if (!cmd) {
+        return -1;
+    }
+    cmd->command = SDL_RENDERCMD_DRAW_POINTS;
+    cmd->count = count;
+    if (!QueueVertexData(renderer, cmd, points, count * sizeof(*points))) {
+        --renderer->render_command_count;
+        return -1;
+    }
+    return 0;
+}
+
+static int
+QueueCmdDrawLines(SDL_Renderer *renderer, const SDL_FPoint *points, int count)
+{
+    SDL_RenderCommand *cmd;
+
+    CountDrawCall(renderer, GetLinesLength(points, count), renderer->blendMode);
+
+    if (!renderer->batching) {
+        int retval;
+
+        TIMED_BACKEND_CALL(renderer, retval = renderer->RenderDrawLines(renderer, points, count));
+        return retval;
+    }
+
+    cmd = AllocateRenderCommand(renderer);
+    if (!cmd) {
+        return -1;
+    }
+    cmd->command = SDL_RENDERCMD_DRAW_LINES;
+    cmd->count = count;
+    if (!QueueVertexData(renderer, cmd, points, count * sizeof(*points))) {
+        --renderer->render_command_count;
+        return -1;
+    }
+    return 0;
+}
+
+static int
+QueueCmdFillRects(SDL_Renderer *renderer, const SDL_FRect *rects, int count)
+{
+    SDL_RenderCommand *cmd;
+
+    CountDrawCall(renderer, GetRectsArea(rects, count), renderer->blendMode);
+
+    if (!renderer->batching) {
+        int retval;
+
+        TIMED_BACKEND_CALL(renderer, retval = renderer->RenderFillRects(renderer, rects, count));
+        return retval;
+    }
+    if (count < 1) {
+        return 0;
+    }
+
+    cmd = AllocateRenderCommand(renderer);
+    if (!cmd) {
+        return -1;
+    }
+    cmd->command = SDL_RENDERCMD_FILL_RECTS;
+    cmd->count = count;
+    if (!QueueVertexData(renderer, cmd, rects, count * sizeof(*rects))) {
+        --renderer->render_command_count;
+        return -1;
+    }
+    return 0;
+}
+
+static int
+QueueCmdCopy(SDL_Renderer *renderer, SDL_Texture *texture,
+             const SDL_Rect *srcrect, const SDL_FRect *dstrect)
+{
+    SDL_RenderCommand *cmd;
+
+    CountDrawCall(renderer, GetRectsArea(dstrect, 1), texture->blendMode);
+
+    if (!renderer->batching) {
+        int retval;
+
+        TIMED_BACKEND_CALL(renderer, retval = renderer->RenderCopy(renderer, texture, srcrect, dstrect));
+        return retval;
+    }
+
+    cmd = AllocateRenderCommand(renderer);
+    if (!cmd) {
+        return -1;
+    }
+    cmd->command = SDL_RENDERCMD_COPY;
+    cmd->texture = texture;
+    cmd->srcrect = *srcrect;
+    cmd->dstrect = *dstrect;
+    return 0;
+}
+
+static int
+QueueCmdCopyEx(SDL_Renderer *renderer, SDL_Texture *texture,
+               const SDL_Rect *srcrect, const SDL_FRect *dstrect,
+               const double angle, const SDL_FPoint *center, const SDL_RendererFlip flip)
+{
+    SDL_RenderCommand *cmd;
+
+    CountDrawCall(renderer, GetRectsArea(dstrect, 1), texture->blendMode);
+
+    if (!renderer->batching) {
+        int retval;
+
+        TIMED_BACKEND_CALL(renderer, retval = renderer->RenderCopyEx(renderer, texture, srcrect, dstrect, angle, center, flip));
+        return retval;
+    }
+
+    cmd = AllocateRenderCommand(renderer);
+    if (!cmd) {
+        return -1;
+    }
+    cmd->command = SDL_RENDERCMD_COPY_EX;
+    cmd->texture = texture;
+    cmd->srcrect = *srcrect;
+    cmd->dstrect = *dstrect;
+    cmd->angle = angle;
+    cmd->center = *center;
+    cmd->flip = flip;
+    return 0;
+}
+
+static int
+QueueCmdGeometry(SDL_Renderer *renderer, SDL_Texture *texture,
+                 const SDL_Vertex *vertices, int num_vertices,
+                 const int *indices, int num_indices)
+{
+    SDL_RenderCommand *cmd;
+    size_t first;
+
+    CountDrawCall(renderer, GetTrianglesArea(vertices, num_vertices, indices, num_indices),
+                  texture ? texture->blendMode : renderer->blendMode);
+
+    if (!renderer->batching) {
+        int retval;
+
+        TIMED_BACKEND_CALL(renderer, retval = renderer->RenderGeometry(renderer, texture, vertices, num_vertices, indices, num_indices));
+        return retval;
+    }
+
+    cmd = AllocateRenderCommand(renderer);
+    if (!cmd) {
+        return -1;
+    }
+    cmd->command = SDL_RENDERCMD_GEOMETRY;
+    cmd->texture = texture;
+    cmd->count = num_vertices;
+    if (!QueueVertexData(renderer, cmd, vertices, num_vertices * sizeof(*vertices))) {
+        --renderer->render_command_count;
+        return -1;
+    }
+    if (indices) {
+        first = cmd->first;
+        if (!QueueVertexData(renderer, cmd, indices, num_indices * sizeof(*indices))) {
+            renderer->vertex_data_used = first;
+            --renderer->render_command_count;
+            return -1;
+        }
+        cmd->first = first;
+        cmd->num_indices = num_indices;
+    }
+    return 0;
+}
+
+/* The rects and colors were already placed in the vertex data at 'first' */
+static int
+QueueCmdCopyBatch(SDL_Renderer *renderer, SDL_Texture *texture,
+                  size_t first, int count, SDL_bool colors)
+{
+    const SDL_Rect *srcrects = (const SDL_Rect *) ((Uint8 *) renderer->vertex_data + first);
+    const SDL_FRect *dstrects = (const SDL_FRect *) (srcrects + count);
+    SDL_RenderCommand *cmd;
+
+    CountDrawCall(renderer, GetRectsArea(dstrects, count), texture->blendMode);
+
+    if (!renderer->batching) {
+        int retval;
+
+        TIMED_BACKEND_CALL(renderer, retval = RunCopyBatch(renderer, texture, srcrects, dstrects,
+                                                           colors ? (const SDL_Color *) (dstrects + count) : NULL, count));
+        renderer->vertex_data_used = first;
+        return retval;
+    }
+
+    cmd = AllocateRenderCommand(renderer);
+    if (!cmd) {
+        renderer->vertex_data_used = first;
+        return -1;
+    }
+    cmd->command = SDL_RENDERCMD_COPY_BATCH;
+    cmd->texture = texture;
+    cmd->first = first;
+    cmd->count = count;
+    cmd->colors = colors;
+    return 0;
+}
+
 int
 SDL_GetNumRenderDrivers(void)
 {
@@ -140,6 +684,11 @@ SDL_RendererEventWatch(void *userdata, SDL_Event *event)
     if (event->type == SDL_WINDOWEVENT) {
         SDL_Window *window = SDL_GetWindowFromID(event->window.windowID);
         if (window == renderer->window) {
+            if (event->window.event == SDL_WINDOWEVENT_SIZE_CHANGED) {
+                /* Queued commands belong to the old output size */
+                FlushRenderCommands(renderer);
+            }
+
             if (renderer->WindowEvent) {
                 renderer->WindowEvent(renderer, &event->window);
             }
@@ -349,6 +898,10 @@ SDL_CreateRenderer(SDL_Window * window, int index, Uint32 flags)
         renderer->scale.y = 1.0f;
         renderer->dpi_scale.x = 1.0f;
         renderer->dpi_scale.y = 1.0f;
+        /* The backend may have turned batching on already */
+        if (SDL_GetHintBoolean(SDL_HINT_RENDER_BATCHING, SDL_FALSE)) {
+            renderer->batching = SDL_TRUE;
+        }
 
         if (window && renderer->GetOutputSize) {
             int window_w, window_h;
@@ -394,6 +947,10 @@ SDL_CreateSoftwareRenderer(SDL_Surface * surface)
         renderer->magic = &renderer_magic;
         renderer->scale.x = 1.0f;
         renderer->scale.y = 1.0f;
+        /* The backend may have turned batching on already */
+        if (SDL_GetHintBoolean(SDL_HINT_RENDER_BATCHING, SDL_FALSE)) {
+            renderer->batching = SDL_TRUE;
+        }
 
         SDL_RenderSetViewport(renderer, NULL);
     }
@@ -704,6 +1261,7 @@ SDL_SetTextureColorMod(SDL_Texture * texture, Uint8 r, Uint8 g, Uint8 b)
     CHECK_TEXTURE_MAGIC(texture, -1);
 
     renderer = texture->renderer;
+    FlushRenderCommands(renderer);
     if (r < 255 || g < 255 || b < 255) {
         texture->modMode |= SDL_TEXTUREMODULATE_COLOR;
     } else {
@@ -747,6 +1305,7 @@ SDL_SetTextureAlphaMod(SDL_Texture * texture, Uint8 alpha)
     CHECK_TEXTURE_MAGIC(texture, -1);
 
     renderer = texture->renderer;
+    FlushRenderCommands(renderer);
     if (alpha < 255) {
         texture->modMode |= SDL_TEXTUREMODULATE_ALPHA;
     } else {
@@ -784,6 +1343,7 @@ SDL_SetTextureBlendMode(SDL_Texture * texture, SDL_BlendMode blendMode)
     if (!IsSupportedBlendMode(renderer, blendMode)) {
         return SDL_Unsupported();
     }
+    FlushRenderCommands(renderer);
     texture->blendMode = blendMode;
     if (texture->native) {
         return SDL_SetTextureBlendMode(texture->native, blendMode);
@@ -918,13 +1478,21 @@ SDL_UpdateTexture(SDL_Texture * texture, const SDL_Rect * rect,
 
     if ((rect->w == 0) || (rect->h == 0)) {
         return 0;  /* nothing to do. */
-    } else if (texture->yuv) {
+    }
+
+    FlushRenderCommands(texture->renderer);
+
+    if (texture->yuv) {
         return SDL_UpdateTextureYUV(texture, rect, pixels, pitch);
     } else if (texture->native) {
         return SDL_UpdateTextureNative(texture, rect, pixels, pitch);
     } else {
+        int retval;
+
         renderer = texture->renderer;
-        return renderer->UpdateTexture(renderer, texture, rect, pixels, pitch);
+        CountTextureUpload(renderer, texture, rect);
+        TIMED_BACKEND_CALL(renderer, retval = renderer->UpdateTexture(renderer, texture, rect, pixels, pitch));
+        return retval;
     }
 }
 
@@ -1026,6 +1594,8 @@ int SDL_UpdateYUVTexture(SDL_Texture * texture, const SDL_Rect * rect,
         return 0;  /* nothing to do. */
     }
 
+    FlushRenderCommands(texture->renderer);
+
     if (texture->yuv) {
         return SDL_UpdateTextureYUVPlanar(texture, rect, Yplane, Ypitch, Uplane, Upitch, Vplane, Vpitch);
     } else {
@@ -1033,7 +1603,11 @@ int SDL_UpdateYUVTexture(SDL_Texture * texture, const SDL_Rect * rect,
         renderer = texture->renderer;
         SDL_assert(renderer->UpdateTextureYUV);
         if (renderer->UpdateTextureYUV) {
-            return renderer->UpdateTextureYUV(renderer, texture, rect, Yplane, Ypitch, Uplane, Upitch, Vplane, Vpitch);
+            int retval;
+
+            CountTextureUpload(renderer, texture, rect);
+            TIMED_BACKEND_CALL(renderer, retval = renderer->UpdateTextureYUV(renderer, texture, rect, Yplane, Ypitch, Uplane, Upitch, Vplane, Vpitch));
+            return retval;
         } else {
             return SDL_Unsupported();
         }
@@ -1080,12 +1654,15 @@ SDL_LockTexture(SDL_Texture * texture, const SDL_Rect * rect,
         rect = &full_rect;
     }
 
+    FlushRenderCommands(texture->renderer);
+
     if (texture->yuv) {
         return SDL_LockTextureYUV(texture, rect, pixels, pitch);
     } else if (texture->native) {
         return SDL_LockTextureNative(texture, rect, pixels, pitch);
     } else {
         renderer = texture->renderer;
+        texture->locked_rect = *rect;
         return renderer->LockTexture(renderer, texture, rect, pixels, pitch);
     }
 }
@@ -1148,7 +1725,8 @@ SDL_UnlockTexture(SDL_Texture * texture)
         SDL_UnlockTextureNative(texture);
     } else {
         renderer = texture->renderer;
-        renderer->UnlockTexture(renderer, texture);
+        CountTextureUpload(renderer, texture, &texture->locked_rect);
+        TIMED_BACKEND_CALL(renderer, renderer->UnlockTexture(renderer, texture));
     }
 }
 
@@ -1172,6 +1750,8 @@ SDL_SetRenderTarget(SDL_Renderer *renderer, SDL_Texture *texture)
         return 0;
     }
 
+    FlushRenderCommands(renderer);
+
     /* texture == NULL is valid and means reset the target to the window */
     if (texture) {
         CHECK_TEXTURE_MAGIC(texture, -1);
@@ -1402,6 +1982,8 @@ SDL_RenderSetViewport(SDL_Renderer * renderer, const SDL_Rect * rect)
 {
     CHECK_RENDERER_MAGIC(renderer, -1);
 
+    FlushRenderCommands(renderer);
+
     if (rect) {
         renderer->viewport.x = (int)SDL_floor(rect->x * renderer->scale.x);
         renderer->viewport.y = (int)SDL_floor(rect->y * renderer->scale.y);
@@ -1435,6 +2017,8 @@ SDL_RenderSetClipRect(SDL_Renderer * renderer, const SDL_Rect * rect)
 {
     CHECK_RENDERER_MAGIC(renderer, -1)
 
+    FlushRenderCommands(renderer);
+
     if (rect) {
         renderer->clipping_enabled = SDL_TRUE;
         renderer->clip_rect.x = (int)SDL_floor(rect->x * renderer->scale.x);
@@ -1555,7 +2139,7 @@ SDL_RenderClear(SDL_Renderer * renderer)
     if (renderer->hidden) {
         return 0;
     }
-    return renderer->RenderClear(renderer);
+    return QueueCmdClear(renderer);
 }
 
 int
@@ -1587,7 +2171,7 @@ RenderDrawPointsWithRects(SDL_Renderer * renderer,
         frects[i].h = renderer->scale.y;
     }
 
-    status = renderer->RenderFillRects(renderer, frects, count);
+    status = QueueCmdFillRects(renderer, frects, count);
 
     SDL_stack_free(frects);
 
@@ -1629,7 +2213,7 @@ SDL_RenderDrawPoints(SDL_Renderer * renderer,
         fpoints[i].y = points[i].y * renderer->scale.y;
     }
 
-    status = renderer->RenderDrawPoints(renderer, fpoints, count);
+    status = QueueCmdDrawPoints(renderer, fpoints, count);
 
     SDL_stack_free(fpoints);
 
@@ -1690,11 +2274,11 @@ RenderDrawLinesWithRects(SDL_Renderer * renderer,
             fpoints[0].y = points[i].y * renderer->scale.y;
             fpoints[1].x = points[i+1].x * renderer->scale.x;
             fpoints[1].y = points[i+1].y * renderer->scale.y;
-            status += renderer->RenderDrawLines(renderer, fpoints, 2);
+            status += QueueCmdDrawLines(renderer, fpoints, 2);
         }
     }
 
-    status += renderer->RenderFillRects(renderer, frects, nrects);
+    status += QueueCmdFillRects(renderer, frects, nrects);
 
     SDL_stack_free(frects);
 
@@ -1739,7 +2323,7 @@ SDL_RenderDrawLines(SDL_Renderer * renderer,
         fpoints[i].y = points[i].y * renderer->scale.y;
     }
 
-    status = renderer->RenderDrawLines(renderer, fpoints, count);
+    status = QueueCmdDrawLines(renderer, fpoints, count);
 
     SDL_stack_free(fpoints);
 
@@ -1853,7 +2437,7 @@ SDL_RenderFillRects(SDL_Renderer * renderer,
         frects[i].h = rects[i].h * renderer->scale.y;
     }
 
-    status = renderer->RenderFillRects(renderer, frects, count);
+    status = QueueCmdFillRects(renderer, frects, count);
 
     SDL_stack_free(frects);
 
@@ -1909,10 +2493,99 @@ SDL_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
     frect.w = real_dstrect.w * renderer->scale.x;
     frect.h = real_dstrect.h * renderer->scale.y;
 
-    return renderer->RenderCopy(renderer, texture, &real_srcrect, &frect);
+    return QueueCmdCopy(renderer, texture, &real_srcrect, &frect);
 }
 
 
+int
+SDL_RenderCopyBatch(SDL_Renderer * renderer, SDL_Texture * texture,
+                    const SDL_Rect * srcrects, const SDL_Rect * dstrects,
+                    const SDL_Color * colors, int count)
+{
+    SDL_Rect viewport;
+    SDL_Rect *final_srcrects;
+    SDL_FRect *final_dstrects;
+    SDL_Color *final_colors = NULL;
+    size_t first, itemsize;
+    int i, n;
+
+    CHECK_RENDERER_MAGIC(renderer, -1);
+    CHECK_TEXTURE_MAGIC(texture, -1);
+
+    if (renderer != texture->renderer) {
+        return SDL_SetError("Texture was not created with this renderer");
+    }
+    if (!dstrects) {
+        return SDL_InvalidParamError("dstrects");
+    }
+    if (count < 0) {
+        return SDL_InvalidParamError("count");
+    }
+
+    /* Don't draw while we're hidden */
+    if (renderer->hidden || count == 0) {
+        return 0;
+    }
+
+    SDL_RenderGetViewport(renderer, &viewport);
+    viewport.x = 0;
+    viewport.y = 0;
+
+    /* Build the rects right in the vertex data, the backend reads them from there */
+    itemsize = sizeof(SDL_Rect) + sizeof(SDL_FRect) + (colors ? sizeof(SDL_Color) : 0);
+    final_srcrects = (SDL_Rect *) AllocateVertexData(renderer, count * itemsize, &first);
+    if (!final_srcrects) {
+        return -1;
+    }
+    final_dstrects = (SDL_FRect *) (final_srcrects + count);
+    if (colors) {
+        final_colors = (SDL_Color *) (final_dstrects + count);
+    }
+
+    /* Same clipping as SDL_RenderCopy(), copies that draw nothing are dropped */
+    for (i = 0, n = 0; i < count; ++i) {
+        SDL_Rect *srcrect = &final_srcrects[n];
+
+        srcrect->x = 0;
+        srcrect->y = 0;
+        srcrect->w = texture->w;
+        srcrect->h = texture->h;
+        if (srcrects && !SDL_IntersectRect(&srcrects[i], srcrect, srcrect)) {
+            continue;
+        }
+        if (!SDL_HasIntersection(&dstrects[i], &viewport)) {
+            continue;
+        }
+        final_dstrects[n].x = dstrects[i].x * renderer->scale.x;
+        final_dstrects[n].y = dstrects[i].y * renderer->scale.y;
+        final_dstrects[n].w = dstrects[i].w * renderer->scale.x;
+        final_dstrects[n].h = dstrects[i].h * renderer->scale.y;
+        if (colors) {
+            final_colors[n] = colors[i];
+        }
+        ++n;
+    }
+
+    if (n == 0) {
+        renderer->vertex_data_used = first;
+        return 0;
+    }
+    if (n < count) {
+        SDL_memmove(final_srcrects + n, final_dstrects, n * sizeof(*final_dstrects));
+        final_dstrects = (SDL_FRect *) (final_srcrects + n);
+        if (colors) {
+            SDL_memmove(final_dstrects + n, final_colors, n * sizeof(*final_colors));
+        }
+        renderer->vertex_data_used = first + n * itemsize;
+    }
+
+    if (texture->native) {
+        texture = texture->native;
+    }
+
+    return QueueCmdCopyBatch(renderer, texture, first, n, colors ? SDL_TRUE : SDL_FALSE);
+}
+
 int
 SDL_RenderCopyEx(SDL_Renderer * renderer, SDL_Texture * texture,
                const SDL_Rect * srcrect, const SDL_Rect * dstrect,
@@ -1981,7 +2654,84 @@ SDL_RenderCopyEx(SDL_Renderer * renderer, SDL_Texture * texture,
     fcenter.x = real_center.x * renderer->scale.x;
     fcenter.y = real_center.y * renderer->scale.y;
 
-    return renderer->RenderCopyEx(renderer, texture, &real_srcrect, &frect, angle, &fcenter, flip);
+    return QueueCmdCopyEx(renderer, texture, &real_srcrect, &frect, angle, &fcenter, flip);
+}
+
+int
+SDL_RenderGeometry(SDL_Renderer * renderer, SDL_Texture * texture,
+                   const SDL_Vertex * vertices, int num_vertices,
+                   const int * indices, int num_indices)
+{
+    SDL_Vertex *scaled;
+    int i;
+    int status;
+
+    CHECK_RENDERER_MAGIC(renderer, -1);
+
+    if (texture) {
+        CHECK_TEXTURE_MAGIC(texture, -1);
+
+        if (renderer != texture->renderer) {
+            return SDL_SetError("Texture was not created with this renderer");
+        }
+    }
+    if (!renderer->RenderGeometry) {
+        return SDL_SetError("Renderer does not support RenderGeometry");
+    }
+
+    if (!vertices) {
+        return SDL_InvalidParamError("vertices");
+    }
+    if (indices) {
+        if (num_indices % 3) {
+            return SDL_SetError("SDL_RenderGeometry(): num_indices must be a multiple of 3");
+        }
+        for (i = 0; i < num_indices; ++i) {
+            if (indices[i] < 0 || indices[i] >= num_vertices) {
+                return SDL_SetError("SDL_RenderGeometry(): index %d is out of range", indices[i]);
+            }
+        }
+        if (num_indices < 3) {
+            return 0;
+        }
+    } else {
+        if (num_vertices % 3) {
+            return SDL_SetError("SDL_RenderGeometry(): num_vertices must be a multiple of 3");
+        }
+        num_indices = 0;
+        if (num_vertices < 3) {
+            return 0;
+        }
+    }
+
+    /* Don't draw while we're hidden */
+    if (renderer->hidden) {
+        return 0;
+    }
+
+    if (texture && texture->native) {
+        texture = texture->native;
+    }
+
+    if (renderer->scale.x == 1.0f && renderer->scale.y == 1.0f) {
+        return QueueCmdGeometry(renderer, texture, vertices, num_vertices, indices, num_indices);
+    }
+
+    scaled = (SDL_Vertex *) SDL_malloc(num_vertices * sizeof(*scaled));
+    if (!scaled) {
+        return SDL_OutOfMemory();
+    }
+    for (i = 0; i < num_vertices; ++i) {
+        scaled[i] = vertices[i];
+        scaled[i].position.x *= renderer->scale.x;
+        scaled[i].position.y *= renderer->scale.y;
+    }
+
+    status = QueueCmdGeometry(renderer, texture, scaled, num_vertices, indices, num_indices);
+
+    SDL_free(scaled);
+
+    return status;
 }
 
 int
@@ -1989,6 +2739,7 @@ SDL_RenderReadPixels(SDL_Renderer * renderer, const SDL_Rect * rect,
                      Uint32 format, void * pixels, int pitch)
 {
     SDL_Rect real_rect;
+    int status;
 
     CHECK_RENDERER_MAGIC(renderer, -1);
 
@@ -1996,6 +2747,8 @@ SDL_RenderReadPixels(SDL_Renderer * renderer, const SDL_Rect * rect,
         return SDL_Unsupported();
     }
 
+    FlushRenderCommands(renderer);
+
     if (!format) {
         format = SDL_GetWindowPixelFormat(renderer->window);
     }
@@ -2017,8 +2770,9 @@ SDL_RenderReadPixels(SDL_Renderer * renderer, const SDL_Rect * rect,
         }
     }
 
-    return renderer->RenderReadPixels(renderer, &real_rect,
-                                      format, pixels, pitch);
+    TIMED_BACKEND_CALL(renderer, status = renderer->RenderReadPixels(renderer, &real_rect,
+                                                                     format, pixels, pitch));
+    return status;
 }
 
 void
@@ -2026,11 +2780,38 @@ SDL_RenderPresent(SDL_Renderer * renderer)
 {
     CHECK_RENDERER_MAGIC(renderer, );
 
+    FlushRenderCommands(renderer);
+
     /* Don't draw while we're hidden */
-    if (renderer->hidden) {
-        return;
+    if (!renderer->hidden) {
+        TIMED_BACKEND_CALL(renderer, renderer->RenderPresent(renderer));
+    }
+
+    /* Start counting the next frame */
+    renderer->stats.backend_us = (Uint32) ((renderer->backend_ticks * 1000000) / SDL_GetPerformanceFrequency());
+    renderer->last_stats = renderer->stats;
+    SDL_zero(renderer->stats);
+    renderer->backend_ticks = 0;
+}
+
+int
+SDL_RenderGetStats(SDL_Renderer * renderer, SDL_RenderStats * stats)
+{
+    CHECK_RENDERER_MAGIC(renderer, -1);
+
+    if (!stats) {
+        return SDL_InvalidParamError("stats");
     }
-    renderer->RenderPresent(renderer);
+    *stats = renderer->last_stats;
+    return 0;
+}
+
+int
+SDL_RenderFlush(SDL_Renderer * renderer)
+{
+    CHECK_RENDERER_MAGIC(renderer, -1);
+
+    return FlushRenderCommands(renderer);
 }
 
 void
@@ -2045,6 +2826,9 @@ SDL_DestroyTexture(SDL_Texture * texture)
         SDL_SetRenderTarget(renderer, NULL);
     }
 
+    /* Queued commands may still reference this texture */
+    FlushRenderCommands(renderer);
+
     texture->magic = NULL;
 
     if (texture->next) {
@@ -2075,6 +2859,10 @@ SDL_DestroyRenderer(SDL_Renderer * renderer)
 
     SDL_DelEventWatch(SDL_RendererEventWatch, renderer);
 
+    /* Nothing queued is going to be presented anymore */
+    renderer->render_command_count = 0;
+    renderer->vertex_data_used = 0;
+
     /* Free existing textures for this renderer */
     while (renderer->textures) {
         SDL_Texture *tex = renderer->textures; (void) tex;
@@ -2089,6 +2877,9 @@ SDL_DestroyRenderer(SDL_Renderer * renderer)
     /* It's no longer magical... */
     renderer->magic = NULL;
 
+    SDL_free(renderer->render_commands);
+    SDL_free(renderer->vertex_data);
+
     /* Free the renderer instance */
     renderer->DestroyRenderer(renderer);
 }
@@ -2099,6 +2890,7 @@ int SDL_GL_BindTexture(SDL_Texture *texture, float *texw, float *texh)
 
     CHECK_TEXTURE_MAGIC(texture, -1);
     renderer = texture->renderer;
+    FlushRenderCommands(renderer);
     if (texture->native) {
         return SDL_GL_BindTexture(texture->native, texw, texh);
     } else if (renderer && renderer->GL_BindTexture) {
@@ -31,19 +31,35 @@
 
 typedef struct SDL_RenderDriver SDL_RenderDriver;
 
-typedef struct
+/* Deferred drawing commands, see SDL_HINT_RENDER_BATCHING */
+typedef enum
 {
-    float x;
-    float y;
-} SDL_FPoint;
-
-typedef struct
+    SDL_RENDERCMD_CLEAR,
+    SDL_RENDERCMD_DRAW_POINTS,
+    SDL_RENDERCMD_DRAW_LINES,
+    SDL_RENDERCMD_FILL_RECTS,
+    SDL_RENDERCMD_COPY,
+    SDL_RENDERCMD_COPY_EX,
+    SDL_RENDERCMD_GEOMETRY,
+    SDL_RENDERCMD_COPY_BATCH
+} SDL_RenderCommandType;
+
+typedef struct SDL_RenderCommand
 {
-    float x;
-    float y;
-    float w;
-    float h;
-} SDL_FRect;
+    SDL_RenderCommandType command;
+    Uint8 r, g, b, a;               /**< Draw color when the command was queued */
+    SDL_BlendMode blendMode;        /**< Draw blend mode when the command was queued */
+    SDL_Texture *texture;
+    size_t first;                   /**< Byte offset of the points, rects or vertices in the vertex data */
+    int count;                      /**< Number of points, rects, vertices or batched copies */
+    int num_indices;                /**< Number of geometry indices, stored after the vertices */
+    SDL_bool colors;                /**< Batched copies have colors, stored after the rects */
+    SDL_Rect srcrect;
+    SDL_FRect dstrect;
+    double angle;
+    SDL_FPoint center;
+    SDL_RendererFlip flip;
+} SDL_RenderCommand;
 
 /* Define the SDL texture structure */
 struct SDL_Texture
@@ -113,9 +129,17 @@ struct SDL_Renderer
     int (*RenderCopyEx) (SDL_Renderer * renderer, SDL_Texture * texture,
                        const SDL_Rect * srcquad, const SDL_FRect * dstrect,
                        const double angle, const SDL_FPoint *center, const SDL_RendererFlip flip);
+    int (*RenderGeometry) (SDL_Renderer * renderer, SDL_Texture * texture,
+                           const SDL_Vertex * vertices, int num_vertices,
+                           const int * indices, int num_indices);
+    int (*RenderCopyBatch) (SDL_Renderer * renderer, SDL_Texture * texture,
+                            const SDL_Rect * srcrects, const SDL_FRect * dstrects,
+                            const SDL_Color * colors, int count);
     int (*RenderReadPixels) (SDL_Renderer * renderer, const SDL_Rect * rect,
                              Uint32 format, void * pixels, int pitch);
     void (*RenderPresent) (SDL_Renderer * renderer);
+    int (*RunCommandQueue) (SDL_Renderer * renderer, const SDL_RenderCommand * cmds,
+                            int count, const void * vertices);
     void (*DestroyTexture) (SDL_Renderer * renderer, SDL_Texture * texture);
 
     void (*DestroyRenderer) (SDL_Renderer * renderer);
@@ -165,6 +189,20 @@ struct SDL_Renderer
     Uint8 r, g, b, a;                   /**< Color for drawing operations values */
     SDL_BlendMode blendMode;            /**< The drawing blend mode */
 
+    /* Queued drawing commands, only used when batching is enabled */
+    SDL_bool batching;
+    SDL_RenderCommand *render_commands;
+    int render_command_count;
+    int render_command_allocation;
+    void *vertex_data;
+    size_t vertex_data_used;
+    size_t vertex_data_allocation;
+
+    /* Statistics of the frame being drawn and of the last presented one */
+    SDL_RenderStats stats;
+    SDL_RenderStats last_stats;
+    Uint64 backend_ticks;
+
     void *driverdata;
 };
 
@@ -196,6 +234,16 @@ extern SDL_BlendFactor SDL_GetBlendModeSrcAlphaFactor(SDL_BlendMode blendMode);
 extern SDL_BlendFactor SDL_GetBlendModeDstAlphaFactor(SDL_BlendMode blendMode);
 extern SDL_BlendOperation SDL_GetBlendModeAlphaOperation(SDL_BlendMode blendMode);
 
+/* Execute a single queued command through the immediate backend entry points.
+   Backends implementing RunCommandQueue use this for commands they don't merge. */
+extern int SDL_RunRenderCommand(SDL_Renderer * renderer, const SDL_RenderCommand * cmd, const void * vertices);
+
+/* Draw a batch of copies with RenderCopy, for backends without RenderCopyBatch
+   or with batches they can't draw themselves */
+extern int SDL_RenderCopyBatchFallback(SDL_Renderer * renderer, SDL_Texture * texture,
+                                       const SDL_Rect * srcrects, const SDL_FRect * dstrects,
+                                       const SDL_Color * colors, int count);
+
 #endif /* SDL_sysrender_h_ */
 
 /* vi: set ts=4 sw=4 expandtab: */
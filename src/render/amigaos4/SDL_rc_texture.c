@@ -25,6 +25,8 @@
 #include "SDL_render_compositing.h"
 #include "SDL_rc_texture.h"
 
+#include "../../video/SDL_blit.h"
+
 #include <proto/graphics.h>
 
 #define DEBUG
@@ -106,31 +108,10 @@ OS4_ModulateRGB(SDL_Renderer * renderer, SDL_Texture * texture, Uint8 * src, int
             TAG_DONE);
 
         if (lock) {
-            int y;
-
-            for (y = 0; y < texture->h; y++) {
-
-                Uint32 *readaddress = (Uint32 *)(src + y * pitch);
-                Uint32 *writeaddress = (Uint32 *)(baseaddress + y * bytesperrow);
-
-                int x;
-
-                for (x = 0; x < texture->w; x++) {
-
-                    Uint32 oldcolor = readaddress[x];
-                    Uint32 newcolor = (oldcolor & 0xFF000000);
-
-                    Uint8 r = (oldcolor & 0x00FF0000) >> 16;
-                    Uint8 g = (oldcolor & 0x0000FF00) >> 8;
-                    Uint8 b = (oldcolor & 0x000000FF);
-
-                    newcolor |= ((r * texture->r) / 255) << 16;
-                    newcolor |= ((g * texture->g) / 255) << 8;
-                    newcolor |= ((b * texture->b) / 255);
-
-                    writeaddress[x] = newcolor;
-                }
-            }
+            /* Color channels only, alpha is left as is */
+            SDL_Modulate32(src, pitch, baseaddress, bytesperrow,
+                           texture->w, texture->h,
+                           0xFF000000 | (texture->r << 16) | (texture->g << 8) | texture->b);
 
             data->iGraphics->UnlockBitMap(texturedata->finalbitmap);
 
@@ -77,11 +77,18 @@ static int OS4_RenderCopyEx(SDL_Renderer * renderer, SDL_Texture * texture,
                           const SDL_Rect * srcrect, const SDL_FRect * dstrect,
                           const double angle, const SDL_FPoint * center, const SDL_RendererFlip flip);
 
+static int OS4_RenderCopyBatch(SDL_Renderer * renderer, SDL_Texture * texture,
+                              const SDL_Rect * srcrects, const SDL_FRect * dstrects,
+                              const SDL_Color * colors, int count);
+
 static int OS4_RenderReadPixels(SDL_Renderer * renderer, const SDL_Rect * rect,
                                Uint32 format, void * pixels, int pitch);
 
 static void OS4_RenderPresent(SDL_Renderer * renderer);
 
+static int OS4_RunCommandQueue(SDL_Renderer * renderer, const SDL_RenderCommand * cmds,
+                               int count, const void * vertices);
+
 static void OS4_DestroyRenderer(SDL_Renderer * renderer);
 
 SDL_RenderDriver OS4_RenderDriver = {
@@ -97,11 +104,14 @@ SDL_RenderDriver OS4_RenderDriver = {
      0}
 };
 
-typedef struct {
+typedef struct OS4_Vertex {
     float x, y;
     float s, t, w;
 } OS4_Vertex;
 
+/* Index arrays are 16-bit, so a single composite call can't address more */
+#define OS4_MAX_BATCHED_QUADS 16384
+
 static const uint16 OS4_QuadIndices[] = {
     0, 1, 2, 2, 3, 0
 };
@@ -228,8 +238,10 @@ OS4_CreateRenderer(SDL_Window * window, Uint32 flags)
     renderer->RenderFillRects = OS4_RenderFillRects;
     renderer->RenderCopy = OS4_RenderCopy;
     renderer->RenderCopyEx = OS4_RenderCopyEx;
+    renderer->RenderCopyBatch = OS4_RenderCopyBatch;
     renderer->RenderReadPixels = OS4_RenderReadPixels;
     renderer->RenderPresent = OS4_RenderPresent;
+    renderer->RunCommandQueue = OS4_RunCommandQueue;
     renderer->DestroyTexture = OS4_DestroyTexture;
     renderer->DestroyRenderer = OS4_DestroyRenderer;
     renderer->info = OS4_RenderDriver.info;
@@ -927,6 +939,211 @@ OS4_RenderPresent(SDL_Renderer * renderer)
     //dprintf("Took %d\n", SDL_GetTicks() - s);
 }
 
+static SDL_bool
+OS4_ReserveQuads(OS4_RenderData * data, int count)
+{
+    if (count > data->quad_allocation) {
+        OS4_Vertex *vertices;
+        uint16 *indices;
+        int i;
+
+        vertices = SDL_realloc(data->vertices, count * 4 * sizeof(OS4_Vertex));
+        if (!vertices) {
+            return SDL_FALSE;
+        }
+        data->vertices = vertices;
+
+        indices = SDL_realloc(data->indices, count * 6 * sizeof(uint16));
+        if (!indices) {
+            return SDL_FALSE;
+        }
+        data->indices = indices;
+
+        for (i = data->quad_allocation; i < count; ++i) {
+            int j;
+
+            for (j = 0; j < 6; ++j) {
+                indices[i * 6 + j] = i * 4 + OS4_QuadIndices[j];
+            }
+        }
+        data->quad_allocation = count;
+    }
+
+    return SDL_TRUE;
+}
+
+static void
+OS4_GetFinalRect(SDL_Renderer * renderer, const SDL_FRect * dstrect, SDL_Rect * final_rect)
+{
+    if (renderer->viewport.x || renderer->viewport.y) {
+        final_rect->x = (int)(renderer->viewport.x + dstrect->x);
+        final_rect->y = (int)(renderer->viewport.y + dstrect->y);
+    } else {
+        final_rect->x = (int)dstrect->x;
+        final_rect->y = (int)dstrect->y;
+    }
+    final_rect->w = (int)dstrect->w;
+    final_rect->h = (int)dstrect->h;
+}
+
+/* Composite the first 'count' quads of the vertex array with a single call */
+static int
+OS4_CompositeQuads(SDL_Renderer * renderer, SDL_Texture * texture, int count, float alpha)
+{
+    OS4_RenderData *data = (OS4_RenderData *) renderer->driverdata;
+    OS4_TextureData *texturedata = (OS4_TextureData *) texture->driverdata;
+
+    struct BitMap *dst = OS4_ActivateRenderer(renderer);
+    struct BitMap *src = OS4_IsColorModEnabled(texture) ?
+        texturedata->finalbitmap : texturedata->bitmap;
+
+    uint32 ret_code;
+
+    if (!dst) {
+        return -1;
+    }
+
+    ret_code = data->iGraphics->CompositeTags(
+        OS4_ConvertBlendMode(texture->blendMode),
+        src,
+        dst,
+        COMPTAG_SrcAlpha,   COMP_FLOAT_TO_FIX(alpha),
+        COMPTAG_DestX,      data->cliprect.x,
+        COMPTAG_DestY,      data->cliprect.y,
+        COMPTAG_DestWidth,  data->cliprect.w,
+        COMPTAG_DestHeight, data->cliprect.h,
+        COMPTAG_Flags,      OS4_GetCompositeFlags(texture->blendMode),
+        COMPTAG_VertexArray, data->vertices,
+        COMPTAG_VertexFormat, COMPVF_STW0_Present,
+        COMPTAG_NumTriangles, count * 2,
+        COMPTAG_IndexArray, data->indices,
+        TAG_END);
+
+    if (ret_code) {
+        dprintf("CompositeTags: %d\n", ret_code);
+        return SDL_SetError("CompositeTags failed");
+    }
+
+    return 0;
+}
+
+/* Draw a run of queued copies from one texture with a single composite call */
+static int
+OS4_RenderQueuedCopies(SDL_Renderer * renderer, const SDL_RenderCommand * cmds, int count)
+{
+    OS4_RenderData *data = (OS4_RenderData *) renderer->driverdata;
+    SDL_Texture *texture = cmds[0].texture;
+    int i;
+
+    if (!OS4_ReserveQuads(data, count)) {
+        return SDL_OutOfMemory();
+    }
+
+    for (i = 0; i < count; ++i) {
+        SDL_Rect final_rect;
+
+        OS4_GetFinalRect(renderer, &cmds[i].dstrect, &final_rect);
+        OS4_FillVertexData(&data->vertices[i * 4], &cmds[i].srcrect, &final_rect, 0.0, NULL, SDL_FLIP_NONE);
+    }
+
+    return OS4_CompositeQuads(renderer, texture, count, OS4_GetCompositeAlpha(texture));
+}
+
+static int
+OS4_RenderCopyBatch(SDL_Renderer * renderer, SDL_Texture * texture,
+                    const SDL_Rect * srcrects, const SDL_FRect * dstrects,
+                    const SDL_Color * colors, int count)
+{
+    OS4_RenderData *data = (OS4_RenderData *) renderer->driverdata;
+    const Uint8 r = texture->r, g = texture->g, b = texture->b;
+    const float alpha = OS4_GetCompositeAlpha(texture);
+    int i, j, n;
+    int retval = 0;
+
+    if (!OS4_ReserveQuads(data, SDL_min(count, OS4_MAX_BATCHED_QUADS))) {
+        return SDL_OutOfMemory();
+    }
+
+    for (i = 0; i < count; i += n) {
+        const SDL_Color *color = colors ? &colors[i] : NULL;
+
+        /* Alpha goes to the composite call, but an RGB tint means a remodulated
+           bitmap, so runs are split wherever the color changes */
+        for (n = 1; i + n < count && n < OS4_MAX_BATCHED_QUADS; ++n) {
+            if (color && SDL_memcmp(color, &colors[i + n], sizeof(*color)) != 0) {
+                break;
+            }
+        }
+
+        for (j = 0; j < n; ++j) {
+            SDL_Rect final_rect;
+
+            OS4_GetFinalRect(renderer, &dstrects[i + j], &final_rect);
+            OS4_FillVertexData(&data->vertices[j * 4], &srcrects[i + j], &final_rect, 0.0, NULL, SDL_FLIP_NONE);
+        }
+
+        if (!color) {
+            if (OS4_CompositeQuads(renderer, texture, n, alpha) < 0) {
+                retval = -1;
+            }
+            continue;
+        }
+
+        texture->r = (Uint8) ((r * color->r) / 255);
+        texture->g = (Uint8) ((g * color->g) / 255);
+        texture->b = (Uint8) ((b * color->b) / 255);
+        /* Like the texture alpha, the copy alpha only applies when blending */
+        if (OS4_SetTextureColorMod(renderer, texture) < 0 ||
+            OS4_CompositeQuads(renderer, texture, n,
+                               texture->blendMode == SDL_BLENDMODE_NONE ? alpha : alpha * color->a / 255.0f) < 0) {
+            retval = -1;
+        }
+    }
+
+    if (colors) {
+        texture->r = r;
+        texture->g = g;
+        texture->b = b;
+        OS4_SetTextureColorMod(renderer, texture);
+    }
+
+    return retval;
+}
+
+static int
+OS4_RunCommandQueue(SDL_Renderer * renderer, const SDL_RenderCommand * cmds,
+                    int count, const void * vertices)
+{
+    int i, n;
+    int retval = 0;
+
+    for (i = 0; i < count; i += n) {
+        const SDL_RenderCommand *cmd = &cmds[i];
+
+        n = 1;
+        if (cmd->command == SDL_RENDERCMD_COPY) {
+            while (i + n < count && n < OS4_MAX_BATCHED_QUADS &&
+                   cmds[i + n].command == SDL_RENDERCMD_COPY &&
+                   cmds[i + n].texture == cmd->texture) {
+                ++n;
+            }
+
+            if (n > 1) {
+                if (OS4_RenderQueuedCopies(renderer, cmd, n) < 0) {
+                    retval = -1;
+                }
+                continue;
+            }
+        }
+
+        if (SDL_RunRenderCommand(renderer, cmd, vertices) < 0) {
+            retval = -1;
+        }
+    }
+
+    return retval;
+}
+
 static void
 OS4_DestroyRenderer(SDL_Renderer * renderer)
 {
@@ -944,6 +1161,9 @@ OS4_DestroyRenderer(SDL_Renderer * renderer)
         data->solidcolor = NULL;
     }
 
+    SDL_free(data->vertices);
+    SDL_free(data->indices);
+
     SDL_free(data);
     SDL_free(renderer);
 }
@@ -36,6 +36,10 @@ typedef struct
     struct BitMap *solidcolor;
     struct RastPort rastport;
     SDL_Rect cliprect;
+    /* Scratch buffers for merging queued copies into one composite call */
+    struct OS4_Vertex *vertices;
+    uint16 *indices;
+    int quad_allocation;
 } OS4_RenderData;
 
 extern struct BitMap * OS4_ActivateRenderer(SDL_Renderer * renderer);
@@ -88,6 +88,12 @@ static int GL_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
 static int GL_RenderCopyEx(SDL_Renderer * renderer, SDL_Texture * texture,
                          const SDL_Rect * srcrect, const SDL_FRect * dstrect,
                          const double angle, const SDL_FPoint *center, const SDL_RendererFlip flip);
+static int GL_RenderGeometry(SDL_Renderer * renderer, SDL_Texture * texture,
+                             const SDL_Vertex * vertices, int num_vertices,
+                             const int * indices, int num_indices);
+static int GL_RenderCopyBatch(SDL_Renderer * renderer, SDL_Texture * texture,
+                              const SDL_Rect * srcrects, const SDL_FRect * dstrects,
+                              const SDL_Color * colors, int count);
 static int GL_RenderReadPixels(SDL_Renderer * renderer, const SDL_Rect * rect,
                                Uint32 pixel_format, void * pixels, int pitch);
 static void GL_RenderPresent(SDL_Renderer * renderer);
@@ -460,6 +466,8 @@ GL_CreateRenderer(SDL_Window * window, Uint32 flags)
     renderer->RenderFillRects = GL_RenderFillRects;
     renderer->RenderCopy = GL_RenderCopy;
     renderer->RenderCopyEx = GL_RenderCopyEx;
+    renderer->RenderGeometry = GL_RenderGeometry;
+    renderer->RenderCopyBatch = GL_RenderCopyBatch;
     renderer->RenderReadPixels = GL_RenderReadPixels;
     renderer->RenderPresent = GL_RenderPresent;
     renderer->DestroyTexture = GL_DestroyTexture;
@@ -1529,6 +1537,132 @@ GL_RenderCopyEx(SDL_Renderer * renderer, SDL_Texture * texture,
     return GL_CheckError("", renderer);
 }
 
+static int
+GL_RenderGeometry(SDL_Renderer * renderer, SDL_Texture * texture,
+                  const SDL_Vertex * vertices, int num_vertices,
+                  const int * indices, int num_indices)
+{
+    GL_RenderData *data = (GL_RenderData *) renderer->driverdata;
+    GL_TextureData *texturedata = NULL;
+    GLfloat modr = 1.0f, modg = 1.0f, modb = 1.0f, moda = 1.0f;
+    GLfloat texw = 0.0f, texh = 0.0f;
+    Uint32 color;
+    int i, count;
+
+    GL_ActivateRenderer(renderer);
+
+    if (texture) {
+        texturedata = (GL_TextureData *) texture->driverdata;
+        if (GL_SetupCopy(renderer, texture) < 0) {
+            return -1;
+        }
+        if (texture->modMode) {
+            modr = (GLfloat) texture->r * inv255f;
+            modg = (GLfloat) texture->g * inv255f;
+            modb = (GLfloat) texture->b * inv255f;
+            moda = (GLfloat) texture->a * inv255f;
+        }
+        texw = texturedata->texw;
+        texh = texturedata->texh;
+    } else {
+        GL_SetDrawingState(renderer);
+    }
+
+    color = data->current.color;
+    count = indices ? num_indices : num_vertices;
+    count -= (count % 3);
+
+    data->glBegin(GL_TRIANGLES);
+    for (i = 0; i < count; ++i) {
+        const SDL_Vertex *v = &vertices[indices ? indices[i] : i];
+
+        data->glColor4f(v->color.r * inv255f * modr,
+                        v->color.g * inv255f * modg,
+                        v->color.b * inv255f * modb,
+                        v->color.a * inv255f * moda);
+        if (texture) {
+            data->glTexCoord2f(v->tex_coord.x * texw, v->tex_coord.y * texh);
+        }
+        data->glVertex2f(v->position.x, v->position.y);
+    }
+    data->glEnd();
+
+    /* Restore the color GL_SetColor() believes is current */
+    data->glColor4f((GLfloat) ((color >> 16) & 0xFF) * inv255f,
+                    (GLfloat) ((color >> 8) & 0xFF) * inv255f,
+                    (GLfloat) (color & 0xFF) * inv255f,
+                    (GLfloat) (color >> 24) * inv255f);
+
+    if (texture) {
+        data->glDisable(texturedata->type);
+    }
+
+    return GL_CheckError("", renderer);
+}
+
+static int
+GL_RenderCopyBatch(SDL_Renderer * renderer, SDL_Texture * texture,
+                   const SDL_Rect * srcrects, const SDL_FRect * dstrects,
+                   const SDL_Color * colors, int count)
+{
+    GL_RenderData *data = (GL_RenderData *) renderer->driverdata;
+    GL_TextureData *texturedata = (GL_TextureData *) texture->driverdata;
+    const GLfloat texw = texturedata->texw / texture->w;
+    const GLfloat texh = texturedata->texh / texture->h;
+    Uint32 color;
+    int i;
+
+    GL_ActivateRenderer(renderer);
+
+    if (GL_SetupCopy(renderer, texture) < 0) {
+        return -1;
+    }
+
+    color = data->current.color;
+
+    data->glBegin(GL_QUADS);
+    for (i = 0; i < count; ++i) {
+        const SDL_Rect *srcrect = &srcrects[i];
+        const SDL_FRect *dstrect = &dstrects[i];
+        const GLfloat minx = dstrect->x;
+        const GLfloat miny = dstrect->y;
+        const GLfloat maxx = dstrect->x + dstrect->w;
+        const GLfloat maxy = dstrect->y + dstrect->h;
+        const GLfloat minu = srcrect->x * texw;
+        const GLfloat maxu = (srcrect->x + srcrect->w) * texw;
+        const GLfloat minv = srcrect->y * texh;
+        const GLfloat maxv = (srcrect->y + srcrect->h) * texh;
+
+        if (colors) {
+            data->glColor4f(colors[i].r * texture->r * inv255f * inv255f,
+                            colors[i].g * texture->g * inv255f * inv255f,
+                            colors[i].b * texture->b * inv255f * inv255f,
+                            colors[i].a * texture->a * inv255f * inv255f);
+        }
+        data->glTexCoord2f(minu, minv);
+        data->glVertex2f(minx, miny);
+        data->glTexCoord2f(maxu, minv);
+        data->glVertex2f(maxx, miny);
+        data->glTexCoord2f(maxu, maxv);
+        data->glVertex2f(maxx, maxy);
+        data->glTexCoord2f(minu, maxv);
+        data->glVertex2f(minx, maxy);
+    }
+    data->glEnd();
+
+    if (colors) {
+        /* Restore the color GL_SetColor() believes is current */
+        data->glColor4f((GLfloat) ((color >> 16) & 0xFF) * inv255f,
+                        (GLfloat) ((color >> 8) & 0xFF) * inv255f,
+                        (GLfloat) (color & 0xFF) * inv255f,
+                        (GLfloat) (color >> 24) * inv255f);
+    }
+
+    data->glDisable(texturedata->type);
+
+    return GL_CheckError("", renderer);
+}
+
 static int
 GL_RenderReadPixels(SDL_Renderer * renderer, const SDL_Rect * rect,
                     Uint32 pixel_format, void * pixels, int pitch)
@@ -1336,6 +1336,9 @@ static int GLES2_RenderCopy(SDL_Renderer *renderer, SDL_Texture *texture, const
 static int GLES2_RenderCopyEx(SDL_Renderer * renderer, SDL_Texture * texture,
                          const SDL_Rect * srcrect, const SDL_FRect * dstrect,
                          const double angle, const SDL_FPoint *center, const SDL_RendererFlip flip);
+static int GLES2_RenderCopyBatch(SDL_Renderer *renderer, SDL_Texture *texture,
+                                 const SDL_Rect *srcrects, const SDL_FRect *dstrects,
+                                 const SDL_Color *colors, int count);
 static int GLES2_RenderReadPixels(SDL_Renderer * renderer, const SDL_Rect * rect,
                     Uint32 pixel_format, void * pixels, int pitch);
 static void GLES2_RenderPresent(SDL_Renderer *renderer);
@@ -1600,14 +1603,35 @@ GLES2_RenderFillRects(SDL_Renderer *renderer, const SDL_FRect *rects, int count)
     return GL_CheckError("", renderer);
 }
 
+static void
+GLES2_SetModulation(SDL_Renderer *renderer, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+    GLES2_DriverContext *data = (GLES2_DriverContext *)renderer->driverdata;
+    GLES2_ProgramCacheEntry *program = data->current_program;
+
+    if (renderer->target &&
+        (renderer->target->format == SDL_PIXELFORMAT_ARGB8888 ||
+         renderer->target->format == SDL_PIXELFORMAT_RGB888)) {
+        const Uint8 tmp = r;
+        r = b;
+        b = tmp;
+    }
+
+    if (!CompareColors(program->modulation_r, program->modulation_g, program->modulation_b, program->modulation_a, r, g, b, a)) {
+        data->myglUniform4f(program->uniform_locations[GLES2_UNIFORM_MODULATION], r * inv255f, g * inv255f, b * inv255f, a * inv255f);
+        program->modulation_r = r;
+        program->modulation_g = g;
+        program->modulation_b = b;
+        program->modulation_a = a;
+    }
+}
+
 static int
 GLES2_SetupCopy(SDL_Renderer *renderer, SDL_Texture *texture)
 {
     GLES2_DriverContext *data = (GLES2_DriverContext *)renderer->driverdata;
     GLES2_TextureData *tdata = (GLES2_TextureData *)texture->driverdata;
     GLES2_ImageSource sourceType = GLES2_IMAGESOURCE_TEXTURE_ABGR;
-    GLES2_ProgramCacheEntry *program;
-    Uint8 r, g, b, a;
 
     /* Activate an appropriate shader and set the projection matrix */
     if (renderer->target) {
@@ -1730,28 +1754,7 @@ GLES2_SetupCopy(SDL_Renderer *renderer, SDL_Texture *texture)
     data->myglBindTexture(tdata->texture_type, tdata->texture);
 
     /* Configure color modulation */
-    g = texture->g;
-    a = texture->a;
-
-    if (renderer->target &&
-        (renderer->target->format == SDL_PIXELFORMAT_ARGB8888 ||
-         renderer->target->format == SDL_PIXELFORMAT_RGB888)) {
-        r = texture->b;
-        b = texture->r;
-    } else {
-        r = texture->r;
-        b = texture->b;
-    }
-
-    program = data->current_program;
-
-    if (!CompareColors(program->modulation_r, program->modulation_g, program->modulation_b, program->modulation_a, r, g, b, a)) {
-        data->myglUniform4f(program->uniform_locations[GLES2_UNIFORM_MODULATION], r * inv255f, g * inv255f, b * inv255f, a * inv255f);
-        program->modulation_r = r;
-        program->modulation_g = g;
-        program->modulation_b = b;
-        program->modulation_a = a;
-    }
+    GLES2_SetModulation(renderer, texture->r, texture->g, texture->b, texture->a);
 
     /* Configure texture blending */
     GLES2_SetBlendMode(data, texture->blendMode);
@@ -1800,6 +1803,79 @@ GLES2_RenderCopy(SDL_Renderer *renderer, SDL_Texture *texture, const SDL_Rect *s
     return GL_CheckError("", renderer);
 }
 
+/* GLES2_RenderCopyBatch() uploads the quads in chunks of this many */
+#define GLES2_BATCH_CHUNK   64
+
+static int
+GLES2_RenderCopyBatch(SDL_Renderer *renderer, SDL_Texture *texture,
+                      const SDL_Rect *srcrects, const SDL_FRect *dstrects,
+                      const SDL_Color *colors, int count)
+{
+    GLES2_DriverContext *data = (GLES2_DriverContext *)renderer->driverdata;
+    GLfloat vertices[GLES2_BATCH_CHUNK * 12];
+    GLfloat texCoords[GLES2_BATCH_CHUNK * 12];
+    const GLfloat texw = 1.0f / texture->w;
+    const GLfloat texh = 1.0f / texture->h;
+    int i, j, n, run;
+
+    GLES2_ActivateRenderer(renderer);
+
+    if (GLES2_SetupCopy(renderer, texture) < 0) {
+        return -1;
+    }
+
+    for (i = 0; i < count; i += n) {
+        n = SDL_min(count - i, GLES2_BATCH_CHUNK);
+
+        /* Two triangles per copy, there's no primitive restart in GLES2 */
+        for (j = 0; j < n; ++j) {
+            const SDL_Rect *srcrect = &srcrects[i + j];
+            const SDL_FRect *dstrect = &dstrects[i + j];
+            const GLfloat minx = dstrect->x;
+            const GLfloat miny = dstrect->y;
+            const GLfloat maxx = dstrect->x + dstrect->w;
+            const GLfloat maxy = dstrect->y + dstrect->h;
+            const GLfloat minu = srcrect->x * texw;
+            const GLfloat minv = srcrect->y * texh;
+            const GLfloat maxu = (srcrect->x + srcrect->w) * texw;
+            const GLfloat maxv = (srcrect->y + srcrect->h) * texh;
+            GLfloat *v = &vertices[j * 12];
+            GLfloat *t = &texCoords[j * 12];
+
+            v[0] = minx; v[1] = miny; v[2] = maxx; v[3] = miny; v[4] = minx; v[5] = maxy;
+            v[6] = maxx; v[7] = miny; v[8] = maxx; v[9] = maxy; v[10] = minx; v[11] = maxy;
+            t[0] = minu; t[1] = minv; t[2] = maxu; t[3] = minv; t[4] = minu; t[5] = maxv;
+            t[6] = maxu; t[7] = minv; t[8] = maxu; t[9] = maxv; t[10] = minu; t[11] = maxv;
+        }
+        GLES2_UpdateVertexBuffer(renderer, GLES2_ATTRIBUTE_POSITION, vertices, n * 12 * sizeof(GLfloat));
+        GLES2_UpdateVertexBuffer(renderer, GLES2_ATTRIBUTE_TEXCOORD, texCoords, n * 12 * sizeof(GLfloat));
+
+        if (!colors) {
+            data->myglDrawArrays(GL_TRIANGLES, 0, n * 6);
+            continue;
+        }
+
+        /* The modulation is a uniform, draw runs of copies with the same color */
+        for (j = 0; j < n; j += run) {
+            const SDL_Color *color = &colors[i + j];
+
+            for (run = 1; j + run < n; ++run) {
+                const SDL_Color *next = &colors[i + j + run];
+
+                if (!CompareColors(color->r, color->g, color->b, color->a, next->r, next->g, next->b, next->a)) {
+                    break;
+                }
+            }
+            GLES2_SetModulation(renderer,
+                                (Uint8) ((texture->r * color->r) / 255), (Uint8) ((texture->g * color->g) / 255),
+                                (Uint8) ((texture->b * color->b) / 255), (Uint8) ((texture->a * color->a) / 255));
+            data->myglDrawArrays(GL_TRIANGLES, j * 6, run * 6);
+        }
+    }
+
+    return GL_CheckError("", renderer);
+}
+
 static int
 GLES2_RenderCopyEx(SDL_Renderer *renderer, SDL_Texture *texture, const SDL_Rect *srcrect,
                  const SDL_FRect *dstrect, const double angle, const SDL_FPoint *center, const SDL_RendererFlip flip)
@@ -2158,6 +2234,7 @@ GLES2_CreateRenderer(SDL_Window *window, Uint32 flags)
     renderer->RenderFillRects     = GLES2_RenderFillRects;
     renderer->RenderCopy          = GLES2_RenderCopy;
     renderer->RenderCopyEx        = GLES2_RenderCopyEx;
+    renderer->RenderCopyBatch     = GLES2_RenderCopyBatch;
     renderer->RenderReadPixels    = GLES2_RenderReadPixels;
     renderer->RenderPresent       = GLES2_RenderPresent;
     renderer->DestroyTexture      = GLES2_DestroyTexture;
@@ -25,6 +25,8 @@
 #include "../SDL_sysrender.h"
 #include "SDL_render_sw_c.h"
 #include "SDL_hints.h"
+#include "SDL_cpuinfo.h"
+#include "SDL_thread.h"
 
 #include "SDL_draw.h"
 #include "SDL_blendfillrect.h"
@@ -33,6 +35,7 @@
 #include "SDL_drawline.h"
 #include "SDL_drawpoint.h"
 #include "SDL_rotate.h"
+#include "SDL_triangle.h"
 
 /* SDL surface based renderer implementation */
 
@@ -68,9 +71,17 @@ static int SW_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
 static int SW_RenderCopyEx(SDL_Renderer * renderer, SDL_Texture * texture,
                           const SDL_Rect * srcrect, const SDL_FRect * dstrect,
                           const double angle, const SDL_FPoint * center, const SDL_RendererFlip flip);
+static int SW_RenderCopyBatch(SDL_Renderer * renderer, SDL_Texture * texture,
+                              const SDL_Rect * srcrects, const SDL_FRect * dstrects,
+                              const SDL_Color * colors, int count);
+static int SW_RenderGeometry(SDL_Renderer * renderer, SDL_Texture * texture,
+                             const SDL_Vertex * vertices, int num_vertices,
+                             const int * indices, int num_indices);
 static int SW_RenderReadPixels(SDL_Renderer * renderer, const SDL_Rect * rect,
                                Uint32 format, void * pixels, int pitch);
 static void SW_RenderPresent(SDL_Renderer * renderer);
+static int SW_RunCommandQueue(SDL_Renderer * renderer, const SDL_RenderCommand * cmds,
+                              int count, const void * vertices);
 static void SW_DestroyTexture(SDL_Renderer * renderer, SDL_Texture * texture);
 static void SW_DestroyRenderer(SDL_Renderer * renderer);
 
@@ -95,13 +106,167 @@ SDL_RenderDriver SW_RenderDriver = {
      0}
 };
 
+/* Threaded drawing: the target is cut into tiles of SW_TILE_ROWS full-width
+   rows and every queued command is binned into the tiles it touches. Each
+   tile is then drawn by one thread, replaying its commands in queue order
+   clipped to the tile. Tiles keep the full row width, so every row is drawn
+   with exactly the same spans as on a single thread and the output is
+   identical.
+ */
+#define SW_TILE_ROWS            32
+#define SW_MAX_THREADS          64
+
+/* Runs of commands covering fewer pixels aren't worth waking the workers */
+#define SW_MIN_TILED_PIXELS     (64 * 1024)
+
+struct SW_TilePool;
+
+typedef struct
+{
+    struct SW_TilePool *pool;
+    SDL_Thread *thread;
+    SDL_Surface *view;          /* the target's pixels, with a private clip rect */
+} SW_TileWorker;
+
+typedef struct SW_TilePool
+{
+    int num_workers;            /* worker 0 is the thread flushing the queue */
+    SW_TileWorker *workers;
+    SDL_sem *work;
+    SDL_sem *done;
+    SDL_atomic_t quit;
+
+    /* The run being drawn */
+    SDL_Surface *surface;
+    SDL_Rect viewport;
+    const SDL_RenderCommand *cmds;
+    const void *vertices;
+    int num_tiles;
+    SDL_atomic_t next_tile;
+    SDL_atomic_t status;
+
+    /* Per command row span, then per tile command lists */
+    int *bounds;
+    int bounds_allocation;
+    int *bin_start;
+    int bin_start_allocation;
+    int *bin_items;
+    int bin_items_allocation;
+} SW_TilePool;
+
+/* Areas of the window surface drawn since the last present. Overlapping
+   areas are merged, and once the list is full new areas are merged into
+   whichever rect grows the least. */
+#define SW_MAX_DIRTY_RECTS      16
+
 typedef struct
 {
     SDL_Surface *surface;
     SDL_Surface *window;
+    int num_threads;
+    SW_TilePool *pool;
+    SDL_Rect dirty[SW_MAX_DIRTY_RECTS];
+    int num_dirty;
+    SDL_bool all_dirty;
 } SW_RenderData;
 
 
+static int
+SW_GetThreadCount(void)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_RENDER_SW_THREADS);
+    int count;
+
+    if (!hint) {
+        return 1;
+    }
+    if (SDL_strcasecmp(hint, "auto") == 0) {
+        count = SDL_GetCPUCount();
+    } else {
+        count = SDL_atoi(hint);
+    }
+    return SDL_max(1, SDL_min(count, SW_MAX_THREADS));
+}
+
+static void
+SW_SetAllDirty(SDL_Renderer * renderer)
+{
+    SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
+
+    data->all_dirty = SDL_TRUE;
+    data->num_dirty = 0;
+}
+
+static int
+SW_GetRectArea(const SDL_Rect * rect)
+{
+    return rect->w * rect->h;
+}
+
+/* Record that 'rect' of the output was drawn to, if the output is the window */
+static void
+SW_AddDirtyRect(SDL_Renderer * renderer, SDL_Surface * surface, const SDL_Rect * rect)
+{
+    SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
+    SDL_Rect dirty, merged;
+    int i, best, cost, best_cost;
+
+    if (!renderer->window || surface != data->window || data->all_dirty) {
+        return;
+    }
+    if (!SDL_IntersectRect(rect, &surface->clip_rect, &dirty)) {
+        return;
+    }
+
+    for (;;) {
+        /* Swallow everything the new rect overlaps */
+        for (i = 0; i < data->num_dirty; ) {
+            if (SDL_HasIntersection(&data->dirty[i], &dirty)) {
+                SDL_UnionRect(&data->dirty[i], &dirty, &dirty);
+                data->dirty[i] = data->dirty[--data->num_dirty];
+                i = 0;
+            } else {
+                ++i;
+            }
+        }
+        if (data->num_dirty < SW_MAX_DIRTY_RECTS) {
+            break;
+        }
+
+        /* The list is full, merge with the rect that adds the least area */
+        best = 0;
+        best_cost = SDL_MAX_SINT32;
+        for (i = 0; i < data->num_dirty; ++i) {
+            SDL_UnionRect(&data->dirty[i], &dirty, &merged);
+            cost = SW_GetRectArea(&merged) - SW_GetRectArea(&data->dirty[i]);
+            if (cost < best_cost) {
+                best = i;
+                best_cost = cost;
+            }
+        }
+        SDL_UnionRect(&data->dirty[best], &dirty, &dirty);
+        data->dirty[best] = data->dirty[--data->num_dirty];
+    }
+
+    if (dirty.w >= surface->w && dirty.h >= surface->h) {
+        SW_SetAllDirty(renderer);
+    } else {
+        data->dirty[data->num_dirty++] = dirty;
+    }
+}
+
+/* Record the bounding box of a list of points */
+static void
+SW_AddDirtyPoints(SDL_Renderer * renderer, SDL_Surface * surface,
+                  const SDL_Point * points, int count)
+{
+    SDL_Rect rect;
+
+    if (SDL_EnclosePoints(points, count, NULL, &rect)) {
+        SW_AddDirtyRect(renderer, surface, &rect);
+    }
+}
+
 static SDL_Surface *
 SW_ActivateRenderer(SDL_Renderer * renderer)
 {
@@ -114,6 +279,7 @@ SW_ActivateRenderer(SDL_Renderer * renderer)
         SDL_Surface *surface = SDL_GetWindowSurface(renderer->window);
         if (surface) {
             data->surface = data->window = surface;
+            SW_SetAllDirty(renderer);
 
             SW_UpdateViewport(renderer);
             SW_UpdateClipRect(renderer);
@@ -147,6 +313,7 @@ SW_CreateRendererForSurface(SDL_Surface * surface)
     }
     data->surface = surface;
     data->window = surface;
+    data->all_dirty = SDL_TRUE;
 
     renderer->WindowEvent = SW_WindowEvent;
     renderer->GetOutputSize = SW_GetOutputSize;
@@ -166,13 +333,22 @@ SW_CreateRendererForSurface(SDL_Surface * surface)
     renderer->RenderFillRects = SW_RenderFillRects;
     renderer->RenderCopy = SW_RenderCopy;
     renderer->RenderCopyEx = SW_RenderCopyEx;
+    renderer->RenderGeometry = SW_RenderGeometry;
+    renderer->RenderCopyBatch = SW_RenderCopyBatch;
     renderer->RenderReadPixels = SW_RenderReadPixels;
     renderer->RenderPresent = SW_RenderPresent;
+    renderer->RunCommandQueue = SW_RunCommandQueue;
     renderer->DestroyTexture = SW_DestroyTexture;
     renderer->DestroyRenderer = SW_DestroyRenderer;
     renderer->info = SW_RenderDriver.info;
     renderer->driverdata = data;
 
+    data->num_threads = SW_GetThreadCount();
+    if (data->num_threads > 1) {
+        /* Commands are split across threads when the queue is flushed */
+        renderer->batching = SDL_TRUE;
+    }
+
     SW_ActivateRenderer(renderer);
 
     return renderer;
@@ -195,9 +371,19 @@ SW_WindowEvent(SDL_Renderer * renderer, const SDL_WindowEvent *event)
 {
     SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
 
-    if (event->event == SDL_WINDOWEVENT_SIZE_CHANGED) {
+    switch (event->event) {
+    case SDL_WINDOWEVENT_SIZE_CHANGED:
         data->surface = NULL;
         data->window = NULL;
+        break;
+    case SDL_WINDOWEVENT_SHOWN:
+    case SDL_WINDOWEVENT_EXPOSED:
+    case SDL_WINDOWEVENT_RESTORED:
+        /* The window contents may be gone, send all of it on the next present */
+        SW_SetAllDirty(renderer);
+        break;
+    default:
+        break;
     }
 }
 
@@ -256,12 +442,6 @@ static int
 SW_SetTextureColorMod(SDL_Renderer * renderer, SDL_Texture * texture)
 {
     SDL_Surface *surface = (SDL_Surface *) texture->driverdata;
-    /* If the color mod is ever enabled (non-white), permanently disable RLE (which doesn't support
-     * color mod) to avoid potentially frequent RLE encoding/decoding.
-     */
-    if ((texture->r & texture->g & texture->b) != 255) {
-        SDL_SetSurfaceRLE(surface, 0);
-    }
     return SDL_SetSurfaceColorMod(surface, texture->r, texture->g,
                                   texture->b);
 }
@@ -270,12 +450,6 @@ static int
 SW_SetTextureAlphaMod(SDL_Renderer * renderer, SDL_Texture * texture)
 {
     SDL_Surface *surface = (SDL_Surface *) texture->driverdata;
-    /* If the texture ever has multiple alpha values (surface alpha plus alpha channel), permanently
-     * disable RLE (which doesn't support this) to avoid potentially frequent RLE encoding/decoding.
-     */
-    if (texture->a != 255 && surface->format->Amask) {
-        SDL_SetSurfaceRLE(surface, 0);
-    }
     return SDL_SetSurfaceAlphaMod(surface, texture->a);
 }
 
@@ -283,12 +457,6 @@ static int
 SW_SetTextureBlendMode(SDL_Renderer * renderer, SDL_Texture * texture)
 {
     SDL_Surface *surface = (SDL_Surface *) texture->driverdata;
-    /* If add or mod blending are ever enabled, permanently disable RLE (which doesn't support
-     * them) to avoid potentially frequent RLE encoding/decoding.
-     */
-    if ((texture->blendMode == SDL_BLENDMODE_ADD || texture->blendMode == SDL_BLENDMODE_MOD)) {
-        SDL_SetSurfaceRLE(surface, 0);
-    }
     return SDL_SetSurfaceBlendMode(surface, texture->blendMode);
 }
 
@@ -403,6 +571,10 @@ SW_RenderClear(SDL_Renderer * renderer)
     SDL_SetClipRect(surface, NULL);
     SDL_FillRect(surface, NULL, color);
     SDL_SetClipRect(surface, &clip_rect);
+
+    if (surface == ((SW_RenderData *) renderer->driverdata)->window) {
+        SW_SetAllDirty(renderer);
+    }
     return 0;
 }
 
@@ -450,6 +622,7 @@ SW_RenderDrawPoints(SDL_Renderer * renderer, const SDL_FPoint * points,
                                 renderer->r, renderer->g, renderer->b,
                                 renderer->a);
     }
+    SW_AddDirtyPoints(renderer, surface, final_points, count);
     SDL_stack_free(final_points);
 
     return status;
@@ -499,6 +672,7 @@ SW_RenderDrawLines(SDL_Renderer * renderer, const SDL_FPoint * points,
                                 renderer->r, renderer->g, renderer->b,
                                 renderer->a);
     }
+    SW_AddDirtyPoints(renderer, surface, final_points, count);
     SDL_stack_free(final_points);
 
     return status;
@@ -549,22 +723,31 @@ SW_RenderFillRects(SDL_Renderer * renderer, const SDL_FRect * rects, int count)
                                     renderer->r, renderer->g, renderer->b,
                                     renderer->a);
     }
+    for (i = 0; i < count; ++i) {
+        SW_AddDirtyRect(renderer, surface, &final_rects[i]);
+    }
     SDL_stack_free(final_rects);
 
     return status;
 }
 
 static int
-SW_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
-              const SDL_Rect * srcrect, const SDL_FRect * dstrect)
+GetScaleQuality(void)
 {
-    SDL_Surface *surface = SW_ActivateRenderer(renderer);
-    SDL_Surface *src = (SDL_Surface *) texture->driverdata;
-    SDL_Rect final_rect;
+    const char *hint = SDL_GetHint(SDL_HINT_RENDER_SCALE_QUALITY);
 
-    if (!surface) {
-        return -1;
+    if (!hint || *hint == '0' || SDL_strcasecmp(hint, "nearest") == 0) {
+        return 0;
+    } else {
+        return 1;
     }
+}
+
+static int
+SW_BlitTexture(SDL_Renderer * renderer, SDL_Surface * surface, SDL_Surface * src,
+               const SDL_Rect * srcrect, const SDL_FRect * dstrect)
+{
+    SDL_Rect final_rect;
 
     if (renderer->viewport.x || renderer->viewport.y) {
         final_rect.x = (int)(renderer->viewport.x + dstrect->x);
@@ -576,27 +759,73 @@ SW_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
     final_rect.w = (int)dstrect->w;
     final_rect.h = (int)dstrect->h;
 
+    SW_AddDirtyRect(renderer, surface, &final_rect);
+
     if ( srcrect->w == final_rect.w && srcrect->h == final_rect.h ) {
         return SDL_BlitSurface(src, srcrect, surface, &final_rect);
     } else {
-        /* If scaling is ever done, permanently disable RLE (which doesn't support scaling)
-         * to avoid potentially frequent RLE encoding/decoding.
+        /* Switching between scaled and unscaled copies rebuilds the texture's blit, which
+         * encodes its runs again, and linear filtering decodes them on every copy. If the
+         * texture is ever scaled, permanently disable its RLE.
          */
-        SDL_SetSurfaceRLE(surface, 0);
-        return SDL_BlitScaled(src, srcrect, surface, &final_rect);
+        SDL_SetSurfaceRLE(src, 0);
+        return SDL_PrivateUpperBlitScaled(src, srcrect, surface, &final_rect,
+                                          GetScaleQuality() ? SDL_TRUE : SDL_FALSE);
     }
 }
 
 static int
-GetScaleQuality(void)
+SW_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
+              const SDL_Rect * srcrect, const SDL_FRect * dstrect)
 {
-    const char *hint = SDL_GetHint(SDL_HINT_RENDER_SCALE_QUALITY);
+    SDL_Surface *surface = SW_ActivateRenderer(renderer);
 
-    if (!hint || *hint == '0' || SDL_strcasecmp(hint, "nearest") == 0) {
-        return 0;
-    } else {
-        return 1;
+    if (!surface) {
+        return -1;
     }
+
+    return SW_BlitTexture(renderer, surface, (SDL_Surface *) texture->driverdata,
+                          srcrect, dstrect);
+}
+
+static int
+SW_RenderCopyBatch(SDL_Renderer * renderer, SDL_Texture * texture,
+                   const SDL_Rect * srcrects, const SDL_FRect * dstrects,
+                   const SDL_Color * colors, int count)
+{
+    SDL_Surface *surface = SW_ActivateRenderer(renderer);
+    SDL_Surface *src = (SDL_Surface *) texture->driverdata;
+    int i;
+    int retval = 0;
+
+    if (!surface) {
+        return -1;
+    }
+
+    if (!colors) {
+        for (i = 0; i < count; ++i) {
+            if (SW_BlitTexture(renderer, surface, src, &srcrects[i], &dstrects[i]) < 0) {
+                retval = -1;
+            }
+        }
+        return retval;
+    }
+
+    /* The colors can switch modulation on and off from copy to copy, and each switch
+       would encode the runs again */
+    SDL_SetSurfaceRLE(src, 0);
+    for (i = 0; i < count; ++i) {
+        SDL_SetSurfaceColorMod(src, (Uint8) ((texture->r * colors[i].r) / 255),
+                               (Uint8) ((texture->g * colors[i].g) / 255),
+                               (Uint8) ((texture->b * colors[i].b) / 255));
+        SDL_SetSurfaceAlphaMod(src, (Uint8) ((texture->a * colors[i].a) / 255));
+        if (SW_BlitTexture(renderer, surface, src, &srcrects[i], &dstrects[i]) < 0) {
+            retval = -1;
+        }
+    }
+    SDL_SetSurfaceColorMod(src, texture->r, texture->g, texture->b);
+    SDL_SetSurfaceAlphaMod(src, texture->a);
+    return retval;
 }
 
 static int
@@ -705,7 +934,8 @@ SW_RenderCopyEx(SDL_Renderer * renderer, SDL_Texture * texture,
             retval = -1;
         } else {
             SDL_SetSurfaceBlendMode(src_clone, SDL_BLENDMODE_NONE);
-            retval = SDL_BlitScaled(src_clone, srcrect, src_scaled, &scale_rect);
+            retval = SDL_PrivateUpperBlitScaled(src_clone, srcrect, src_scaled, &scale_rect,
+                                                GetScaleQuality() ? SDL_TRUE : SDL_FALSE);
             SDL_FreeSurface(src_clone);
             src_clone = src_scaled;
             src_scaled = NULL;
@@ -763,6 +993,7 @@ SW_RenderCopyEx(SDL_Renderer * renderer, SDL_Texture * texture,
             tmp_rect.y = (int)MIN(MIN(p1y, p2y), MIN(p3y, p4y));
             tmp_rect.w = dstwidth;
             tmp_rect.h = dstheight;
+            SW_AddDirtyRect(renderer, surface, &tmp_rect);
 
             /* The NONE blend mode needs some special care with non-opaque surfaces.
              * Other blend modes or opaque surfaces can be blitted directly.
@@ -831,6 +1062,60 @@ SW_RenderCopyEx(SDL_Renderer * renderer, SDL_Texture * texture,
     return retval;
 }
 
+static int
+SW_RenderGeometry(SDL_Renderer * renderer, SDL_Texture * texture,
+                  const SDL_Vertex * vertices, int num_vertices,
+                  const int * indices, int num_indices)
+{
+    SDL_Surface *surface = SW_ActivateRenderer(renderer);
+    SDL_Color mod;
+    SDL_Rect bounds;
+    float minx, miny, maxx, maxy;
+    int i;
+
+    if (!surface) {
+        return -1;
+    }
+
+    if (num_vertices > 0) {
+        minx = maxx = vertices[0].position.x;
+        miny = maxy = vertices[0].position.y;
+        for (i = 1; i < num_vertices; ++i) {
+            minx = SDL_min(minx, vertices[i].position.x);
+            miny = SDL_min(miny, vertices[i].position.y);
+            maxx = SDL_max(maxx, vertices[i].position.x);
+            maxy = SDL_max(maxy, vertices[i].position.y);
+        }
+        /* Clamp before converting, the clip rect takes care of the rest */
+        minx = SDL_max(minx, -1.0f);
+        miny = SDL_max(miny, -1.0f);
+        maxx = SDL_min(maxx, (float) surface->w);
+        maxy = SDL_min(maxy, (float) surface->h);
+        bounds.x = renderer->viewport.x + (int) SDL_floor(minx);
+        bounds.y = renderer->viewport.y + (int) SDL_floor(miny);
+        bounds.w = (int) SDL_ceil(maxx) - (int) SDL_floor(minx) + 1;
+        bounds.h = (int) SDL_ceil(maxy) - (int) SDL_floor(miny) + 1;
+        SW_AddDirtyRect(renderer, surface, &bounds);
+    }
+
+    if (texture) {
+        mod.r = texture->r;
+        mod.g = texture->g;
+        mod.b = texture->b;
+        mod.a = texture->a;
+        return SDL_SW_RenderGeometry(surface, (SDL_Surface *) texture->driverdata,
+                                     vertices, num_vertices, indices, num_indices,
+                                     renderer->viewport.x, renderer->viewport.y,
+                                     texture->blendMode, &mod);
+    }
+
+    mod.r = mod.g = mod.b = mod.a = 255;
+    return SDL_SW_RenderGeometry(surface, NULL,
+                                 vertices, num_vertices, indices, num_indices,
+                                 renderer->viewport.x, renderer->viewport.y,
+                                 renderer->blendMode, &mod);
+}
+
 static int
 SW_RenderReadPixels(SDL_Renderer * renderer, const SDL_Rect * rect,
                     Uint32 format, void * pixels, int pitch)
@@ -865,11 +1150,715 @@ SW_RenderReadPixels(SDL_Renderer * renderer, const SDL_Rect * rect,
 static void
 SW_RenderPresent(SDL_Renderer * renderer)
 {
+    SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
     SDL_Window *window = renderer->window;
 
     if (window) {
-        SDL_UpdateWindowSurface(window);
+        if (data->all_dirty) {
+            SDL_UpdateWindowSurface(window);
+        } else if (data->num_dirty > 0) {
+            SDL_UpdateWindowSurfaceRects(window, data->dirty, data->num_dirty);
+        }
+        data->all_dirty = SDL_FALSE;
+        data->num_dirty = 0;
+    }
+}
+
+/* SW_RenderFillRects() converts the rects on the stack */
+#define SW_MAX_MERGED_RECTS 4096
+
+static SDL_bool
+SW_CanMergeFillRects(const SDL_RenderCommand * first, const SDL_RenderCommand * next)
+{
+    /* Rects queued back to back are contiguous in the vertex data */
+    return next->command == SDL_RENDERCMD_FILL_RECTS &&
+           next->r == first->r && next->g == first->g &&
+           next->b == first->b && next->a == first->a &&
+           next->blendMode == first->blendMode;
+}
+
+static int
+SW_RunCommands(SDL_Renderer * renderer, SDL_Surface * surface,
+               const SDL_RenderCommand * cmds, int count, const void * vertices)
+{
+    int i, n;
+    int retval = 0;
+
+    for (i = 0; i < count; i += n) {
+        const SDL_RenderCommand *cmd = &cmds[i];
+
+        n = 1;
+        if (cmd->command == SDL_RENDERCMD_COPY) {
+            /* Consecutive copies of one texture go straight to the blitter */
+            SDL_Surface *src = (SDL_Surface *) cmd->texture->driverdata;
+
+            for (;;) {
+                if (SW_BlitTexture(renderer, surface, src, &cmds[i + n - 1].srcrect, &cmds[i + n - 1].dstrect) < 0) {
+                    retval = -1;
+                }
+                if (i + n == count || cmds[i + n].command != SDL_RENDERCMD_COPY ||
+                    cmds[i + n].texture != cmd->texture) {
+                    break;
+                }
+                ++n;
+            }
+        } else if (cmd->command == SDL_RENDERCMD_FILL_RECTS) {
+            /* Fill runs with the same color and blend mode in one call */
+            SDL_RenderCommand merged = *cmd;
+
+            while (i + n < count && SW_CanMergeFillRects(cmd, &cmds[i + n]) &&
+                   merged.count + cmds[i + n].count <= SW_MAX_MERGED_RECTS) {
+                merged.count += cmds[i + n].count;
+                ++n;
+            }
+            if (SDL_RunRenderCommand(renderer, &merged, vertices) < 0) {
+                retval = -1;
+            }
+        } else {
+            if (SDL_RunRenderCommand(renderer, cmd, vertices) < 0) {
+                retval = -1;
+            }
+        }
+    }
+    return retval;
+}
+
+/* SW_DrawTile() converts rects and points in chunks of this many */
+#define SW_TILE_CHUNK           64
+
+static SDL_bool
+SW_CanDrawTiled(SDL_Surface * surface)
+{
+    /* The tile views are made from the pixel format enum */
+    return surface->format->format != SDL_PIXELFORMAT_UNKNOWN &&
+           !SDL_ISPIXELFORMAT_INDEXED(surface->format->format) &&
+           surface->format->BytesPerPixel >= 2 &&
+           !SDL_MUSTLOCK(surface) &&
+           surface->h > SW_TILE_ROWS;
+}
+
+static int
+SW_TileFillRects(SDL_Surface * view, const SDL_Rect * viewport,
+                 const SDL_RenderCommand * cmd, const SDL_FRect * rects)
+{
+    SDL_Rect final_rects[SW_TILE_CHUNK];
+    int i, j, n;
+    int status = 0;
+
+    for (i = 0; i < cmd->count; i += n) {
+        n = SDL_min(cmd->count - i, SW_TILE_CHUNK);
+        for (j = 0; j < n; ++j) {
+            final_rects[j].x = (int)(viewport->x + rects[i + j].x);
+            final_rects[j].y = (int)(viewport->y + rects[i + j].y);
+            final_rects[j].w = SDL_max((int)rects[i + j].w, 1);
+            final_rects[j].h = SDL_max((int)rects[i + j].h, 1);
+        }
+        if (cmd->blendMode == SDL_BLENDMODE_NONE) {
+            Uint32 color = SDL_MapRGBA(view->format, cmd->r, cmd->g, cmd->b, cmd->a);
+            if (SDL_FillRects(view, final_rects, n, color) < 0) {
+                status = -1;
+            }
+        } else {
+            if (SDL_BlendFillRects(view, final_rects, n, cmd->blendMode,
+                                   cmd->r, cmd->g, cmd->b, cmd->a) < 0) {
+                status = -1;
+            }
+        }
+    }
+    return status;
+}
+
+static int
+SW_TileDrawPoints(SDL_Surface * view, const SDL_Rect * viewport,
+                  const SDL_RenderCommand * cmd, const SDL_FPoint * points)
+{
+    SDL_Point final_points[SW_TILE_CHUNK];
+    int i, j, n;
+    int status = 0;
+
+    for (i = 0; i < cmd->count; i += n) {
+        n = SDL_min(cmd->count - i, SW_TILE_CHUNK);
+        for (j = 0; j < n; ++j) {
+            final_points[j].x = (int)(viewport->x + points[i + j].x);
+            final_points[j].y = (int)(viewport->y + points[i + j].y);
+        }
+        if (cmd->blendMode == SDL_BLENDMODE_NONE) {
+            Uint32 color = SDL_MapRGBA(view->format, cmd->r, cmd->g, cmd->b, cmd->a);
+            if (SDL_DrawPoints(view, final_points, n, color) < 0) {
+                status = -1;
+            }
+        } else {
+            if (SDL_BlendPoints(view, final_points, n, cmd->blendMode,
+                                cmd->r, cmd->g, cmd->b, cmd->a) < 0) {
+                status = -1;
+            }
+        }
+    }
+    return status;
+}
+
+static void
+SW_TileCopy(SDL_Surface * surface, const SDL_Rect * clip, const SDL_Rect * viewport,
+            SDL_Surface * src, const SDL_Rect * copy_srcrect, const SDL_FRect * copy_dstrect)
+{
+    SDL_Rect srcrect, dstrect;
+    int d;
+
+    /* Where SW_BlitTexture() puts it, clipped the way SDL_UpperBlit() does */
+    srcrect = *copy_srcrect;
+    dstrect.x = (int)(viewport->x + copy_dstrect->x);
+    dstrect.y = (int)(viewport->y + copy_dstrect->y);
+    if (srcrect.x < 0) {
+        srcrect.w += srcrect.x;
+        dstrect.x -= srcrect.x;
+        srcrect.x = 0;
+    }
+    srcrect.w = SDL_min(srcrect.w, src->w - srcrect.x);
+    if (srcrect.y < 0) {
+        srcrect.h += srcrect.y;
+        dstrect.y -= srcrect.y;
+        srcrect.y = 0;
+    }
+    srcrect.h = SDL_min(srcrect.h, src->h - srcrect.y);
+
+    d = clip->x - dstrect.x;
+    if (d > 0) {
+        srcrect.w -= d;
+        srcrect.x += d;
+        dstrect.x += d;
+    }
+    d = dstrect.x + srcrect.w - clip->x - clip->w;
+    if (d > 0) {
+        srcrect.w -= d;
+    }
+    d = clip->y - dstrect.y;
+    if (d > 0) {
+        srcrect.h -= d;
+        srcrect.y += d;
+        dstrect.y += d;
+    }
+    d = dstrect.y + srcrect.h - clip->y - clip->h;
+    if (d > 0) {
+        srcrect.h -= d;
+    }
+
+    if (srcrect.w > 0 && srcrect.h > 0) {
+        dstrect.w = srcrect.w;
+        dstrect.h = srcrect.h;
+        SDL_BlitConcurrent(src, &srcrect, surface, &dstrect);
+    }
+}
+
+static int
+SW_TileGeometry(SDL_Surface * view, const SDL_Rect * viewport,
+                const SDL_RenderCommand * cmd, const SDL_Vertex * vertices)
+{
+    const int *indices = cmd->num_indices ? (const int *) (vertices + cmd->count) : NULL;
+    SDL_Texture *texture = cmd->texture;
+    SDL_Color mod;
+
+    if (texture) {
+        mod.r = texture->r;
+        mod.g = texture->g;
+        mod.b = texture->b;
+        mod.a = texture->a;
+        return SDL_SW_RenderGeometry(view, (SDL_Surface *) texture->driverdata,
+                                     vertices, cmd->count, indices, cmd->num_indices,
+                                     viewport->x, viewport->y, texture->blendMode, &mod);
+    }
+
+    mod.r = mod.g = mod.b = mod.a = 255;
+    return SDL_SW_RenderGeometry(view, NULL, vertices, cmd->count, indices, cmd->num_indices,
+                                 viewport->x, viewport->y, cmd->blendMode, &mod);
+}
+
+static void
+SW_DrawTile(SW_TilePool * pool, SDL_Surface * view, int tile)
+{
+    SDL_Surface *surface = pool->surface;
+    SDL_Rect band, clip;
+    int i;
+
+    band.x = 0;
+    band.y = tile * SW_TILE_ROWS;
+    band.w = surface->w;
+    band.h = SDL_min(SW_TILE_ROWS, surface->h - band.y);
+    if (!SDL_IntersectRect(&surface->clip_rect, &band, &clip)) {
+        clip.w = clip.h = 0;
+    }
+
+    for (i = pool->bin_start[tile]; i < pool->bin_start[tile + 1]; ++i) {
+        const SDL_RenderCommand *cmd = &pool->cmds[pool->bin_items[i]];
+        const void *data = (const Uint8 *) pool->vertices + cmd->first;
+        int status = 0;
+
+        if (cmd->command == SDL_RENDERCMD_CLEAR) {
+            /* By definition the clear ignores the clip rect */
+            view->clip_rect = band;
+            status = SDL_FillRect(view, NULL, SDL_MapRGBA(view->format, cmd->r, cmd->g, cmd->b, cmd->a));
+        } else if (!SDL_RectEmpty(&clip)) {
+            view->clip_rect = clip;
+            switch (cmd->command) {
+            case SDL_RENDERCMD_FILL_RECTS:
+                status = SW_TileFillRects(view, &pool->viewport, cmd, (const SDL_FRect *) data);
+                break;
+            case SDL_RENDERCMD_DRAW_POINTS:
+                status = SW_TileDrawPoints(view, &pool->viewport, cmd, (const SDL_FPoint *) data);
+                break;
+            case SDL_RENDERCMD_COPY:
+                SW_TileCopy(surface, &clip, &pool->viewport, (SDL_Surface *) cmd->texture->driverdata,
+                            &cmd->srcrect, &cmd->dstrect);
+                break;
+            case SDL_RENDERCMD_COPY_BATCH:
+                {
+                    const SDL_Rect *srcrects = (const SDL_Rect *) data;
+                    const SDL_FRect *dstrects = (const SDL_FRect *) (srcrects + cmd->count);
+                    int j;
+
+                    for (j = 0; j < cmd->count; ++j) {
+                        SW_TileCopy(surface, &clip, &pool->viewport, (SDL_Surface *) cmd->texture->driverdata,
+                                    &srcrects[j], &dstrects[j]);
+                    }
+                }
+                break;
+            case SDL_RENDERCMD_GEOMETRY:
+                status = SW_TileGeometry(view, &pool->viewport, cmd, (const SDL_Vertex *) data);
+                break;
+            default:
+                break;
+            }
+        }
+        if (status < 0) {
+            SDL_AtomicSet(&pool->status, -1);
+        }
+    }
+}
+
+static void
+SW_DrawTiles(SW_TilePool * pool, SDL_Surface * view)
+{
+    int tile;
+
+    while ((tile = SDL_AtomicAdd(&pool->next_tile, 1)) < pool->num_tiles) {
+        SW_DrawTile(pool, view, tile);
+    }
+}
+
+static int SDLCALL
+SW_TileThread(void *data)
+{
+    SW_TileWorker *worker = (SW_TileWorker *) data;
+    SW_TilePool *pool = worker->pool;
+
+    for (;;) {
+        SDL_SemWait(pool->work);
+        if (SDL_AtomicGet(&pool->quit)) {
+            break;
+        }
+        SW_DrawTiles(pool, worker->view);
+        SDL_SemPost(pool->done);
+    }
+    return 0;
+}
+
+static void
+SW_DestroyTilePool(SW_TilePool * pool)
+{
+    int i;
+
+    SDL_AtomicSet(&pool->quit, 1);
+    for (i = 1; i < pool->num_workers; ++i) {
+        SDL_SemPost(pool->work);
+    }
+    for (i = 0; i < pool->num_workers; ++i) {
+        if (pool->workers[i].thread) {
+            SDL_WaitThread(pool->workers[i].thread, NULL);
+        }
+        if (pool->workers[i].view) {
+            SDL_FreeSurface(pool->workers[i].view);
+        }
+    }
+    if (pool->work) {
+        SDL_DestroySemaphore(pool->work);
+    }
+    if (pool->done) {
+        SDL_DestroySemaphore(pool->done);
+    }
+    SDL_free(pool->workers);
+    SDL_free(pool->bounds);
+    SDL_free(pool->bin_start);
+    SDL_free(pool->bin_items);
+    SDL_free(pool);
+}
+
+static SW_TilePool *
+SW_CreateTilePool(int num_threads)
+{
+    SW_TilePool *pool;
+    int i;
+
+    pool = (SW_TilePool *) SDL_calloc(1, sizeof(*pool));
+    if (!pool) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    pool->workers = (SW_TileWorker *) SDL_calloc(num_threads, sizeof(*pool->workers));
+    pool->work = SDL_CreateSemaphore(0);
+    pool->done = SDL_CreateSemaphore(0);
+    if (!pool->workers || !pool->work || !pool->done) {
+        SW_DestroyTilePool(pool);
+        return NULL;
+    }
+
+    pool->workers[0].pool = pool;
+    pool->num_workers = 1;
+    for (i = 1; i < num_threads; ++i) {
+        SW_TileWorker *worker = &pool->workers[i];
+
+        worker->pool = pool;
+        worker->thread = SDL_CreateThread(SW_TileThread, "SDLRenderTiles", worker);
+        if (!worker->thread) {
+            break;
+        }
+        ++pool->num_workers;
+    }
+    if (pool->num_workers < 2) {
+        SW_DestroyTilePool(pool);
+        return NULL;
+    }
+    return pool;
+}
+
+static SDL_bool
+SW_PrepareTileViews(SW_TilePool * pool, SDL_Surface * surface)
+{
+    int i;
+
+    for (i = 0; i < pool->num_workers; ++i) {
+        SDL_Surface *view = pool->workers[i].view;
+
+        if (view && (view->pixels != surface->pixels ||
+                     view->w != surface->w || view->h != surface->h ||
+                     view->pitch != surface->pitch ||
+                     view->format->format != surface->format->format)) {
+            SDL_FreeSurface(view);
+            view = NULL;
+        }
+        if (!view) {
+            view = SDL_CreateRGBSurfaceWithFormatFrom(surface->pixels, surface->w, surface->h,
+                                                      surface->format->BitsPerPixel, surface->pitch,
+                                                      surface->format->format);
+            pool->workers[i].view = view;
+            if (!view) {
+                return SDL_FALSE;
+            }
+        }
+    }
+    return SDL_TRUE;
+}
+
+/* Find the rows of the target a command touches. Returns roughly how many
+   pixels it covers, or -1 if it has to be drawn on a single thread: lines
+   and rotated or scaled copies clip differently when cut into tiles. */
+static Sint64
+SW_GetTileBounds(SDL_Renderer * renderer, SDL_Surface * surface,
+                 const SDL_RenderCommand * cmd, const void * vertices, int * y0, int * y1)
+{
+    const void *data = (const Uint8 *) vertices + cmd->first;
+    const SDL_Rect *clip = &surface->clip_rect;
+    int miny = SDL_MAX_SINT32;
+    int maxy = SDL_MIN_SINT32;
+    Sint64 area = 0;
+    int i;
+
+    switch (cmd->command) {
+    case SDL_RENDERCMD_CLEAR:
+        *y0 = 0;
+        *y1 = surface->h - 1;
+        return (Sint64) surface->w * surface->h;
+
+    case SDL_RENDERCMD_FILL_RECTS:
+        {
+            const SDL_FRect *rects = (const SDL_FRect *) data;
+
+            for (i = 0; i < cmd->count; ++i) {
+                const int y = (int)(renderer->viewport.y + rects[i].y);
+                const int w = SDL_max((int)rects[i].w, 1);
+                const int h = SDL_max((int)rects[i].h, 1);
+
+                miny = SDL_min(miny, y);
+                maxy = SDL_max(maxy, y + h - 1);
+                area += (Sint64) w * h;
+            }
+        }
+        break;
+
+    case SDL_RENDERCMD_DRAW_POINTS:
+        {
+            const SDL_FPoint *points = (const SDL_FPoint *) data;
+
+            for (i = 0; i < cmd->count; ++i) {
+                const int y = (int)(renderer->viewport.y + points[i].y);
+
+                miny = SDL_min(miny, y);
+                maxy = SDL_max(maxy, y);
+            }
+            area = cmd->count;
+        }
+        break;
+
+    case SDL_RENDERCMD_COPY:
+        {
+            SDL_Surface *src = (SDL_Surface *) cmd->texture->driverdata;
+
+            if (cmd->srcrect.w != (int)cmd->dstrect.w || cmd->srcrect.h != (int)cmd->dstrect.h ||
+                !SDL_PrepareConcurrentBlit(src, surface)) {
+                return -1;
+            }
+            miny = (int)(renderer->viewport.y + cmd->dstrect.y);
+            maxy = miny + cmd->srcrect.h - 1;
+            area = (Sint64) cmd->srcrect.w * cmd->srcrect.h;
+        }
+        break;
+
+    case SDL_RENDERCMD_COPY_BATCH:
+        {
+            SDL_Surface *src = (SDL_Surface *) cmd->texture->driverdata;
+            const SDL_Rect *srcrects = (const SDL_Rect *) data;
+            const SDL_FRect *dstrects = (const SDL_FRect *) (srcrects + cmd->count);
+
+            /* Per copy colors change the modulation shared by the blits */
+            if (cmd->colors || !SDL_PrepareConcurrentBlit(src, surface)) {
+                return -1;
+            }
+            for (i = 0; i < cmd->count; ++i) {
+                const int y = (int)(renderer->viewport.y + dstrects[i].y);
+
+                if (srcrects[i].w != (int)dstrects[i].w || srcrects[i].h != (int)dstrects[i].h) {
+                    return -1;
+                }
+                miny = SDL_min(miny, y);
+                maxy = SDL_max(maxy, y + srcrects[i].h - 1);
+                area += (Sint64) srcrects[i].w * srcrects[i].h;
+            }
+        }
+        break;
+
+    case SDL_RENDERCMD_GEOMETRY:
+        {
+            const SDL_Vertex *verts = (const SDL_Vertex *) data;
+            float fminy = (float) surface->h, fmaxy = -1.0f;
+
+            if (cmd->texture && SDL_MUSTLOCK((SDL_Surface *) cmd->texture->driverdata)) {
+                return -1;
+            }
+            for (i = 0; i < cmd->count; ++i) {
+                const float y = renderer->viewport.y + verts[i].position.y;
+
+                fminy = SDL_min(fminy, y);
+                fmaxy = SDL_max(fmaxy, y);
+            }
+            /* One row of slack either way for the sub-pixel snapping */
+            fminy = SDL_max(-1.0f, SDL_min(fminy, (float) surface->h));
+            fmaxy = SDL_max(-1.0f, SDL_min(fmaxy, (float) surface->h));
+            miny = (int) SDL_floor(fminy) - 1;
+            maxy = (int) SDL_ceil(fmaxy) + 1;
+            area = (Sint64) (maxy - miny + 1) * clip->w / 2;
+        }
+        break;
+
+    default:
+        return -1;
+    }
+
+    *y0 = SDL_max(miny, clip->y);
+    *y1 = SDL_min(maxy, clip->y + clip->h - 1);
+    return area;
+}
+
+static SDL_bool
+SW_GrowArray(int ** array, int * allocation, int needed)
+{
+    if (needed > *allocation) {
+        int newalloc = SDL_max(*allocation * 2, needed);
+        int *ptr = (int *) SDL_realloc(*array, newalloc * sizeof(int));
+
+        if (!ptr) {
+            return SDL_FALSE;
+        }
+        *array = ptr;
+        *allocation = newalloc;
     }
+    return SDL_TRUE;
+}
+
+/* Bin the commands from the start of cmds that can be drawn tile by tile.
+   Returns how many there are; 'worthwhile' is set if they were binned and
+   cover enough of the target to split them across threads. */
+static int
+SW_BinCommands(SDL_Renderer * renderer, SW_TilePool * pool, SDL_Surface * surface,
+               const SDL_RenderCommand * cmds, int count, const void * vertices,
+               SDL_bool * worthwhile)
+{
+    Sint64 pixels = 0;
+    int i, n, tile, num_tiles;
+
+    *worthwhile = SDL_FALSE;
+
+    if (!SW_GrowArray(&pool->bounds, &pool->bounds_allocation, count * 2)) {
+        return 0;
+    }
+    for (n = 0; n < count; ++n) {
+        Sint64 area = SW_GetTileBounds(renderer, surface, &cmds[n], vertices,
+                                       &pool->bounds[n * 2], &pool->bounds[n * 2 + 1]);
+        if (area < 0) {
+            break;
+        }
+        pixels += area;
+    }
+    if (n == 0 || pixels < SW_MIN_TILED_PIXELS) {
+        return n;
+    }
+
+    num_tiles = (surface->h + SW_TILE_ROWS - 1) / SW_TILE_ROWS;
+    if (!SW_GrowArray(&pool->bin_start, &pool->bin_start_allocation, num_tiles + 1)) {
+        return n;
+    }
+    SDL_memset(pool->bin_start, 0, (num_tiles + 1) * sizeof(int));
+
+    /* Count the commands per tile, then hand out slots in queue order */
+    for (i = 0; i < n; ++i) {
+        const int y0 = pool->bounds[i * 2], y1 = pool->bounds[i * 2 + 1];
+
+        if (y0 <= y1) {
+            for (tile = y0 / SW_TILE_ROWS; tile <= y1 / SW_TILE_ROWS; ++tile) {
+                ++pool->bin_start[tile + 1];
+            }
+        }
+    }
+    for (tile = 0; tile < num_tiles; ++tile) {
+        pool->bin_start[tile + 1] += pool->bin_start[tile];
+    }
+    if (!SW_GrowArray(&pool->bin_items, &pool->bin_items_allocation, pool->bin_start[num_tiles])) {
+        return n;
+    }
+    for (i = 0; i < n; ++i) {
+        const int y0 = pool->bounds[i * 2], y1 = pool->bounds[i * 2 + 1];
+
+        if (y0 <= y1) {
+            for (tile = y0 / SW_TILE_ROWS; tile <= y1 / SW_TILE_ROWS; ++tile) {
+                pool->bin_items[pool->bin_start[tile]++] = i;
+            }
+        }
+    }
+    /* Each start now holds the end of its tile, shift them back */
+    for (tile = num_tiles; tile > 0; --tile) {
+        pool->bin_start[tile] = pool->bin_start[tile - 1];
+    }
+    pool->bin_start[0] = 0;
+
+    pool->num_tiles = num_tiles;
+    *worthwhile = SDL_TRUE;
+    return n;
+}
+
+static int
+SW_DrawTiled(SDL_Renderer * renderer, SW_TilePool * pool, SDL_Surface * surface,
+             const SDL_RenderCommand * cmds, const void * vertices)
+{
+    int i;
+
+    pool->surface = surface;
+    pool->viewport = renderer->viewport;
+    pool->cmds = cmds;
+    pool->vertices = vertices;
+    SDL_AtomicSet(&pool->next_tile, 0);
+    SDL_AtomicSet(&pool->status, 0);
+
+    for (i = 1; i < pool->num_workers; ++i) {
+        SDL_SemPost(pool->work);
+    }
+    SW_DrawTiles(pool, pool->workers[0].view);
+    for (i = 1; i < pool->num_workers; ++i) {
+        SDL_SemWait(pool->done);
+    }
+
+    if (SDL_AtomicGet(&pool->status) < 0) {
+        return SDL_SetError("Couldn't draw some of the render tiles");
+    }
+    return 0;
+}
+
+/* Only the rows of tiled commands are known, mark them across the clip rect */
+static void
+SW_AddDirtyTiled(SDL_Renderer * renderer, SW_TilePool * pool, SDL_Surface * surface,
+                 const SDL_RenderCommand * cmds, int count)
+{
+    SDL_Rect rect;
+    int i;
+
+    for (i = 0; i < count; ++i) {
+        if (cmds[i].command == SDL_RENDERCMD_CLEAR) {
+            if (surface == ((SW_RenderData *) renderer->driverdata)->window) {
+                SW_SetAllDirty(renderer);
+            }
+            return;
+        }
+        rect.x = surface->clip_rect.x;
+        rect.y = pool->bounds[i * 2];
+        rect.w = surface->clip_rect.w;
+        rect.h = pool->bounds[i * 2 + 1] - rect.y + 1;
+        SW_AddDirtyRect(renderer, surface, &rect);
+    }
+}
+
+static int
+SW_RunCommandQueue(SDL_Renderer * renderer, const SDL_RenderCommand * cmds,
+                   int count, const void * vertices)
+{
+    SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
+    SDL_Surface *surface = SW_ActivateRenderer(renderer);
+    SW_TilePool *pool = NULL;
+    int i, n;
+    int retval = 0;
+
+    if (!surface) {
+        return -1;
+    }
+
+    if (data->num_threads > 1 && SW_CanDrawTiled(surface)) {
+        if (!data->pool) {
+            data->pool = SW_CreateTilePool(data->num_threads);
+            if (!data->pool) {
+                /* Don't try again on every flush */
+                data->num_threads = 1;
+            }
+        }
+        if (data->pool && SW_PrepareTileViews(data->pool, surface)) {
+            pool = data->pool;
+        }
+    }
+    if (!pool) {
+        return SW_RunCommands(renderer, surface, cmds, count, vertices);
+    }
+
+    for (i = 0; i < count; i += n) {
+        SDL_bool worthwhile;
+
+        n = SW_BinCommands(renderer, pool, surface, &cmds[i], count - i, vertices, &worthwhile);
+        if (worthwhile) {
+            if (SW_DrawTiled(renderer, pool, surface, &cmds[i], vertices) < 0) {
+                retval = -1;
+            }
+            SW_AddDirtyTiled(renderer, pool, surface, &cmds[i], n);
+        } else {
+            n = SDL_max(n, 1);
+            if (SW_RunCommands(renderer, surface, &cmds[i], n, vertices) < 0) {
+                retval = -1;
+            }
+        }
+    }
+    return retval;
 }
 
 static void
@@ -885,6 +1874,9 @@ SW_DestroyRenderer(SDL_Renderer * renderer)
 {
     SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
 
+    if (data && data->pool) {
+        SW_DestroyTilePool(data->pool);
+    }
     SDL_free(data);
     SDL_free(renderer);
 }
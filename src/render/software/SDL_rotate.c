@@ -205,6 +205,304 @@ transformSurfaceY90(SDL_Surface * src, SDL_Surface * dst, int angle, int flipx,
 
 #undef TRANSFORM_SURFACE_90
 
+#ifdef __SSE2__
+#define HAVE_SSE2_INTRINSICS 1
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define HAVE_NEON_INTRINSICS 1
+#endif
+
+/* !
+\brief Returns a / b rounded towards negative infinity, for b > 0.
+*/
+static Sint64
+_floorDiv(Sint64 a, Sint64 b)
+{
+    return (a >= 0) ? (a / b) : -((b - 1 - a) / b);
+}
+
+/* !
+\brief Narrows a scanline span to the pixels that map into a range of source coordinates.
+
+The source coordinate of destination pixel x is (s + x * inc) >> 16, so the pixels for
+which it lies within [lo, hi] form a single run. The run is solved for once per scanline
+and intersected with [*x0, *x1), which lets the span loops skip per pixel bounds tests.
+
+\param s 16.16 source coordinate of the first pixel of the scanline.
+\param inc 16.16 source coordinate step per destination pixel.
+\param lo Lowest valid source coordinate.
+\param hi Highest valid source coordinate.
+\param x0 First pixel of the span, updated in place.
+\param x1 Pixel past the end of the span, updated in place.
+*/
+static void
+_clipSpan(int s, int inc, int lo, int hi, int *x0, int *x1)
+{
+    Sint64 l = ((Sint64)lo << 16) - s;
+    Sint64 h = ((Sint64)hi << 16) + 0xffff - s;
+    Sint64 step = inc, start, end;
+
+    if (step == 0) {
+        if (l > 0 || h < 0) {
+            *x1 = *x0;
+        }
+        return;
+    }
+    if (step < 0) {
+        Sint64 t = l;
+        l = -h;
+        h = -t;
+        step = -step;
+    }
+    start = -_floorDiv(-l, step);
+    end = _floorDiv(h, step) + 1;
+    if (start > *x0) {
+        *x0 = (int)SDL_min(start, *x1);
+    }
+    if (end < *x1) {
+        *x1 = (int)SDL_max(end, *x0);
+    }
+}
+
+/* !
+\brief Copies a span of pixels without smoothing.
+
+All pixels of the span must map into the source surface. Mirroring is folded into the
+16.16 start coordinate and step, as sw - (sdx >> 16) == ((sw << 16) + 0xffff - sdx) >> 16.
+*/
+#define TRANSFORM_SPAN_NEAREST(pixelType)                                                                   \
+    const Uint8 *sp = (const Uint8 *)src->pixels;                                                           \
+    int x;                                                                                                  \
+                                                                                                            \
+    if (flipx) {                                                                                            \
+        sdx = ((src->w - 1) << 16) + 0xffff - sdx;                                                          \
+        icos = -icos;                                                                                       \
+    }                                                                                                       \
+    if (flipy) {                                                                                            \
+        sdy = ((src->h - 1) << 16) + 0xffff - sdy;                                                          \
+        isin = -isin;                                                                                       \
+    }                                                                                                       \
+    for (x = 0; x + 4 <= n; x += 4) {                                                                       \
+        pc[x + 0] = ((const pixelType *)(sp + src->pitch * (sdy >> 16)))[sdx >> 16];                        \
+        sdx += icos; sdy += isin;                                                                           \
+        pc[x + 1] = ((const pixelType *)(sp + src->pitch * (sdy >> 16)))[sdx >> 16];                        \
+        sdx += icos; sdy += isin;                                                                           \
+        pc[x + 2] = ((const pixelType *)(sp + src->pitch * (sdy >> 16)))[sdx >> 16];                        \
+        sdx += icos; sdy += isin;                                                                           \
+        pc[x + 3] = ((const pixelType *)(sp + src->pitch * (sdy >> 16)))[sdx >> 16];                        \
+        sdx += icos; sdy += isin;                                                                           \
+    }                                                                                                       \
+    for (; x < n; x++) {                                                                                    \
+        pc[x] = ((const pixelType *)(sp + src->pitch * (sdy >> 16)))[sdx >> 16];                            \
+        sdx += icos; sdy += isin;                                                                           \
+    }
+
+static void
+transformSpanRGBA(SDL_Surface * src, tColorRGBA *pc, int n, int sdx, int sdy, int isin, int icos, int flipx, int flipy)
+{
+    TRANSFORM_SPAN_NEAREST(tColorRGBA);
+}
+
+static void
+transformSpanY(SDL_Surface * src, tColorY *pc, int n, int sdx, int sdy, int isin, int icos, int flipx, int flipy)
+{
+    TRANSFORM_SPAN_NEAREST(tColorY);
+}
+
+#undef TRANSFORM_SPAN_NEAREST
+
+/* !
+\brief Interpolates a span of pixels from the 2x2 source pixels around each sample.
+
+All pixels of the span must map into the source surface with a neighbour to the right
+and below. The SIMD versions give exactly the same results.
+*/
+static void
+transformSpanSmoothRGBA(SDL_Surface * src, tColorRGBA *pc, int n, int sdx, int sdy, int isin, int icos, int flipx, int flipy)
+{
+    int x, t1, t2, dx, dy, ex, ey;
+    tColorRGBA c00, c01, c10, c11, cswap;
+    tColorRGBA *sp;
+
+    for (x = 0; x < n; x++) {
+        dx = (sdx >> 16);
+        dy = (sdy >> 16);
+        if (flipx) dx = (src->w - 1) - dx;
+        if (flipy) dy = (src->h - 1) - dy;
+        sp = (tColorRGBA *) ((Uint8 *) src->pixels + src->pitch * dy) + dx;
+        c00 = *sp;
+        sp += 1;
+        c01 = *sp;
+        sp += (src->pitch/4);
+        c11 = *sp;
+        sp -= 1;
+        c10 = *sp;
+        if (flipx) {
+            cswap = c00; c00=c01; c01=cswap;
+            cswap = c10; c10=c11; c11=cswap;
+        }
+        if (flipy) {
+            cswap = c00; c00=c10; c10=cswap;
+            cswap = c01; c01=c11; c11=cswap;
+        }
+        /*
+        * Interpolate colors
+        */
+        ex = (sdx & 0xffff);
+        ey = (sdy & 0xffff);
+        t1 = ((((c01.r - c00.r) * ex) >> 16) + c00.r) & 0xff;
+        t2 = ((((c11.r - c10.r) * ex) >> 16) + c10.r) & 0xff;
+        pc->r = (((t2 - t1) * ey) >> 16) + t1;
+        t1 = ((((c01.g - c00.g) * ex) >> 16) + c00.g) & 0xff;
+        t2 = ((((c11.g - c10.g) * ex) >> 16) + c10.g) & 0xff;
+        pc->g = (((t2 - t1) * ey) >> 16) + t1;
+        t1 = ((((c01.b - c00.b) * ex) >> 16) + c00.b) & 0xff;
+        t2 = ((((c11.b - c10.b) * ex) >> 16) + c10.b) & 0xff;
+        pc->b = (((t2 - t1) * ey) >> 16) + t1;
+        t1 = ((((c01.a - c00.a) * ex) >> 16) + c00.a) & 0xff;
+        t2 = ((((c11.a - c10.a) * ex) >> 16) + c10.a) & 0xff;
+        pc->a = (((t2 - t1) * ey) >> 16) + t1;
+        sdx += icos;
+        sdy += isin;
+        pc++;
+    }
+}
+
+#if HAVE_SSE2_INTRINSICS
+/* ((b - a) * f >> 16) + a per 16 bit lane, with f an unsigned 16 bit weight.
+   _mm_mulhi_epi16 sees weights from 0x8000 up as f - 0x10000, which takes
+   exactly (b - a) off the product's high half, so that is added back. */
+static __m128i
+lerpLanesSSE2(__m128i a, __m128i b, __m128i f)
+{
+    const __m128i d = _mm_sub_epi16(b, a);
+    const __m128i p = _mm_mulhi_epi16(d, f);
+    return _mm_add_epi16(_mm_add_epi16(p, _mm_and_si128(d, _mm_srai_epi16(f, 15))), a);
+}
+
+/* Two pixels at a time: the 2x2 neighbourhoods are loaded as pairs of
+   adjacent pixels, mirrored by picking the other pixel of each pair. */
+static void
+transformSpanSmoothRGBA_SSE2(SDL_Surface * src, tColorRGBA *pc, int n, int sdx, int sdy, int isin, int icos, int flipx, int flipy)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const Uint8 *pixels = (const Uint8 *)src->pixels;
+    const int pitch = src->pitch;
+    int x;
+
+    for (x = 0; x + 2 <= n; x += 2) {
+        const int sdx1 = sdx + icos, sdy1 = sdy + isin;
+        int dx0 = (sdx >> 16), dy0 = (sdy >> 16);
+        int dx1 = (sdx1 >> 16), dy1 = (sdy1 >> 16);
+        const Uint8 *sp0, *sp1;
+        __m128i top, bottom, tl, tr, bl, br, fx, fy, t1, t2;
+
+        if (flipx) {
+            dx0 = (src->w - 1) - dx0;
+            dx1 = (src->w - 1) - dx1;
+        }
+        if (flipy) {
+            dy0 = (src->h - 1) - dy0;
+            dy1 = (src->h - 1) - dy1;
+        }
+        sp0 = pixels + pitch * dy0 + dx0 * 4;
+        sp1 = pixels + pitch * dy1 + dx1 * 4;
+
+        /* Both pixel pairs of a row side by side: c00 c01 of the first and the second sample */
+        top = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *)sp0), _mm_loadl_epi64((const __m128i *)sp1));
+        bottom = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *)(sp0 + pitch)), _mm_loadl_epi64((const __m128i *)(sp1 + pitch)));
+        if (flipy) {
+            __m128i swap = top;
+            top = bottom;
+            bottom = swap;
+        }
+        if (flipx) {
+            tl = _mm_shuffle_epi32(top, _MM_SHUFFLE(3, 1, 3, 1));
+            tr = _mm_shuffle_epi32(top, _MM_SHUFFLE(2, 0, 2, 0));
+            bl = _mm_shuffle_epi32(bottom, _MM_SHUFFLE(3, 1, 3, 1));
+            br = _mm_shuffle_epi32(bottom, _MM_SHUFFLE(2, 0, 2, 0));
+        } else {
+            tl = _mm_shuffle_epi32(top, _MM_SHUFFLE(2, 0, 2, 0));
+            tr = _mm_shuffle_epi32(top, _MM_SHUFFLE(3, 1, 3, 1));
+            bl = _mm_shuffle_epi32(bottom, _MM_SHUFFLE(2, 0, 2, 0));
+            br = _mm_shuffle_epi32(bottom, _MM_SHUFFLE(3, 1, 3, 1));
+        }
+        tl = _mm_unpacklo_epi8(tl, zero);
+        tr = _mm_unpacklo_epi8(tr, zero);
+        bl = _mm_unpacklo_epi8(bl, zero);
+        br = _mm_unpacklo_epi8(br, zero);
+
+        fx = _mm_unpacklo_epi64(_mm_set1_epi16((short)(sdx & 0xffff)), _mm_set1_epi16((short)(sdx1 & 0xffff)));
+        fy = _mm_unpacklo_epi64(_mm_set1_epi16((short)(sdy & 0xffff)), _mm_set1_epi16((short)(sdy1 & 0xffff)));
+
+        /* The interpolated values stay within their endpoints, so they pack without saturating */
+        t1 = lerpLanesSSE2(tl, tr, fx);
+        t2 = lerpLanesSSE2(bl, br, fx);
+        _mm_storel_epi64((__m128i *)(pc + x), _mm_packus_epi16(lerpLanesSSE2(t1, t2, fy), zero));
+
+        sdx = sdx1 + icos;
+        sdy = sdy1 + isin;
+    }
+    if (x < n) {
+        transformSpanSmoothRGBA(src, pc + x, n - x, sdx, sdy, isin, icos, flipx, flipy);
+    }
+}
+#endif /* HAVE_SSE2_INTRINSICS */
+
+#if HAVE_NEON_INTRINSICS
+static void
+transformSpanSmoothRGBA_NEON(SDL_Surface * src, tColorRGBA *pc, int n, int sdx, int sdy, int isin, int icos, int flipx, int flipy)
+{
+    const Uint8 *pixels = (const Uint8 *)src->pixels;
+    const int pitch = src->pitch;
+    int x;
+
+    for (x = 0; x < n; x++) {
+        int dx = (sdx >> 16), dy = (sdy >> 16);
+        const Uint8 *sp;
+        uint8x8_t top, bottom;
+        int16x8_t t, b;
+        int32x4_t tl, tr, bl, br, t1, t2, out;
+        uint16x4_t narrow;
+
+        if (flipx) dx = (src->w - 1) - dx;
+        if (flipy) dy = (src->h - 1) - dy;
+        sp = pixels + pitch * dy + dx * 4;
+
+        /* c00 c01 and c10 c11 as pairs of adjacent pixels */
+        top = vld1_u8(sp);
+        bottom = vld1_u8(sp + pitch);
+        if (flipy) {
+            uint8x8_t swap = top;
+            top = bottom;
+            bottom = swap;
+        }
+        if (flipx) {
+            top = vext_u8(top, top, 4);
+            bottom = vext_u8(bottom, bottom, 4);
+        }
+        t = vreinterpretq_s16_u16(vmovl_u8(top));
+        b = vreinterpretq_s16_u16(vmovl_u8(bottom));
+        tl = vmovl_s16(vget_low_s16(t));
+        tr = vmovl_s16(vget_high_s16(t));
+        bl = vmovl_s16(vget_low_s16(b));
+        br = vmovl_s16(vget_high_s16(b));
+
+        t1 = vaddq_s32(vshrq_n_s32(vmulq_n_s32(vsubq_s32(tr, tl), sdx & 0xffff), 16), tl);
+        t2 = vaddq_s32(vshrq_n_s32(vmulq_n_s32(vsubq_s32(br, bl), sdx & 0xffff), 16), bl);
+        out = vaddq_s32(vshrq_n_s32(vmulq_n_s32(vsubq_s32(t2, t1), sdy & 0xffff), 16), t1);
+
+        narrow = vmovn_u32(vreinterpretq_u32_s32(out));
+        vst1_lane_u32((uint32_t *)(pc + x), vreinterpret_u32_u8(vmovn_u16(vcombine_u16(narrow, narrow))), 0);
+
+        sdx += icos;
+        sdy += isin;
+    }
+}
+#endif /* HAVE_NEON_INTRINSICS */
+
 /* !
 \brief Internal 32 bit rotozoomer with optional anti-aliasing.
 
@@ -227,10 +525,10 @@ Assumes dst surface was allocated with the correct dimensions.
 static void
 _transformSurfaceRGBA(SDL_Surface * src, SDL_Surface * dst, int cx, int cy, int isin, int icos, int flipx, int flipy, int smooth)
 {
-    int x, y, t1, t2, dx, dy, xd, yd, sdx, sdy, ax, ay, ex, ey, sw, sh;
-    tColorRGBA c00, c01, c10, c11, cswap;
-    tColorRGBA *pc, *sp;
-    int gap;
+    void (*transformSpan)(SDL_Surface *, tColorRGBA *, int, int, int, int, int, int, int);
+    int y, x0, x1, dy, xd, yd, sdx, sdy, ax, ay;
+    int xlo, xhi, ylo, yhi;
+    tColorRGBA *pc;
 
     /*
     * Variable setup
@@ -239,84 +537,52 @@ _transformSurfaceRGBA(SDL_Surface * src, SDL_Surface * dst, int cx, int cy, int
     yd = ((src->h - dst->h) << 15);
     ax = (cx << 16) - (icos * cx);
     ay = (cy << 16) - (isin * cx);
-    sw = src->w - 1;
-    sh = src->h - 1;
     pc = (tColorRGBA*) dst->pixels;
-    gap = dst->pitch - dst->w * 4;
 
     /*
-    * Switch between interpolating and non-interpolating code
+    * Switch between interpolating and non-interpolating code. Interpolation
+    * needs the source pixel to the right and below, after mirroring.
     */
     if (smooth) {
-        for (y = 0; y < dst->h; y++) {
-            dy = cy - y;
-            sdx = (ax + (isin * dy)) + xd;
-            sdy = (ay - (icos * dy)) + yd;
-            for (x = 0; x < dst->w; x++) {
-                dx = (sdx >> 16);
-                dy = (sdy >> 16);
-                if (flipx) dx = sw - dx;
-                if (flipy) dy = sh - dy;
-                if ((dx > -1) && (dy > -1) && (dx < (src->w-1)) && (dy < (src->h-1))) {
-                    sp = (tColorRGBA *) ((Uint8 *) src->pixels + src->pitch * dy) + dx;
-                    c00 = *sp;
-                    sp += 1;
-                    c01 = *sp;
-                    sp += (src->pitch/4);
-                    c11 = *sp;
-                    sp -= 1;
-                    c10 = *sp;
-                    if (flipx) {
-                        cswap = c00; c00=c01; c01=cswap;
-                        cswap = c10; c10=c11; c11=cswap;
-                    }
-                    if (flipy) {
-                        cswap = c00; c00=c10; c10=cswap;
-                        cswap = c01; c01=c11; c11=cswap;
-                    }
-                    /*
-                    * Interpolate colors
-                    */
-                    ex = (sdx & 0xffff);
-                    ey = (sdy & 0xffff);
-                    t1 = ((((c01.r - c00.r) * ex) >> 16) + c00.r) & 0xff;
-                    t2 = ((((c11.r - c10.r) * ex) >> 16) + c10.r) & 0xff;
-                    pc->r = (((t2 - t1) * ey) >> 16) + t1;
-                    t1 = ((((c01.g - c00.g) * ex) >> 16) + c00.g) & 0xff;
-                    t2 = ((((c11.g - c10.g) * ex) >> 16) + c10.g) & 0xff;
-                    pc->g = (((t2 - t1) * ey) >> 16) + t1;
-                    t1 = ((((c01.b - c00.b) * ex) >> 16) + c00.b) & 0xff;
-                    t2 = ((((c11.b - c10.b) * ex) >> 16) + c10.b) & 0xff;
-                    pc->b = (((t2 - t1) * ey) >> 16) + t1;
-                    t1 = ((((c01.a - c00.a) * ex) >> 16) + c00.a) & 0xff;
-                    t2 = ((((c11.a - c10.a) * ex) >> 16) + c10.a) & 0xff;
-                    pc->a = (((t2 - t1) * ey) >> 16) + t1;
-                }
-                sdx += icos;
-                sdy += isin;
-                pc++;
-            }
-            pc = (tColorRGBA *) ((Uint8 *) pc + gap);
+        xlo = flipx ? 1 : 0;
+        xhi = flipx ? src->w - 1 : src->w - 2;
+        ylo = flipy ? 1 : 0;
+        yhi = flipy ? src->h - 1 : src->h - 2;
+        transformSpan = transformSpanSmoothRGBA;
+#if HAVE_SSE2_INTRINSICS
+        if (SDL_HasSSE2()) {
+            transformSpan = transformSpanSmoothRGBA_SSE2;
+        }
+#endif
+#if HAVE_NEON_INTRINSICS
+        if (SDL_HasNEON()) {
+            transformSpan = transformSpanSmoothRGBA_NEON;
         }
+#endif
     } else {
-        for (y = 0; y < dst->h; y++) {
-            dy = cy - y;
-            sdx = (ax + (isin * dy)) + xd;
-            sdy = (ay - (icos * dy)) + yd;
-            for (x = 0; x < dst->w; x++) {
-                dx = (sdx >> 16);
-                dy = (sdy >> 16);
-                if ((unsigned)dx < (unsigned)src->w && (unsigned)dy < (unsigned)src->h) {
-                    if(flipx) dx = sw - dx;
-                    if(flipy) dy = sh - dy;
-                    *pc = *((tColorRGBA *)((Uint8 *)src->pixels + src->pitch * dy) + dx);
-                }
-                sdx += icos;
-                sdy += isin;
-                pc++;
-            }
-            pc = (tColorRGBA *) ((Uint8 *) pc + gap);
+        xlo = 0;
+        xhi = src->w - 1;
+        ylo = 0;
+        yhi = src->h - 1;
+        transformSpan = transformSpanRGBA;
+    }
+
+    /*
+    * Iterate through destination surface, only visiting the span of each
+    * scanline that maps into the source surface
+    */
+    for (y = 0; y < dst->h; y++) {
+        dy = cy - y;
+        sdx = (ax + (isin * dy)) + xd;
+        sdy = (ay - (icos * dy)) + yd;
+        x0 = 0;
+        x1 = dst->w;
+        _clipSpan(sdx, icos, xlo, xhi, &x0, &x1);
+        _clipSpan(sdy, isin, ylo, yhi, &x0, &x1);
+        if (x0 < x1) {
+            transformSpan(src, pc + x0, x1 - x0, sdx + x0 * icos, sdy + x0 * isin, isin, icos, flipx, flipy);
         }
+        pc = (tColorRGBA *) ((Uint8 *) pc + dst->pitch);
     }
 }
 
@@ -341,9 +607,8 @@ Assumes dst surface was allocated with the correct dimensions.
 static void
 transformSurfaceY(SDL_Surface * src, SDL_Surface * dst, int cx, int cy, int isin, int icos, int flipx, int flipy)
 {
-    int x, y, dx, dy, xd, yd, sdx, sdy, ax, ay;
+    int y, x0, x1, dy, xd, yd, sdx, sdy, ax, ay;
     tColorY *pc;
-    int gap;
 
     /*
     * Variable setup
@@ -353,7 +618,6 @@ transformSurfaceY(SDL_Surface * src, SDL_Surface * dst, int cx, int cy, int isin
     ax = (cx << 16) - (icos * cx);
     ay = (cy << 16) - (isin * cx);
     pc = (tColorY*) dst->pixels;
-    gap = dst->pitch - dst->w;
     /*
     * Clear surface to colorkey
     */
@@ -365,19 +629,14 @@ transformSurfaceY(SDL_Surface * src, SDL_Surface * dst, int cx, int cy, int isin
         dy = cy - y;
         sdx = (ax + (isin * dy)) + xd;
         sdy = (ay - (icos * dy)) + yd;
-        for (x = 0; x < dst->w; x++) {
-            dx = (sdx >> 16);
-            dy = (sdy >> 16);
-            if ((unsigned)dx < (unsigned)src->w && (unsigned)dy < (unsigned)src->h) {
-                if (flipx) dx = (src->w-1)-dx;
-                if (flipy) dy = (src->h-1)-dy;
-                *pc = *((tColorY *)src->pixels + src->pitch * dy + dx);
-            }
-            sdx += icos;
-            sdy += isin;
-            pc++;
+        x0 = 0;
+        x1 = dst->w;
+        _clipSpan(sdx, icos, 0, src->w - 1, &x0, &x1);
+        _clipSpan(sdy, isin, 0, src->h - 1, &x0, &x1);
+        if (x0 < x1) {
+            transformSpanY(src, pc + x0, x1 - x0, sdx + x0 * icos, sdy + x0 * isin, isin, icos, flipx, flipy);
         }
-        pc += gap;
+        pc += dst->pitch;
     }
 }
 
@@ -0,0 +1,472 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2017 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../../SDL_internal.h"
+
+#if !SDL_RENDER_DISABLED
+
+#include "SDL_draw.h"
+#include "SDL_triangle.h"
+
+/* Triangle rasterizer for the software renderer.
+
+   Vertex positions are snapped to 1/16 pixel and the three edge functions are
+   evaluated exactly in 64-bit integers at pixel centers, so triangles sharing
+   an edge never overlap or leave gaps. Every scanline is reduced to a single
+   span up front; colors and texture coordinates are then stepped across the
+   span in fixed point, writing the destination row front to back.
+*/
+
+#define SUBPIXEL_BITS   4
+#define SUBPIXEL_ONE    (1 << SUBPIXEL_BITS)
+#define SUBPIXEL_HALF   (SUBPIXEL_ONE / 2)
+
+/* Interpolated colors are 16.16, texture coordinates 20.12 fixed point */
+#define COLOR_BITS      16
+#define TEXEL_BITS      12
+
+/* Keep positions and texel coordinates inside the fixed point ranges */
+#define MAX_COORD       (1 << 20)
+#define MAX_TEXCOORD    8.0f
+
+typedef struct
+{
+    Sint64 stepx;       /* change of the edge function per pixel in x */
+    Sint64 stepy;       /* change of the edge function per pixel in y */
+    Sint64 origin;      /* value at the center of pixel (0,0), fill rule included */
+} TriangleEdge;
+
+typedef struct
+{
+    float dx, dy;       /* change per pixel */
+    float origin;       /* value at the center of pixel (0,0) */
+} TrianglePlane;
+
+typedef struct
+{
+    SDL_Surface *dst;
+    SDL_Surface *src;
+    SDL_Rect clip;
+    SDL_BlendMode blendMode;
+    int offsetx, offsety;
+    SDL_Color mod;
+} TriangleContext;
+
+static Sint64
+FloorDiv(Sint64 a, Sint64 b)
+{
+    /* b is always positive here */
+    Sint64 q = a / b;
+    if ((a % b) != 0 && a < 0) {
+        --q;
+    }
+    return q;
+}
+
+static int
+SnapCoord(float value, int offset)
+{
+    float v = (value + offset) * SUBPIXEL_ONE;
+
+    if (v < -MAX_COORD * (float)SUBPIXEL_ONE) {
+        v = -MAX_COORD * (float)SUBPIXEL_ONE;
+    } else if (v > MAX_COORD * (float)SUBPIXEL_ONE) {
+        v = MAX_COORD * (float)SUBPIXEL_ONE;
+    }
+    return (int)SDL_floor(v + 0.5f);
+}
+
+static void
+SetupEdge(TriangleEdge *edge, int ax, int ay, int bx, int by)
+{
+    const Sint64 dx = (Sint64)bx - ax;
+    const Sint64 dy = (Sint64)by - ay;
+
+    /* E(p) = dx * (p.y - a.y) - dy * (p.x - a.x), positive inside. Pixels
+       exactly on the edge belong to only one of the two triangles sharing it. */
+    edge->stepx = -dy * SUBPIXEL_ONE;
+    edge->stepy = dx * SUBPIXEL_ONE;
+    edge->origin = dx * (SUBPIXEL_HALF - ay) - dy * (SUBPIXEL_HALF - ax);
+    if (!(dy < 0 || (dy == 0 && dx > 0))) {
+        edge->origin -= 1;
+    }
+}
+
+/* Narrow [*left, *right] to the pixels of the row where the edge is inside */
+static void
+ClipSpanToEdge(const TriangleEdge *edge, int y, int *left, int *right)
+{
+    const Sint64 k = edge->origin + edge->stepy * y;
+
+    if (edge->stepx > 0) {
+        /* k + stepx * x >= 0  <=>  x >= ceil(-k / stepx) */
+        Sint64 x = -FloorDiv(k, edge->stepx);
+        if (x > *left) {
+            *left = (x > *right) ? *right + 1 : (int)x;
+        }
+    } else if (edge->stepx < 0) {
+        /* x <= floor(k / -stepx) */
+        Sint64 x = FloorDiv(k, -edge->stepx);
+        if (x < *right) {
+            *right = (x < *left) ? *left - 1 : (int)x;
+        }
+    } else if (k < 0) {
+        *right = *left - 1;
+    }
+}
+
+static void
+SetupPlane(TrianglePlane *plane, const float x[3], const float y[3], float det,
+           float f0, float f1, float f2)
+{
+    plane->dx = ((f1 - f0) * (y[2] - y[0]) - (f2 - f0) * (y[1] - y[0])) / det;
+    plane->dy = ((f2 - f0) * (x[1] - x[0]) - (f1 - f0) * (x[2] - x[0])) / det;
+    plane->origin = f0 + plane->dx * (0.5f - x[0]) + plane->dy * (0.5f - y[0]);
+}
+
+static SDL_INLINE Sint32
+PlaneFixed(const TrianglePlane *plane, int x, int y, int bits)
+{
+    return (Sint32)((plane->origin + plane->dx * x + plane->dy * y) * (1 << bits));
+}
+
+static SDL_INLINE int
+ClampColor(Sint32 value)
+{
+    value >>= COLOR_BITS;
+    return (value < 0) ? 0 : (value > 255) ? 255 : value;
+}
+
+static SDL_INLINE int
+ClampTexel(Sint32 value, int size)
+{
+    value >>= TEXEL_BITS;
+    return (value < 0) ? 0 : (value >= size) ? size - 1 : value;
+}
+
+#define BLEND_PIXEL(dstp, dstbpp, dstfmt)                                   \
+do {                                                                        \
+    Uint32 dstpixel;                                                        \
+    unsigned dR, dG, dB, dA;                                                \
+    switch (blendMode) {                                                    \
+    case SDL_BLENDMODE_BLEND:                                               \
+        DISEMBLE_RGBA(dstp, dstbpp, dstfmt, dstpixel, dR, dG, dB, dA);      \
+        sR = (sR * sA) / 255;                                               \
+        sG = (sG * sA) / 255;                                               \
+        sB = (sB * sA) / 255;                                               \
+        dR = sR + ((255 - sA) * dR) / 255;                                  \
+        dG = sG + ((255 - sA) * dG) / 255;                                  \
+        dB = sB + ((255 - sA) * dB) / 255;                                  \
+        dA = sA + ((255 - sA) * dA) / 255;                                  \
+        break;                                                              \
+    case SDL_BLENDMODE_ADD:                                                 \
+        DISEMBLE_RGBA(dstp, dstbpp, dstfmt, dstpixel, dR, dG, dB, dA);      \
+        dR = dR + (sR * sA) / 255; if (dR > 255) dR = 255;                  \
+        dG = dG + (sG * sA) / 255; if (dG > 255) dG = 255;                  \
+        dB = dB + (sB * sA) / 255; if (dB > 255) dB = 255;                  \
+        break;                                                              \
+    case SDL_BLENDMODE_MOD:                                                 \
+        DISEMBLE_RGBA(dstp, dstbpp, dstfmt, dstpixel, dR, dG, dB, dA);      \
+        dR = (sR * dR) / 255;                                               \
+        dG = (sG * dG) / 255;                                               \
+        dB = (sB * dB) / 255;                                               \
+        break;                                                              \
+    default:                                                                \
+        dR = sR; dG = sG; dB = sB; dA = sA;                                 \
+        break;                                                              \
+    }                                                                       \
+    (void) dstpixel;                                                        \
+    ASSEMBLE_RGBA(dstp, dstbpp, dstfmt, dR, dG, dB, dA);                    \
+} while (0)
+
+/* Flat colored, unblended span: the common particle/solid case */
+static void
+FillSpan(Uint8 *dstp, int dstbpp, Uint32 pixel, int count)
+{
+    switch (dstbpp) {
+    case 4:
+        {
+            Uint32 *p = (Uint32 *)dstp;
+            while (count--) {
+                *p++ = pixel;
+            }
+        }
+        break;
+    case 2:
+        {
+            Uint16 *p = (Uint16 *)dstp;
+            while (count--) {
+                *p++ = (Uint16)pixel;
+            }
+        }
+        break;
+    case 1:
+        SDL_memset(dstp, (Uint8)pixel, count);
+        break;
+    default:
+        while (count--) {
+            SDL_memcpy(dstp, &pixel, dstbpp);
+            dstp += dstbpp;
+        }
+        break;
+    }
+}
+
+static void
+RasterizeTriangle(const TriangleContext *ctx, const SDL_Vertex *v0,
+                  const SDL_Vertex *v1, const SDL_Vertex *v2)
+{
+    SDL_Surface *dst = ctx->dst;
+    SDL_Surface *src = ctx->src;
+    const SDL_PixelFormat *dstfmt = dst->format;
+    const int dstbpp = dstfmt->BytesPerPixel;
+    const SDL_BlendMode blendMode = ctx->blendMode;
+    const SDL_Vertex *v[3];
+    int X[3], Y[3];
+    float fx[3], fy[3], det;
+    SDL_Color c[3];
+    TriangleEdge edges[3];
+    TrianglePlane planes[6];
+    SDL_bool flat, white;
+    int minx, maxx, miny, maxy;
+    int i, x, y;
+    Sint64 area;
+
+    SDL_zero(planes);
+    v[0] = v0;
+    v[1] = v1;
+    v[2] = v2;
+    for (i = 0; i < 3; ++i) {
+        X[i] = SnapCoord(v[i]->position.x, ctx->offsetx);
+        Y[i] = SnapCoord(v[i]->position.y, ctx->offsety);
+    }
+
+    area = ((Sint64)X[1] - X[0]) * ((Sint64)Y[2] - Y[0]) -
+           ((Sint64)X[2] - X[0]) * ((Sint64)Y[1] - Y[0]);
+    if (area == 0) {
+        return;
+    }
+    if (area < 0) {
+        /* Make the winding consistent so the inside is positive */
+        int tmp;
+        const SDL_Vertex *vtmp;
+
+        tmp = X[1]; X[1] = X[2]; X[2] = tmp;
+        tmp = Y[1]; Y[1] = Y[2]; Y[2] = tmp;
+        vtmp = v[1]; v[1] = v[2]; v[2] = vtmp;
+    }
+
+    /* Bounding box, in pixels whose centers may be covered */
+    minx = (int)FloorDiv(SDL_min(X[0], SDL_min(X[1], X[2])) - SUBPIXEL_HALF, SUBPIXEL_ONE);
+    maxx = (int)FloorDiv(SDL_max(X[0], SDL_max(X[1], X[2])) - SUBPIXEL_HALF, SUBPIXEL_ONE) + 1;
+    miny = (int)FloorDiv(SDL_min(Y[0], SDL_min(Y[1], Y[2])) - SUBPIXEL_HALF, SUBPIXEL_ONE);
+    maxy = (int)FloorDiv(SDL_max(Y[0], SDL_max(Y[1], Y[2])) - SUBPIXEL_HALF, SUBPIXEL_ONE) + 1;
+    minx = SDL_max(minx, ctx->clip.x);
+    miny = SDL_max(miny, ctx->clip.y);
+    maxx = SDL_min(maxx, ctx->clip.x + ctx->clip.w - 1);
+    maxy = SDL_min(maxy, ctx->clip.y + ctx->clip.h - 1);
+    if (minx > maxx || miny > maxy) {
+        return;
+    }
+
+    SetupEdge(&edges[0], X[1], Y[1], X[2], Y[2]);
+    SetupEdge(&edges[1], X[2], Y[2], X[0], Y[0]);
+    SetupEdge(&edges[2], X[0], Y[0], X[1], Y[1]);
+
+    for (i = 0; i < 3; ++i) {
+        c[i].r = (v[i]->color.r * ctx->mod.r) / 255;
+        c[i].g = (v[i]->color.g * ctx->mod.g) / 255;
+        c[i].b = (v[i]->color.b * ctx->mod.b) / 255;
+        c[i].a = (v[i]->color.a * ctx->mod.a) / 255;
+        fx[i] = (float)X[i] / SUBPIXEL_ONE;
+        fy[i] = (float)Y[i] / SUBPIXEL_ONE;
+    }
+    flat = (SDL_memcmp(&c[0], &c[1], sizeof(c[0])) == 0 &&
+            SDL_memcmp(&c[0], &c[2], sizeof(c[0])) == 0) ? SDL_TRUE : SDL_FALSE;
+    white = (flat && c[0].r == 255 && c[0].g == 255 && c[0].b == 255 && c[0].a == 255) ? SDL_TRUE : SDL_FALSE;
+
+    det = (fx[1] - fx[0]) * (fy[2] - fy[0]) - (fx[2] - fx[0]) * (fy[1] - fy[0]);
+    if (!flat) {
+        SetupPlane(&planes[0], fx, fy, det, c[0].r, c[1].r, c[2].r);
+        SetupPlane(&planes[1], fx, fy, det, c[0].g, c[1].g, c[2].g);
+        SetupPlane(&planes[2], fx, fy, det, c[0].b, c[1].b, c[2].b);
+        SetupPlane(&planes[3], fx, fy, det, c[0].a, c[1].a, c[2].a);
+    }
+    if (src) {
+        float u[3], t[3];
+
+        for (i = 0; i < 3; ++i) {
+            u[i] = SDL_max(-MAX_TEXCOORD, SDL_min(v[i]->tex_coord.x, MAX_TEXCOORD)) * src->w;
+            t[i] = SDL_max(-MAX_TEXCOORD, SDL_min(v[i]->tex_coord.y, MAX_TEXCOORD)) * src->h;
+        }
+        SetupPlane(&planes[4], fx, fy, det, u[0], u[1], u[2]);
+        SetupPlane(&planes[5], fx, fy, det, t[0], t[1], t[2]);
+    }
+
+    for (y = miny; y <= maxy; ++y) {
+        int left = minx, right = maxx;
+        Uint8 *dstp;
+        Sint32 r = 0, g = 0, b = 0, a = 0, s = 0, t = 0;
+        Sint32 dr = 0, dg = 0, db = 0, da = 0, ds = 0, dt = 0;
+        unsigned sR, sG, sB, sA;
+
+        ClipSpanToEdge(&edges[0], y, &left, &right);
+        ClipSpanToEdge(&edges[1], y, &left, &right);
+        ClipSpanToEdge(&edges[2], y, &left, &right);
+        if (left > right) {
+            continue;
+        }
+
+        dstp = (Uint8 *)dst->pixels + y * dst->pitch + left * dstbpp;
+
+        if (!src && flat && blendMode == SDL_BLENDMODE_NONE) {
+            FillSpan(dstp, dstbpp, SDL_MapRGBA(dst->format, c[0].r, c[0].g, c[0].b, c[0].a),
+                     right - left + 1);
+            continue;
+        }
+
+        if (!flat) {
+            r = PlaneFixed(&planes[0], left, y, COLOR_BITS);
+            g = PlaneFixed(&planes[1], left, y, COLOR_BITS);
+            b = PlaneFixed(&planes[2], left, y, COLOR_BITS);
+            a = PlaneFixed(&planes[3], left, y, COLOR_BITS);
+            dr = (Sint32)(planes[0].dx * (1 << COLOR_BITS));
+            dg = (Sint32)(planes[1].dx * (1 << COLOR_BITS));
+            db = (Sint32)(planes[2].dx * (1 << COLOR_BITS));
+            da = (Sint32)(planes[3].dx * (1 << COLOR_BITS));
+        }
+        if (src) {
+            s = PlaneFixed(&planes[4], left, y, TEXEL_BITS);
+            t = PlaneFixed(&planes[5], left, y, TEXEL_BITS);
+            ds = (Sint32)(planes[4].dx * (1 << TEXEL_BITS));
+            dt = (Sint32)(planes[5].dx * (1 << TEXEL_BITS));
+        }
+
+        for (x = left; x <= right; ++x) {
+            if (src) {
+                const SDL_PixelFormat *srcfmt = src->format;
+                const int srcbpp = srcfmt->BytesPerPixel;
+                const Uint8 *srcp = (const Uint8 *)src->pixels +
+                    ClampTexel(t, src->h) * src->pitch + ClampTexel(s, src->w) * srcbpp;
+                Uint32 srcpixel;
+
+                DISEMBLE_RGBA(srcp, srcbpp, srcfmt, srcpixel, sR, sG, sB, sA);
+                (void) srcpixel;
+                if (!white) {
+                    if (flat) {
+                        sR = (sR * c[0].r) / 255;
+                        sG = (sG * c[0].g) / 255;
+                        sB = (sB * c[0].b) / 255;
+                        sA = (sA * c[0].a) / 255;
+                    } else {
+                        sR = (sR * ClampColor(r)) / 255;
+                        sG = (sG * ClampColor(g)) / 255;
+                        sB = (sB * ClampColor(b)) / 255;
+                        sA = (sA * ClampColor(a)) / 255;
+                    }
+                }
+                s += ds;
+                t += dt;
+            } else if (flat) {
+                sR = c[0].r;
+                sG = c[0].g;
+                sB = c[0].b;
+                sA = c[0].a;
+            } else {
+                sR = ClampColor(r);
+                sG = ClampColor(g);
+                sB = ClampColor(b);
+                sA = ClampColor(a);
+            }
+            r += dr;
+            g += dg;
+            b += db;
+            a += da;
+
+            BLEND_PIXEL(dstp, dstbpp, dstfmt);
+            dstp += dstbpp;
+        }
+    }
+}
+
+int
+SDL_SW_RenderGeometry(SDL_Surface * dst, SDL_Surface * src,
+                      const SDL_Vertex * vertices, int num_vertices,
+                      const int * indices, int num_indices,
+                      int offsetx, int offsety,
+                      SDL_BlendMode blendMode, const SDL_Color * mod)
+{
+    TriangleContext ctx;
+    int i, count;
+
+    if (!dst) {
+        return SDL_SetError("Passed NULL destination surface");
+    }
+    if (dst->format->BytesPerPixel < 2) {
+        return SDL_Unsupported();
+    }
+
+    ctx.dst = dst;
+    ctx.src = src;
+    ctx.clip = dst->clip_rect;
+    ctx.blendMode = blendMode;
+    ctx.offsetx = offsetx;
+    ctx.offsety = offsety;
+    ctx.mod = *mod;
+
+    if (SDL_RectEmpty(&ctx.clip)) {
+        return 0;
+    }
+
+    if (SDL_MUSTLOCK(dst)) {
+        if (SDL_LockSurface(dst) < 0) {
+            return -1;
+        }
+    }
+    if (src && SDL_MUSTLOCK(src)) {
+        if (SDL_LockSurface(src) < 0) {
+            if (SDL_MUSTLOCK(dst)) {
+                SDL_UnlockSurface(dst);
+            }
+            return -1;
+        }
+    }
+
+    count = indices ? num_indices : num_vertices;
+    for (i = 0; i + 2 < count; i += 3) {
+        if (indices) {
+            RasterizeTriangle(&ctx, &vertices[indices[i]], &vertices[indices[i + 1]], &vertices[indices[i + 2]]);
+        } else {
+            RasterizeTriangle(&ctx, &vertices[i], &vertices[i + 1], &vertices[i + 2]);
+        }
+    }
+
+    if (src && SDL_MUSTLOCK(src)) {
+        SDL_UnlockSurface(src);
+    }
+    if (SDL_MUSTLOCK(dst)) {
+        SDL_UnlockSurface(dst);
+    }
+    return 0;
+}
+
+#endif /* !SDL_RENDER_DISABLED */
+
+/* vi: set ts=4 sw=4 expandtab: */
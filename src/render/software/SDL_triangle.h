@@ -18,11 +18,18 @@
      misrepresented as being the original software.
   3. This notice may not be removed or altered from any source distribution.
 */
-#include "../SDL_internal.h"
+#include "../../SDL_internal.h"
 
-/* FIXME: This breaks on various versions of GCC and should be rewritten using intrinsics */
-#if 0 /* (__GNUC__ > 2) && defined(__i386__) && __OPTIMIZE__ && SDL_ASSEMBLY_ROUTINES && !defined(__clang__) */
-#define USE_MMX_ASSEMBLY 1
-#endif
+#include "SDL_render.h"
+
+/* Draw triangles into dst, clipped to its clip rectangle. Vertex positions are
+   offset by (offsetx, offsety) dst pixels. If src is NULL the triangles are
+   filled with the vertex colors, otherwise texture coordinates are normalized
+   to src. The vertex colors are modulated by 'mod'. */
+extern int SDL_SW_RenderGeometry(SDL_Surface * dst, SDL_Surface * src,
+                                 const SDL_Vertex * vertices, int num_vertices,
+                                 const int * indices, int num_indices,
+                                 int offsetx, int offsety,
+                                 SDL_BlendMode blendMode, const SDL_Color * mod);
 
 /* vi: set ts=4 sw=4 expandtab: */
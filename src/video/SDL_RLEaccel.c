@@ -25,7 +25,7 @@
  *
  * Original version by Sam Lantinga
  *
- * Mattias Engdegrd (Yorick): Rewrite. New encoding format, encoder and
+ * Mattias Engdeg�rd (Yorick): Rewrite. New encoding format, encoder and
  * decoder. Added per-surface alpha blitter. Added per-pixel alpha
  * format, encoder and blitter.
  *
@@ -58,6 +58,12 @@
  *   The end of the sequence is marked by a zero <skip>,<run> pair at the *
  *   beginning of a line.
  *
+ *   Blits that modulate the colors, add, multiply, scale or convert the
+ *   format (as do alpha modulated blits of surfaces with an alpha channel)
+ *   use the same encoding with the pixels in the source format, and draw
+ *   the runs with the slow blitter. Without a colorkey, the pixels left out
+ *   are then the ones with zero alpha.
+ *
  * Encoding of surfaces with per-pixel alpha:
  *
  *   The sequence begins with a struct RLEDestFormat describing the target
@@ -86,16 +92,79 @@
  */
 
 #include "SDL_video.h"
+#include "SDL_cpuinfo.h"
 #include "SDL_sysvideo.h"
 #include "SDL_blit.h"
+#include "SDL_blit_slow.h"
 #include "SDL_RLEaccel_c.h"
 
 #ifndef MIN
 #define MIN(a, b) ((a) < (b) ? (a) : (b))
 #endif
 
+#ifdef __SSE2__
+#define HAVE_SSE2_INTRINSICS 1
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define HAVE_NEON_INTRINSICS 1
+#endif
+
+/* Opaque runs are mostly short, and calling memcpy() costs more than the
+   copy itself. These are plain loads and stores, which the compiler may
+   use anyway whenever they are enabled, so there is no runtime check. */
+#define RLE_INLINE_COPY_MAX 64
+
+#if HAVE_SSE2_INTRINSICS
+#define RLE_LOAD16(p)       _mm_loadu_si128((const __m128i *)(p))
+#define RLE_STORE16(p, v)   _mm_storeu_si128((__m128i *)(p), v)
+#define RLE_LOAD8(p)        _mm_loadl_epi64((const __m128i *)(p))
+#define RLE_STORE8(p, v)    _mm_storel_epi64((__m128i *)(p), v)
+#define RLE_VECTOR16        __m128i
+#define RLE_VECTOR8         __m128i
+#elif HAVE_NEON_INTRINSICS
+#define RLE_LOAD16(p)       vld1q_u8((const uint8_t *)(p))
+#define RLE_STORE16(p, v)   vst1q_u8((uint8_t *)(p), v)
+#define RLE_LOAD8(p)        vld1_u8((const uint8_t *)(p))
+#define RLE_STORE8(p, v)    vst1_u8((uint8_t *)(p), v)
+#define RLE_VECTOR16        uint8x16_t
+#define RLE_VECTOR8         uint8x8_t
+#endif
+
+static SDL_INLINE void
+RLECopyPixels(Uint8 * dst, const Uint8 * src, size_t len)
+{
+#ifdef RLE_VECTOR16
+    if (len > RLE_INLINE_COPY_MAX) {
+        SDL_memcpy(dst, src, len);
+    } else if (len >= 16) {
+        /* The last vector may overlap the one before */
+        const RLE_VECTOR16 last = RLE_LOAD16(src + len - 16);
+        Uint8 *end = dst + len - 16;
+        while (dst < end) {
+            RLE_STORE16(dst, RLE_LOAD16(src));
+            dst += 16;
+            src += 16;
+        }
+        RLE_STORE16(end, last);
+    } else if (len >= 8) {
+        const RLE_VECTOR8 first = RLE_LOAD8(src);
+        const RLE_VECTOR8 last = RLE_LOAD8(src + len - 8);
+        RLE_STORE8(dst, first);
+        RLE_STORE8(dst + len - 8, last);
+    } else {
+        while (len--) {
+            *dst++ = *src++;
+        }
+    }
+#else
+    SDL_memcpy(dst, src, len);
+#endif
+}
+
 #define PIXEL_COPY(to, from, len, bpp)          \
-    SDL_memcpy(to, from, (size_t)(len) * (bpp))
+    RLECopyPixels((Uint8 *)(to), (const Uint8 *)(from), (size_t)(len) * (bpp))
 
 /*
  * Various colorkey blit methods, for opaque and per-surface alpha
@@ -444,16 +513,15 @@ RLEClipBlit(int w, Uint8 * srcbuf, SDL_Surface * surf_dst,
 }
 
 
-/* blit a colorkeyed RLE surface */
-int SDLCALL
-SDL_RLEBlit(SDL_Surface * surf_src, SDL_Rect * srcrect,
-            SDL_Surface * surf_dst, SDL_Rect * dstrect)
+/* blit a colorkeyed RLE surface with the given per-surface alpha */
+static int
+RLEColorkeyBlit(SDL_Surface * surf_src, SDL_Rect * srcrect,
+                SDL_Surface * surf_dst, SDL_Rect * dstrect, unsigned alpha)
 {
     Uint8 *dstbuf;
     Uint8 *srcbuf;
     int x, y;
     int w = surf_src->w;
-    unsigned alpha;
 
     /* Lock the destination if necessary */
     if (SDL_MUSTLOCK(surf_dst)) {
@@ -513,7 +581,6 @@ SDL_RLEBlit(SDL_Surface * surf_src, SDL_Rect * srcrect,
         }
     }
 
-    alpha = surf_src->map->info.a;
     /* if left or right edge clipping needed, call clip blit */
     if (srcrect->x || srcrect->w != surf_src->w) {
         RLEClipBlit(w, srcbuf, surf_dst, dstbuf, srcrect, alpha);
@@ -557,8 +624,154 @@ SDL_RLEBlit(SDL_Surface * surf_src, SDL_Rect * srcrect,
     return (0);
 }
 
+/* blit a colorkeyed RLE surface */
+int SDLCALL
+SDL_RLEBlit(SDL_Surface * surf_src, SDL_Rect * srcrect,
+            SDL_Surface * surf_dst, SDL_Rect * dstrect)
+{
+    return RLEColorkeyBlit(surf_src, srcrect, surf_dst, dstrect,
+                           surf_src->map->info.a);
+}
+
 #undef OPAQUE_BLIT
 
+/* Read the <skip> and <run> counts of the next segment */
+#define RLE_COUNTS(srcbuf, bpp, skip, run)      \
+    do {                                        \
+        if (bpp == 4) {                         \
+            skip = ((Uint16 *)srcbuf)[0];       \
+            run = ((Uint16 *)srcbuf)[1];        \
+            srcbuf += 4;                        \
+        } else {                                \
+            skip = srcbuf[0];                   \
+            run = srcbuf[1];                    \
+            srcbuf += 2;                        \
+        }                                       \
+    } while(0)
+
+/* Skip one line of a colorkeyed RLE surface, NULL if no lines are left */
+static Uint8 *
+RLESkipLine(Uint8 * srcbuf, int w, int bpp)
+{
+    int ofs = 0;
+
+    do {
+        int skip, run;
+        RLE_COUNTS(srcbuf, bpp, skip, run);
+        if (!skip && !run && !ofs) {
+            return NULL;
+        }
+        srcbuf += run * bpp;
+        ofs += skip + run;
+    } while (ofs < w);
+    return srcbuf;
+}
+
+/*
+ * Blit a colorkeyed RLE surface with the slow blitter, which modulates,
+ * blends, converts the pixels and samples the source rows and columns for
+ * scaled blits exactly as it does for surfaces that aren't encoded.
+ */
+static int SDLCALL
+SDL_RLESpanBlit(SDL_Surface * surf_src, SDL_Rect * srcrect,
+                SDL_Surface * surf_dst, SDL_Rect * dstrect)
+{
+    const SDL_BlitInfo *info = &surf_src->map->info;
+    const int bpp = surf_src->format->BytesPerPixel;
+    const int dstbpp = surf_dst->format->BytesPerPixel;
+    const int w = surf_src->w;
+    const int left = srcrect->x;
+    const int right = srcrect->x + srcrect->w;
+    int offsets[256];
+    Uint8 *srcbuf, *dstbuf;
+    int incx, incy;
+    int srcy, y;
+
+    if (srcrect->w <= 0 || srcrect->h <= 0 ||
+        dstrect->w <= 0 || dstrect->h <= 0) {
+        return 0;
+    }
+
+    /* Lock the destination if necessary */
+    if (SDL_MUSTLOCK(surf_dst)) {
+        if (SDL_LockSurface(surf_dst) < 0) {
+            return -1;
+        }
+    }
+
+    /* The same stepping as SDL_Blit_Slow(), destination pixel x samples
+       source pixel x * incx >> 16 */
+    incx = (srcrect->w << 16) / dstrect->w;
+    incy = (srcrect->h << 16) / dstrect->h;
+
+    srcbuf = (Uint8 *) surf_src->map->data;
+    dstbuf = (Uint8 *) surf_dst->pixels
+        + dstrect->y * surf_dst->pitch + dstrect->x * dstbpp;
+    srcy = 0;
+
+    for (y = 0; y < dstrect->h; ++y, dstbuf += surf_dst->pitch) {
+        const int line = srcrect->y + (int) (((Sint64) y * incy) >> 16);
+        Uint8 *runbuf;
+        int ofs = 0;
+
+        for (; srcy < line; ++srcy) {
+            srcbuf = RLESkipLine(srcbuf, w, bpp);
+            if (!srcbuf) {
+                goto done;
+            }
+        }
+
+        runbuf = srcbuf;
+        do {
+            int skip, run, start, end;
+            RLE_COUNTS(runbuf, bpp, skip, run);
+            if (!skip && !run && !ofs) {
+                goto done;
+            }
+            ofs += skip;
+
+            /* clip to left and right borders */
+            start = SDL_max(ofs, left);
+            end = SDL_min(ofs + run, right);
+            if (start < end) {
+                const Uint8 *pixels = runbuf + (start - ofs) * bpp;
+                if (incx == 0x10000) {
+                    SDL_Blit_SlowSpan(info, pixels, NULL,
+                                      dstbuf + (start - left) * dstbpp,
+                                      end - start);
+                } else {
+                    /* the destination columns sampling this run */
+                    const int first = (int) ((((Sint64) (start - left) << 16) + incx - 1) / incx);
+                    const int last = SDL_min(dstrect->w,
+                        (int) ((((Sint64) (end - left) << 16) + incx - 1) / incx));
+                    int x, n, i;
+
+                    for (x = first; x < last; x += n) {
+                        n = SDL_min(last - x, (int) SDL_arraysize(offsets));
+                        for (i = 0; i < n; ++i) {
+                            const int col = (int) (((Sint64) (x + i) * incx) >> 16);
+                            offsets[i] = (left + col - start) * bpp;
+                        }
+                        SDL_Blit_SlowSpan(info, pixels, offsets,
+                                          dstbuf + x * dstbpp, n);
+                    }
+                }
+            }
+            runbuf += run * bpp;
+            ofs += run;
+        } while (ofs < w);
+    }
+
+  done:
+    /* Unlock the destination if necessary */
+    if (SDL_MUSTLOCK(surf_dst)) {
+        SDL_UnlockSurface(surf_dst);
+    }
+    return 0;
+}
+
+#undef RLE_COUNTS
+
 /*
  * Per-pixel blitting macros for translucent pixels:
  * These use the same techniques as the per-surface blitting macros
@@ -1269,8 +1482,10 @@ static const getpix_func getpixes[4] = {
     getpix_8, getpix_16, getpix_24, getpix_32
 };
 
+/* encode the pixels that don't match the colorkey, or with 'alphakey' set,
+   the ones that don't have zero alpha */
 static int
-RLEColorkeySurface(SDL_Surface * surface)
+RLEColorkeySurface(SDL_Surface * surface, SDL_bool alphakey)
 {
     Uint8 *rlebuf, *dst;
     int maxn;
@@ -1314,8 +1529,13 @@ RLEColorkeySurface(SDL_Surface * surface)
     srcbuf = (Uint8 *) surface->pixels;
     maxn = bpp == 4 ? 65535 : 255;
     dst = rlebuf;
-    rgbmask = ~surface->format->Amask;
-    ckey = surface->map->info.colorkey & rgbmask;
+    if (alphakey) {
+        rgbmask = surface->format->Amask;
+        ckey = 0;
+    } else {
+        rgbmask = ~surface->format->Amask;
+        ckey = surface->map->info.colorkey & rgbmask;
+    }
     lastline = dst;
     getpix = getpixes[bpp - 1];
     w = surface->w;
@@ -1425,12 +1645,41 @@ SDL_RLESurface(SDL_Surface * surface)
         return -1;
     }
 
-    /* Pass on combinations not supported */
+    /* Modulated, added, multiplied and scaled blits are drawn by the
+       slow blitter, from runs in the source format */
     if ((flags & SDL_COPY_MODULATE_COLOR) ||
         ((flags & SDL_COPY_MODULATE_ALPHA) && surface->format->Amask) ||
         (flags & (SDL_COPY_ADD | SDL_COPY_MOD)) ||
         (flags & SDL_COPY_NEAREST)) {
-        return -1;
+        SDL_PixelFormat *dstfmt = surface->map->info.dst_fmt;
+        SDL_bool alphakey = SDL_FALSE;
+
+        /* The slow blitter only unpacks up to 8 bits per channel */
+        if (SDL_ISPIXELFORMAT_INDEXED(surface->format->format) ||
+            SDL_ISPIXELFORMAT_FOURCC(surface->format->format) ||
+            surface->format->Rloss > 8 || !dstfmt ||
+            SDL_ISPIXELFORMAT_INDEXED(dstfmt->format) ||
+            SDL_ISPIXELFORMAT_FOURCC(dstfmt->format) || dstfmt->Rloss > 8) {
+            return -1;
+        }
+        if (!(flags & SDL_COPY_COLORKEY)) {
+            /* Zero alpha pixels only leave blended and added ones as is */
+            if (!surface->format->Amask ||
+                !(flags & (SDL_COPY_BLEND | SDL_COPY_ADD))) {
+                return -1;
+            }
+            alphakey = SDL_TRUE;
+        }
+        if (RLEColorkeySurface(surface, alphakey) < 0) {
+            return -1;
+        }
+        surface->map->blit = SDL_RLESpanBlit;
+        surface->map->info.flags |= SDL_COPY_RLE_COLORKEY;
+        if (alphakey) {
+            surface->map->info.flags |= SDL_COPY_RLE_ALPHAZERO;
+        }
+        surface->flags |= SDL_RLEACCEL;
+        return 0;
     }
 
     /* Encode and set up the blit */
@@ -1438,7 +1687,7 @@ SDL_RLESurface(SDL_Surface * surface)
         if (!surface->map->identity) {
             return -1;
         }
-        if (RLEColorkeySurface(surface) < 0) {
+        if (RLEColorkeySurface(surface, SDL_FALSE) < 0) {
             return -1;
         }
         surface->map->blit = SDL_RLEBlit;
@@ -1554,14 +1803,19 @@ SDL_UnRLESurface(SDL_Surface * surface, int recode)
                     return;
                 }
 
-                /* fill it with the background color */
-                SDL_FillRect(surface, NULL, surface->map->info.colorkey);
+                /* fill it with the background color, or with transparent
+                   pixels if those were left out */
+                if (surface->map->info.flags & SDL_COPY_RLE_ALPHAZERO) {
+                    SDL_memset(surface->pixels, 0, surface->h * surface->pitch);
+                } else {
+                    SDL_FillRect(surface, NULL, surface->map->info.colorkey);
+                }
 
-                /* now render the encoded surface */
+                /* now copy the encoded pixels back, whatever the alpha */
                 full.x = full.y = 0;
                 full.w = surface->w;
                 full.h = surface->h;
-                SDL_RLEBlit(surface, &full, surface, &full);
+                RLEColorkeyBlit(surface, &full, surface, &full, 255);
             } else {
                 if (!UnRLEAlpha(surface)) {
                     /* Oh crap... */
@@ -1571,7 +1825,8 @@ SDL_UnRLESurface(SDL_Surface * surface, int recode)
             }
         }
         surface->map->info.flags &=
-            ~(SDL_COPY_RLE_COLORKEY | SDL_COPY_RLE_ALPHAKEY);
+            ~(SDL_COPY_RLE_COLORKEY | SDL_COPY_RLE_ALPHAKEY |
+              SDL_COPY_RLE_ALPHAZERO);
 
         SDL_free(surface->map->data);
         surface->map->data = NULL;
@@ -29,6 +29,48 @@
 #include "SDL_RLEaccel_c.h"
 #include "SDL_pixels_c.h"
 
+/* Point the blit info at the given, already clipped, rectangles */
+static void
+SDL_SetupBlitInfo(SDL_BlitInfo * info, SDL_Surface * src, const SDL_Rect * srcrect,
+                  SDL_Surface * dst, const SDL_Rect * dstrect)
+{
+    info->src = (Uint8 *) src->pixels +
+        (Uint16) srcrect->y * src->pitch +
+        (Uint16) srcrect->x * info->src_fmt->BytesPerPixel;
+    info->src_w = srcrect->w;
+    info->src_h = srcrect->h;
+    info->src_pitch = src->pitch;
+    info->src_skip =
+        info->src_pitch - info->src_w * info->src_fmt->BytesPerPixel;
+    info->dst =
+        (Uint8 *) dst->pixels + (Uint16) dstrect->y * dst->pitch +
+        (Uint16) dstrect->x * info->dst_fmt->BytesPerPixel;
+    info->dst_w = dstrect->w;
+    info->dst_h = dstrect->h;
+    info->dst_pitch = dst->pitch;
+    info->dst_skip =
+        info->dst_pitch - info->dst_w * info->dst_fmt->BytesPerPixel;
+}
+
+typedef struct
+{
+    SDL_BlitFunc blit;
+    const SDL_BlitInfo *info;
+} SDL_SoftBlitRows;
+
+static int
+SDL_SoftBlitBand(void *data, int first, int last)
+{
+    const SDL_SoftBlitRows *rows = (const SDL_SoftBlitRows *) data;
+    SDL_BlitInfo info = *rows->info;
+
+    info.src += first * info.src_pitch;
+    info.dst += first * info.dst_pitch;
+    info.src_h = info.dst_h = last - first;
+    rows->blit(&info);
+    return 0;
+}
+
 /* The general purpose software blit routine */
 static int SDLCALL
 SDL_SoftBlit(SDL_Surface * src, SDL_Rect * srcrect,
@@ -66,26 +108,22 @@ SDL_SoftBlit(SDL_Surface * src, SDL_Rect * srcrect,
         SDL_BlitInfo *info = &src->map->info;
 
         /* Set up the blit information */
-        info->src = (Uint8 *) src->pixels +
-            (Uint16) srcrect->y * src->pitch +
-            (Uint16) srcrect->x * info->src_fmt->BytesPerPixel;
-        info->src_w = srcrect->w;
-        info->src_h = srcrect->h;
-        info->src_pitch = src->pitch;
-        info->src_skip =
-            info->src_pitch - info->src_w * info->src_fmt->BytesPerPixel;
-        info->dst =
-            (Uint8 *) dst->pixels + (Uint16) dstrect->y * dst->pitch +
-            (Uint16) dstrect->x * info->dst_fmt->BytesPerPixel;
-        info->dst_w = dstrect->w;
-        info->dst_h = dstrect->h;
-        info->dst_pitch = dst->pitch;
-        info->dst_skip =
-            info->dst_pitch - info->dst_w * info->dst_fmt->BytesPerPixel;
+        SDL_SetupBlitInfo(info, src, srcrect, dst, dstrect);
         RunBlit = (SDL_BlitFunc) src->map->data;
 
-        /* Run the actual software blit */
-        RunBlit(info);
+        /* Run the actual software blit, in bands if it's large. Scaled
+           blits step through the source from their first row, and blits
+           within one surface may read rows another band has written. */
+        if (!(info->flags & SDL_COPY_NEAREST) && src != dst) {
+            SDL_SoftBlitRows rows;
+
+            rows.blit = RunBlit;
+            rows.info = info;
+            SDL_RunBlitRows(SDL_SoftBlitBand, &rows, info->dst_h,
+                            (Sint64) info->dst_w * info->dst_h);
+        } else {
+            RunBlit(info);
+        }
     }
 
     /* We need to unlock the surfaces if they're locked */
@@ -99,6 +137,44 @@ SDL_SoftBlit(SDL_Surface * src, SDL_Rect * srcrect,
     return (okay ? 0 : -1);
 }
 
+SDL_bool
+SDL_PrepareConcurrentBlit(SDL_Surface * src, SDL_Surface * dst)
+{
+    if (!src || !dst || src == dst || SDL_MUSTLOCK(src) || SDL_MUSTLOCK(dst)) {
+        return SDL_FALSE;
+    }
+
+    /* The same map bookkeeping SDL_UpperBlit() and SDL_LowerBlit() do */
+    if (src->map->info.flags & SDL_COPY_NEAREST) {
+        src->map->info.flags &= ~SDL_COPY_NEAREST;
+        SDL_InvalidateMap(src->map);
+    }
+    if ((src->map->dst != dst) ||
+        (dst->format->palette &&
+         src->map->dst_palette_version != dst->format->palette->version) ||
+        (src->format->palette &&
+         src->map->src_palette_version != src->format->palette->version)) {
+        if (SDL_MapSurface(src, dst) < 0) {
+            return SDL_FALSE;
+        }
+    }
+    return (src->map->blit == SDL_SoftBlit) ? SDL_TRUE : SDL_FALSE;
+}
+
+void
+SDL_BlitConcurrent(SDL_Surface * src, const SDL_Rect * srcrect,
+                   SDL_Surface * dst, const SDL_Rect * dstrect)
+{
+    /* Work on a private copy, the map's own info is shared by all callers */
+    SDL_BlitInfo info = src->map->info;
+
+    if (SDL_RectEmpty(srcrect)) {
+        return;
+    }
+    SDL_SetupBlitInfo(&info, src, srcrect, dst, dstrect);
+    ((SDL_BlitFunc) src->map->data)(&info);
+}
+
 #ifdef __MACOSX__
 #include <sys/sysctl.h>
 
@@ -124,11 +200,85 @@ SDL_UseAltivecPrefetch()
 }
 #endif /* __MACOSX__ */
 
+/* The range of entries for each pair of formats in a blit table, hashed on
+   the formats, so choosing a blit doesn't walk the whole table */
+#define SDL_BLIT_FUNC_SLOTS     256
+
+typedef struct
+{
+    Uint32 src_format;
+    Uint32 dst_format;
+    int first;
+    int last;
+} SDL_BlitFuncSlot;
+
+typedef struct
+{
+    const SDL_BlitFuncEntry *entries;
+    SDL_bool indexed;
+    SDL_BlitFuncSlot slots[SDL_BLIT_FUNC_SLOTS];
+} SDL_BlitFuncIndex;
+
+static SDL_SpinLock SDL_blit_func_index_lock;
+static SDL_BlitFuncIndex SDL_blit_func_index;
+
+static Uint32
+SDL_HashBlitFormats(Uint32 src_format, Uint32 dst_format)
+{
+    return ((src_format * 0x9E3779B1u) ^ dst_format) * 0x9E3779B1u >> 24;
+}
+
+static SDL_BlitFuncSlot *
+SDL_FindBlitFuncSlot(SDL_BlitFuncIndex * index, Uint32 src_format, Uint32 dst_format)
+{
+    Uint32 hash = SDL_HashBlitFormats(src_format, dst_format);
+    int i;
+
+    /* Linear probing, an empty slot ends the search */
+    for (i = 0; i < SDL_BLIT_FUNC_SLOTS; ++i) {
+        SDL_BlitFuncSlot *slot = &index->slots[(hash + i) % SDL_BLIT_FUNC_SLOTS];
+
+        if (slot->first < 0 ||
+            (slot->src_format == src_format && slot->dst_format == dst_format)) {
+            return slot;
+        }
+    }
+    return NULL;
+}
+
+/* Returns SDL_FALSE if the table has too many format pairs to index */
+static SDL_bool
+SDL_IndexBlitFuncs(SDL_BlitFuncIndex * index, const SDL_BlitFuncEntry * entries)
+{
+    int i;
+
+    index->entries = entries;
+    index->indexed = SDL_FALSE;
+    for (i = 0; i < SDL_BLIT_FUNC_SLOTS; ++i) {
+        index->slots[i].first = -1;
+    }
+    for (i = 0; entries[i].func; ++i) {
+        SDL_BlitFuncSlot *slot = SDL_FindBlitFuncSlot(index, entries[i].src_format, entries[i].dst_format);
+
+        if (!slot) {
+            return SDL_FALSE;
+        }
+        if (slot->first < 0) {
+            slot->src_format = entries[i].src_format;
+            slot->dst_format = entries[i].dst_format;
+            slot->first = i;
+        }
+        slot->last = i;
+    }
+    index->indexed = SDL_TRUE;
+    return SDL_TRUE;
+}
+
 static SDL_BlitFunc
 SDL_ChooseBlitFunc(Uint32 src_format, Uint32 dst_format, int flags,
                    SDL_BlitFuncEntry * entries)
 {
-    int i, flagcheck;
+    int i, first, last, flagcheck;
     static Uint32 features = 0xffffffff;
 
     /* Get the available CPU features */
@@ -160,10 +310,32 @@ SDL_ChooseBlitFunc(Uint32 src_format, Uint32 dst_format, int flags,
                     features |= SDL_CPU_ALTIVEC_NOPREFETCH;
                 }
             }
+            if (SDL_HasNEON()) {
+                features |= SDL_CPU_NEON;
+            }
         }
     }
 
-    for (i = 0; entries[i].func; ++i) {
+    /* Only look at the entries for this pair of formats, in table order */
+    first = 0;
+    last = SDL_MAX_SINT32;
+    SDL_AtomicLock(&SDL_blit_func_index_lock);
+    if (SDL_blit_func_index.entries != entries) {
+        SDL_IndexBlitFuncs(&SDL_blit_func_index, entries);
+    }
+    if (SDL_blit_func_index.indexed) {
+        const SDL_BlitFuncSlot *slot = SDL_FindBlitFuncSlot(&SDL_blit_func_index, src_format, dst_format);
+
+        if (!slot || slot->first < 0) {
+            SDL_AtomicUnlock(&SDL_blit_func_index_lock);
+            return NULL;
+        }
+        first = slot->first;
+        last = slot->last;
+    }
+    SDL_AtomicUnlock(&SDL_blit_func_index_lock);
+
+    for (i = first; i <= last && entries[i].func; ++i) {
         /* Check for matching pixel formats */
         if (src_format != entries[i].src_format) {
             continue;
@@ -260,6 +432,9 @@ SDL_CalculateBlit(SDL_Surface * surface)
     } else {
         blit = SDL_CalculateBlitN(surface);
     }
+    if (blit == NULL) {
+        blit = SDL_CalculateBlitModulate(surface);
+    }
     if (blit == NULL) {
         Uint32 src_format = surface->format->format;
         Uint32 dst_format = dst->format->format;
@@ -27,6 +27,16 @@
 #include "SDL_endian.h"
 #include "SDL_surface.h"
 
+/* Code built for AVX or AVX2 is compiled for that extension on its own,
+   so callers must check SDL_HasAVX() or SDL_HasAVX2() before running it. */
+#ifdef HAVE_AVX_TARGET_ATTRIBUTE
+#include <immintrin.h>
+#define HAVE_AVX_INTRINSICS 1
+#define HAVE_AVX2_INTRINSICS 1
+#define SDL_TARGET_AVX __attribute__((target("avx")))
+#define SDL_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
 /* Table to do pixel byte expansion */
 extern Uint8* SDL_expand_byte[9];
 
@@ -41,7 +51,8 @@ extern Uint8* SDL_expand_byte[9];
 #define SDL_COPY_RLE_DESIRED        0x00001000
 #define SDL_COPY_RLE_COLORKEY       0x00002000
 #define SDL_COPY_RLE_ALPHAKEY       0x00004000
-#define SDL_COPY_RLE_MASK           (SDL_COPY_RLE_DESIRED|SDL_COPY_RLE_COLORKEY|SDL_COPY_RLE_ALPHAKEY)
+#define SDL_COPY_RLE_ALPHAZERO      0x00008000
+#define SDL_COPY_RLE_MASK           (SDL_COPY_RLE_DESIRED|SDL_COPY_RLE_COLORKEY|SDL_COPY_RLE_ALPHAKEY|SDL_COPY_RLE_ALPHAZERO)
 
 /* SDL blit CPU flags */
 #define SDL_CPU_ANY                 0x00000000
@@ -51,6 +62,7 @@ extern Uint8* SDL_expand_byte[9];
 #define SDL_CPU_SSE2                0x00000008
 #define SDL_CPU_ALTIVEC_PREFETCH    0x00000010
 #define SDL_CPU_ALTIVEC_NOPREFETCH  0x00000020
+#define SDL_CPU_NEON                0x00000040
 
 typedef struct
 {
@@ -82,6 +94,18 @@ typedef struct
     SDL_BlitFunc func;
 } SDL_BlitFuncEntry;
 
+/* A blit set up earlier for another destination format */
+typedef struct
+{
+    SDL_PixelFormat *dst_fmt;   /**< Referenced while cached */
+    int flags;
+    int identity;
+    SDL_blit blit;
+    void *data;
+} SDL_BlitMapCacheEntry;
+
+#define SDL_BLITMAP_CACHE_SIZE  4
+
 /* Blit mapping definition */
 typedef struct SDL_BlitMap
 {
@@ -95,16 +119,60 @@ typedef struct SDL_BlitMap
        an invalid mapping */
     Uint32 dst_palette_version;
     Uint32 src_palette_version;
+
+    /* Blits of non-indexed surfaces to the destination formats used last,
+       most recent first, so alternating destinations doesn't choose the
+       blit again every time */
+    SDL_BlitMapCacheEntry cache[SDL_BLITMAP_CACHE_SIZE];
+    int num_cached;
 } SDL_BlitMap;
 
 /* Functions found in SDL_blit.c */
 extern int SDL_CalculateBlit(SDL_Surface * surface);
 
+/* Map src for unscaled software blits to dst. Returns SDL_TRUE if the pair
+   can then be blitted with SDL_BlitConcurrent(), which only reads the shared
+   map, so several threads may blit to disjoint areas of dst at once. Neither
+   surface may change in between. */
+extern SDL_bool SDL_PrepareConcurrentBlit(SDL_Surface * src, SDL_Surface * dst);
+extern void SDL_BlitConcurrent(SDL_Surface * src, const SDL_Rect * srcrect,
+                               SDL_Surface * dst, const SDL_Rect * dstrect);
+
+/* Functions found in SDL_blit_threads.c */
+/* Draws rows [first, last) of a blit, returns -1 on error */
+typedef int (*SDL_BlitRowsFunc) (void *data, int first, int last);
+
+/* Run 'func' over 'rows' rows, split into bands drawn by the threads
+   SDL_HINT_BLIT_THREADS asks for when the blit covers enough 'pixels' */
+extern int SDL_RunBlitRows(SDL_BlitRowsFunc func, void *data, int rows, Sint64 pixels);
+extern void SDL_QuitBlitThreads(void);
+
 /* Functions found in SDL_blit_*.c */
+/* SDL_UpperBlitScaled() with bilinear filtering when 'linear' is set and the
+   surfaces are 32-bit, nearest neighbour otherwise */
+extern int SDL_PrivateUpperBlitScaled(SDL_Surface * src, const SDL_Rect * srcrect,
+                                      SDL_Surface * dst, SDL_Rect * dstrect, SDL_bool linear);
+
 extern SDL_BlitFunc SDL_CalculateBlit0(SDL_Surface * surface);
 extern SDL_BlitFunc SDL_CalculateBlit1(SDL_Surface * surface);
 extern SDL_BlitFunc SDL_CalculateBlitN(SDL_Surface * surface);
 extern SDL_BlitFunc SDL_CalculateBlitA(SDL_Surface * surface);
+extern SDL_BlitFunc SDL_CalculateBlitModulate(SDL_Surface * surface);
+
+/* Multiply each byte of 32-bit pixels by the byte at the same position of
+   'modulation' and divide by 255, rounding down like the modulating blitters.
+   'modulation' is a pixel in the same format, e.g. the color mod mapped with
+   the alpha mod, so this works for any 8888 layout. src may equal dst. */
+extern void SDL_Modulate32(const void * src, int src_pitch, void * dst, int dst_pitch,
+                           int width, int height, Uint32 modulation);
+
+/* Convert pixels between RGB formats without setting up a blit: any pair
+   of 8-bit per channel formats, and 16-bit formats to or from those. Gives
+   the same results as SDL_ConvertPixels() does with a blit, or returns
+   SDL_FALSE if the pair isn't handled. */
+extern SDL_bool SDL_ConvertPixelsRGB(int width, int height,
+                                     Uint32 src_format, const void * src, int src_pitch,
+                                     Uint32 dst_format, void * dst, int dst_pitch);
 
 /*
  * Useful macros for blitting routines
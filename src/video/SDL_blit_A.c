@@ -23,6 +23,15 @@
 #include "SDL_video.h"
 #include "SDL_blit.h"
 
+#ifdef __SSE2__
+#define HAVE_SSE2_INTRINSICS 1
+#endif
+
+#if (defined(__ARM_NEON) || defined(__ARM_NEON__)) && SDL_BYTEORDER == SDL_LIL_ENDIAN
+#include <arm_neon.h>
+#define HAVE_NEON_INTRINSICS 1
+#endif
+
 /* Functions to perform alpha blended blitting */
 
 /* N->1 blending with per-surface alpha */
@@ -582,6 +591,316 @@ BlitRGBtoRGBPixelAlphaMMX3DNOW(SDL_BlitInfo * info)
 
 #endif /* __3dNOW__ */
 
+/* The SIMD versions of BlitRGBtoRGBPixelAlpha and BlitRGBtoRGBSurfaceAlpha
+   give the same results. Per channel those compute
+
+       d + ((s - d) * alpha >> 8) == (d * (256 - alpha) + s * alpha) >> 8
+
+   and the pixel alpha one sets the alpha to alpha + (dalpha * (255 - alpha) >> 8).
+   The pixels left at the end of a row go through the scalar versions.
+*/
+static void
+BlitRowTail(SDL_BlitInfo * info, Uint32 * srcp, Uint32 * dstp, int width,
+            SDL_BlitFunc blit)
+{
+    SDL_BlitInfo tail = *info;
+
+    if (width > 0) {
+        tail.src = (Uint8 *) srcp;
+        tail.dst = (Uint8 *) dstp;
+        tail.src_w = tail.dst_w = width;
+        tail.src_h = tail.dst_h = 1;
+        blit(&tail);
+    }
+}
+
+#if HAVE_SSE2_INTRINSICS
+static SDL_INLINE __m128i
+BlendPixelAlphaSSE2(__m128i s, __m128i d)
+{
+    const __m128i zero = _mm_setzero_si128();
+    /* 256 - alpha for the colors, 255 - alpha and 256 * alpha for the alpha */
+    const __m128i dbase = _mm_set_epi16(255, 256, 256, 256, 255, 256, 256, 256);
+    const __m128i salpha = _mm_set_epi16(256, 0, 0, 0, 256, 0, 0, 0);
+    const __m128i colors = _mm_set_epi16(0, -1, -1, -1, 0, -1, -1, -1);
+    const __m128i alpha = _mm_srli_epi32(s, 24);
+    const __m128i a = _mm_or_si128(alpha, _mm_slli_epi32(alpha, 16));
+    const __m128i alo = _mm_unpacklo_epi32(a, a);
+    const __m128i ahi = _mm_unpackhi_epi32(a, a);
+    const __m128i m0 = _mm_cmpeq_epi32(alpha, zero);
+    const __m128i m255 = _mm_cmpeq_epi32(alpha, _mm_set1_epi32(255));
+    __m128i lo, hi;
+
+    lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(s, zero), _mm_or_si128(_mm_and_si128(alo, colors), salpha)),
+                       _mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), _mm_sub_epi16(dbase, alo)));
+    hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(s, zero), _mm_or_si128(_mm_and_si128(ahi, colors), salpha)),
+                       _mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), _mm_sub_epi16(dbase, ahi)));
+    lo = _mm_packus_epi16(_mm_srli_epi16(lo, 8), _mm_srli_epi16(hi, 8));
+
+    /* Transparent pixels are left alone, opaque ones copied */
+    lo = _mm_andnot_si128(_mm_or_si128(m0, m255), lo);
+    return _mm_or_si128(lo, _mm_or_si128(_mm_and_si128(m0, d), _mm_and_si128(m255, s)));
+}
+
+/* fast ARGB888->(A)RGB888 blending with pixel alpha */
+static void
+BlitRGBtoRGBPixelAlphaSSE2(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *) info->dst;
+    int dstskip = info->dst_skip >> 2;
+    const __m128i amask = _mm_set1_epi32(0xff000000);
+
+    while (height--) {
+        int n;
+
+        for (n = width; n >= 4; n -= 4) {
+            const __m128i s = _mm_loadu_si128((const __m128i *) srcp);
+            const __m128i alpha = _mm_and_si128(s, amask);
+
+            if (_mm_movemask_epi8(_mm_cmpeq_epi32(alpha, amask)) == 0xffff) {
+                _mm_storeu_si128((__m128i *) dstp, s);
+            } else if (_mm_movemask_epi8(_mm_cmpeq_epi32(alpha, _mm_setzero_si128())) != 0xffff) {
+                const __m128i d = _mm_loadu_si128((const __m128i *) dstp);
+                _mm_storeu_si128((__m128i *) dstp, BlendPixelAlphaSSE2(s, d));
+            }
+            srcp += 4;
+            dstp += 4;
+        }
+        BlitRowTail(info, srcp, dstp, n, BlitRGBtoRGBPixelAlpha);
+        srcp += n + srcskip;
+        dstp += n + dstskip;
+    }
+}
+
+/* fast RGB888->(A)RGB888 blending with surface alpha */
+static void
+BlitRGBtoRGBSurfaceAlphaSSE2(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *) info->dst;
+    int dstskip = info->dst_skip >> 2;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i sfactor = _mm_set1_epi16(info->a);
+    const __m128i dfactor = _mm_set1_epi16(256 - info->a);
+    const __m128i amask = _mm_set1_epi32(0xff000000);
+
+    while (height--) {
+        int n;
+
+        for (n = width; n >= 4; n -= 4) {
+            const __m128i s = _mm_loadu_si128((const __m128i *) srcp);
+            const __m128i d = _mm_loadu_si128((const __m128i *) dstp);
+            __m128i lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(s, zero), sfactor),
+                                       _mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), dfactor));
+            __m128i hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(s, zero), sfactor),
+                                       _mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), dfactor));
+
+            lo = _mm_packus_epi16(_mm_srli_epi16(lo, 8), _mm_srli_epi16(hi, 8));
+            _mm_storeu_si128((__m128i *) dstp, _mm_or_si128(lo, amask));
+            srcp += 4;
+            dstp += 4;
+        }
+        BlitRowTail(info, srcp, dstp, n, BlitRGBtoRGBSurfaceAlpha);
+        srcp += n + srcskip;
+        dstp += n + dstskip;
+    }
+}
+#endif /* HAVE_SSE2_INTRINSICS */
+
+#if HAVE_AVX2_INTRINSICS
+static SDL_INLINE SDL_TARGET_AVX2 __m256i
+BlendPixelAlphaAVX2(__m256i s, __m256i d)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i dbase = _mm256_set_epi16(255, 256, 256, 256, 255, 256, 256, 256,
+                                           255, 256, 256, 256, 255, 256, 256, 256);
+    const __m256i salpha = _mm256_set_epi16(256, 0, 0, 0, 256, 0, 0, 0,
+                                            256, 0, 0, 0, 256, 0, 0, 0);
+    const __m256i colors = _mm256_set_epi16(0, -1, -1, -1, 0, -1, -1, -1,
+                                            0, -1, -1, -1, 0, -1, -1, -1);
+    const __m256i alpha = _mm256_srli_epi32(s, 24);
+    const __m256i a = _mm256_or_si256(alpha, _mm256_slli_epi32(alpha, 16));
+    const __m256i alo = _mm256_unpacklo_epi32(a, a);
+    const __m256i ahi = _mm256_unpackhi_epi32(a, a);
+    const __m256i m0 = _mm256_cmpeq_epi32(alpha, zero);
+    const __m256i m255 = _mm256_cmpeq_epi32(alpha, _mm256_set1_epi32(255));
+    __m256i lo, hi;
+
+    lo = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(s, zero), _mm256_or_si256(_mm256_and_si256(alo, colors), salpha)),
+                          _mm256_mullo_epi16(_mm256_unpacklo_epi8(d, zero), _mm256_sub_epi16(dbase, alo)));
+    hi = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(s, zero), _mm256_or_si256(_mm256_and_si256(ahi, colors), salpha)),
+                          _mm256_mullo_epi16(_mm256_unpackhi_epi8(d, zero), _mm256_sub_epi16(dbase, ahi)));
+    lo = _mm256_packus_epi16(_mm256_srli_epi16(lo, 8), _mm256_srli_epi16(hi, 8));
+
+    lo = _mm256_andnot_si256(_mm256_or_si256(m0, m255), lo);
+    return _mm256_or_si256(lo, _mm256_or_si256(_mm256_and_si256(m0, d), _mm256_and_si256(m255, s)));
+}
+
+/* fast ARGB888->(A)RGB888 blending with pixel alpha */
+static SDL_TARGET_AVX2 void
+BlitRGBtoRGBPixelAlphaAVX2(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *) info->dst;
+    int dstskip = info->dst_skip >> 2;
+    const __m256i amask = _mm256_set1_epi32(0xff000000);
+
+    while (height--) {
+        int n;
+
+        for (n = width; n >= 8; n -= 8) {
+            const __m256i s = _mm256_loadu_si256((const __m256i *) srcp);
+            const __m256i alpha = _mm256_and_si256(s, amask);
+
+            if (_mm256_movemask_epi8(_mm256_cmpeq_epi32(alpha, amask)) == -1) {
+                _mm256_storeu_si256((__m256i *) dstp, s);
+            } else if (!_mm256_testz_si256(alpha, alpha)) {
+                const __m256i d = _mm256_loadu_si256((const __m256i *) dstp);
+                _mm256_storeu_si256((__m256i *) dstp, BlendPixelAlphaAVX2(s, d));
+            }
+            srcp += 8;
+            dstp += 8;
+        }
+        BlitRowTail(info, srcp, dstp, n, BlitRGBtoRGBPixelAlpha);
+        srcp += n + srcskip;
+        dstp += n + dstskip;
+    }
+}
+
+/* fast RGB888->(A)RGB888 blending with surface alpha */
+static SDL_TARGET_AVX2 void
+BlitRGBtoRGBSurfaceAlphaAVX2(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *) info->dst;
+    int dstskip = info->dst_skip >> 2;
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i sfactor = _mm256_set1_epi16(info->a);
+    const __m256i dfactor = _mm256_set1_epi16(256 - info->a);
+    const __m256i amask = _mm256_set1_epi32(0xff000000);
+
+    while (height--) {
+        int n;
+
+        for (n = width; n >= 8; n -= 8) {
+            const __m256i s = _mm256_loadu_si256((const __m256i *) srcp);
+            const __m256i d = _mm256_loadu_si256((const __m256i *) dstp);
+            __m256i lo = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(s, zero), sfactor),
+                                          _mm256_mullo_epi16(_mm256_unpacklo_epi8(d, zero), dfactor));
+            __m256i hi = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(s, zero), sfactor),
+                                          _mm256_mullo_epi16(_mm256_unpackhi_epi8(d, zero), dfactor));
+
+            lo = _mm256_packus_epi16(_mm256_srli_epi16(lo, 8), _mm256_srli_epi16(hi, 8));
+            _mm256_storeu_si256((__m256i *) dstp, _mm256_or_si256(lo, amask));
+            srcp += 8;
+            dstp += 8;
+        }
+        BlitRowTail(info, srcp, dstp, n, BlitRGBtoRGBSurfaceAlpha);
+        srcp += n + srcskip;
+        dstp += n + dstskip;
+    }
+}
+#endif /* HAVE_AVX2_INTRINSICS */
+
+#if HAVE_NEON_INTRINSICS
+/* (d * (256 - alpha) + s * alpha) >> 8, the 16-bit intermediate may wrap */
+static SDL_INLINE uint8x8_t
+BlendChannelNEON(uint8x8_t s, uint8x8_t d, uint8x8_t alpha)
+{
+    return vshrn_n_u16(vmlsl_u8(vmlal_u8(vshll_n_u8(d, 8), s, alpha), d, alpha), 8);
+}
+
+/* fast ARGB888->(A)RGB888 blending with pixel alpha */
+static void
+BlitRGBtoRGBPixelAlphaNEON(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *) info->dst;
+    int dstskip = info->dst_skip >> 2;
+
+    while (height--) {
+        int n;
+
+        for (n = width; n >= 8; n -= 8) {
+            const uint8x8x4_t s = vld4_u8((const uint8_t *) srcp);
+            const uint8x8_t alpha = s.val[3];
+            const uint64_t all = vget_lane_u64(vreinterpret_u64_u8(alpha), 0);
+
+            if (all == ~(uint64_t) 0) {
+                vst1q_u32(dstp, vld1q_u32(srcp));
+                vst1q_u32(dstp + 4, vld1q_u32(srcp + 4));
+            } else if (all != 0) {
+                const uint8x8_t m0 = vceq_u8(alpha, vdup_n_u8(0));
+                const uint8x8_t m255 = vceq_u8(alpha, vdup_n_u8(255));
+                uint8x8x4_t d = vld4_u8((const uint8_t *) dstp);
+                int i;
+
+                for (i = 0; i < 3; ++i) {
+                    d.val[i] = vbsl_u8(m255, s.val[i], vbsl_u8(m0, d.val[i], BlendChannelNEON(s.val[i], d.val[i], alpha)));
+                }
+                d.val[3] = vbsl_u8(m255, alpha, vbsl_u8(m0, d.val[3], vadd_u8(alpha, vshrn_n_u16(vmull_u8(d.val[3], vmvn_u8(alpha)), 8))));
+                vst4_u8((uint8_t *) dstp, d);
+            }
+            srcp += 8;
+            dstp += 8;
+        }
+        BlitRowTail(info, srcp, dstp, n, BlitRGBtoRGBPixelAlpha);
+        srcp += n + srcskip;
+        dstp += n + dstskip;
+    }
+}
+
+/* fast RGB888->(A)RGB888 blending with surface alpha */
+static void
+BlitRGBtoRGBSurfaceAlphaNEON(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *) info->dst;
+    int dstskip = info->dst_skip >> 2;
+    const uint8x8_t alpha = vdup_n_u8(info->a);
+
+    while (height--) {
+        int n;
+
+        for (n = width; n >= 8; n -= 8) {
+            const uint8x8x4_t s = vld4_u8((const uint8_t *) srcp);
+            uint8x8x4_t d = vld4_u8((const uint8_t *) dstp);
+            int i;
+
+            for (i = 0; i < 3; ++i) {
+                d.val[i] = BlendChannelNEON(s.val[i], d.val[i], alpha);
+            }
+            d.val[3] = vdup_n_u8(0xff);
+            vst4_u8((uint8_t *) dstp, d);
+            srcp += 8;
+            dstp += 8;
+        }
+        BlitRowTail(info, srcp, dstp, n, BlitRGBtoRGBSurfaceAlpha);
+        srcp += n + srcskip;
+        dstp += n + dstskip;
+    }
+}
+#endif /* HAVE_NEON_INTRINSICS */
+
 /* 16bpp special case for per-surface alpha=50%: blend 2 pixels in parallel */
 
 /* blend a single 16 bit pixel at 50% */
@@ -1294,6 +1613,20 @@ SDL_CalculateBlitA(SDL_Surface * surface)
             if (sf->Rmask == df->Rmask
                 && sf->Gmask == df->Gmask
                 && sf->Bmask == df->Bmask && sf->BytesPerPixel == 4) {
+                if (sf->Amask == 0xff000000) {
+#if HAVE_AVX2_INTRINSICS
+                    if (SDL_HasAVX2())
+                        return BlitRGBtoRGBPixelAlphaAVX2;
+#endif
+#if HAVE_SSE2_INTRINSICS
+                    if (SDL_HasSSE2())
+                        return BlitRGBtoRGBPixelAlphaSSE2;
+#endif
+#if HAVE_NEON_INTRINSICS
+                    if (SDL_HasNEON())
+                        return BlitRGBtoRGBPixelAlphaNEON;
+#endif
+                }
 #if defined(__MMX__) || defined(__3dNOW__)
                 if (sf->Rshift % 8 == 0
                     && sf->Gshift % 8 == 0
@@ -1352,6 +1685,20 @@ SDL_CalculateBlitA(SDL_Surface * surface)
                 if (sf->Rmask == df->Rmask
                     && sf->Gmask == df->Gmask
                     && sf->Bmask == df->Bmask && sf->BytesPerPixel == 4) {
+                    if ((sf->Rmask | sf->Gmask | sf->Bmask) == 0xffffff) {
+#if HAVE_AVX2_INTRINSICS
+                        if (SDL_HasAVX2())
+                            return BlitRGBtoRGBSurfaceAlphaAVX2;
+#endif
+#if HAVE_SSE2_INTRINSICS
+                        if (SDL_HasSSE2())
+                            return BlitRGBtoRGBSurfaceAlphaSSE2;
+#endif
+#if HAVE_NEON_INTRINSICS
+                        if (SDL_HasNEON())
+                            return BlitRGBtoRGBSurfaceAlphaNEON;
+#endif
+                    }
 #ifdef __MMX__
                     if (sf->Rshift % 8 == 0
                         && sf->Gshift % 8 == 0
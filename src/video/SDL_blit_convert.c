@@ -0,0 +1,466 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2017 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../SDL_internal.h"
+
+#include "SDL_video.h"
+#include "SDL_cpuinfo.h"
+#include "SDL_blit.h"
+
+/* Direct conversion between RGB formats, for SDL_ConvertPixels().
+
+   Every destination channel is a few bits of the source pixel moved into
+   place, so a conversion is a short list of (shift, mask) operations whose
+   results are or'ed together; narrowed channels are truncated like
+   PIXEL_FROM_RGBA(). Channels widened from 16-bit formats are scaled by a
+   multiply and shift that gives the same values as SDL_expand_byte, and a
+   destination alpha channel without a source one is filled in as opaque.
+   The results are the same as blitting with no blend mode.
+*/
+
+#ifdef __SSE2__
+#define HAVE_SSE2_INTRINSICS 1
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define HAVE_NEON_INTRINSICS 1
+#endif
+
+/* At most 4 channels, some split in two by the 16-bit packing */
+#define CONVERT_MAX_OPS 8
+
+typedef struct
+{
+    int src_shift;                      /* moves the channel to bit 0 */
+    Uint32 src_mask;
+    int mul, add, shift;                /* (v * mul + add) >> shift */
+    int dst_shift;
+} SDL_ConvertExpand;
+
+typedef struct
+{
+    int src_bpp;
+    int dst_bpp;
+    int num_ops;
+    int shifts[CONVERT_MAX_OPS];        /* left if positive, right if not */
+    Uint32 masks[CONVERT_MAX_OPS];      /* applied after the shift */
+    int num_expand;
+    SDL_ConvertExpand expand[4];        /* widened channels */
+    Uint32 fill;                        /* or'ed into every pixel */
+} SDL_PixelConverter;
+
+typedef struct
+{
+    const SDL_PixelConverter *converter;
+    int width;
+    const Uint8 *src;
+    int src_pitch;
+    Uint8 *dst;
+    int dst_pitch;
+} SDL_ConvertRows;
+
+typedef struct
+{
+    int shift;
+    int bits;
+} SDL_ConvertChannel;
+
+static SDL_bool
+SDL_GetConvertFormat(Uint32 format, int *bpp, SDL_ConvertChannel channels[4])
+{
+    Uint32 masks[4];
+    int bits, i;
+
+    if (SDL_ISPIXELFORMAT_INDEXED(format) || SDL_ISPIXELFORMAT_FOURCC(format)) {
+        return SDL_FALSE;
+    }
+    *bpp = SDL_BYTESPERPIXEL(format);
+    if (*bpp < 2 || *bpp > 4 ||
+        !SDL_PixelFormatEnumToMasks(format, &bits, &masks[0], &masks[1], &masks[2], &masks[3])) {
+        return SDL_FALSE;
+    }
+
+    for (i = 0; i < 4; ++i) {
+        Uint32 mask = masks[i];
+        channels[i].shift = 0;
+        channels[i].bits = 0;
+        if (!mask) {
+            continue;
+        }
+        while (!(mask & 1)) {
+            mask >>= 1;
+            ++channels[i].shift;
+        }
+        while (mask & 1) {
+            mask >>= 1;
+            ++channels[i].bits;
+        }
+        /* Widening is only done from 4, 5 and 6 bits, and 1-bit alpha */
+        if (channels[i].bits > 8 || (channels[i].bits < 4 && !(i == 3 && channels[i].bits == 1))) {
+            return SDL_FALSE;
+        }
+    }
+    /* Every format here has color */
+    return (channels[0].bits && channels[1].bits && channels[2].bits);
+}
+
+static void
+SDL_AddConvertOp(SDL_PixelConverter * converter, int shift, Uint32 mask)
+{
+    int i;
+
+    for (i = 0; i < converter->num_ops; ++i) {
+        if (converter->shifts[i] == shift) {
+            converter->masks[i] |= mask;
+            return;
+        }
+    }
+    converter->shifts[converter->num_ops] = shift;
+    converter->masks[converter->num_ops] = mask;
+    ++converter->num_ops;
+}
+
+static SDL_bool
+SDL_InitPixelConverter(SDL_PixelConverter * converter, Uint32 src_format, Uint32 dst_format)
+{
+    SDL_ConvertChannel src[4], dst[4];
+    int i;
+
+    if (!SDL_GetConvertFormat(src_format, &converter->src_bpp, src) ||
+        !SDL_GetConvertFormat(dst_format, &converter->dst_bpp, dst)) {
+        return SDL_FALSE;
+    }
+    /* Channels are only widened to 8 bits, and 16 to 16 bits is rare */
+    if (converter->src_bpp == 2 && converter->dst_bpp == 2) {
+        return SDL_FALSE;
+    }
+    /* SDL_blit_N.c has lookup tables for these, with slightly different
+       rounding and opaque padding bytes, so keep their results */
+    if (src_format == SDL_PIXELFORMAT_RGB565 && converter->dst_bpp == 4) {
+        return SDL_FALSE;
+    }
+
+    converter->num_ops = 0;
+    converter->num_expand = 0;
+    converter->fill = 0;
+    for (i = 0; i < 4; ++i) {
+        const int b = src[i].bits;
+        const int e = dst[i].bits;
+        const int d = dst[i].shift;
+
+        if (!e) {
+            continue;
+        }
+        if (!b) {
+            /* Opaque alpha */
+            converter->fill |= ((1u << e) - 1) << d;
+        } else if (b == e) {
+            SDL_AddConvertOp(converter, d - src[i].shift, ((1u << e) - 1) << d);
+        } else if (b > e) {
+            SDL_AddConvertOp(converter, d - (src[i].shift + b - e), ((1u << e) - 1) << d);
+        } else if (e == 8) {
+            /* v * 255 / (2^b - 1), rounded down; v * mul stays within 16 bits */
+            SDL_ConvertExpand *expand = &converter->expand[converter->num_expand++];
+            expand->src_shift = src[i].shift;
+            expand->src_mask = (1u << b) - 1;
+            expand->dst_shift = d;
+            switch (b) {
+            case 1:
+                expand->mul = 255; expand->add = 0; expand->shift = 0;
+                break;
+            case 4:
+                expand->mul = 17; expand->add = 0; expand->shift = 0;
+                break;
+            case 5:
+                expand->mul = 1053; expand->add = 0; expand->shift = 7;
+                break;
+            case 6:
+                expand->mul = 259; expand->add = 3; expand->shift = 6;
+                break;
+            default:
+                return SDL_FALSE;
+            }
+        } else {
+            return SDL_FALSE;
+        }
+    }
+    return SDL_TRUE;
+}
+
+#define CONVERT_SHIFT(p, shift) \
+    (((shift) >= 0) ? ((p) << (shift)) : ((p) >> -(shift)))
+
+static SDL_INLINE Uint32
+SDL_ConvertPixel(const SDL_PixelConverter * converter, Uint32 p)
+{
+    Uint32 result = converter->fill;
+    int i;
+
+    for (i = 0; i < converter->num_ops; ++i) {
+        result |= CONVERT_SHIFT(p, converter->shifts[i]) & converter->masks[i];
+    }
+    for (i = 0; i < converter->num_expand; ++i) {
+        const SDL_ConvertExpand *expand = &converter->expand[i];
+        const Uint32 v = (p >> expand->src_shift) & expand->src_mask;
+        result |= ((v * expand->mul + expand->add) >> expand->shift) << expand->dst_shift;
+    }
+    return result;
+}
+
+/* Any pair of formats, 24-bit pixels are read and written like
+   RETRIEVE_RGB_PIXEL() and ASSEMBLE_RGB() do */
+static void
+SDL_ConvertRow_scalar(const SDL_PixelConverter * converter, const Uint8 * src, Uint8 * dst, int width)
+{
+    const int src_bpp = converter->src_bpp;
+    const int dst_bpp = converter->dst_bpp;
+    int x;
+
+    for (x = 0; x < width; ++x, src += src_bpp, dst += dst_bpp) {
+        Uint32 p;
+
+        switch (src_bpp) {
+        case 2:
+            p = *(const Uint16 *) src;
+            break;
+        case 3:
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+            p = src[0] | (src[1] << 8) | (src[2] << 16);
+#else
+            p = (src[0] << 16) | (src[1] << 8) | src[2];
+#endif
+            break;
+        default:
+            p = *(const Uint32 *) src;
+            break;
+        }
+
+        p = SDL_ConvertPixel(converter, p);
+
+        switch (dst_bpp) {
+        case 2:
+            *(Uint16 *) dst = (Uint16) p;
+            break;
+        case 3:
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+            dst[0] = (Uint8) p;
+            dst[1] = (Uint8) (p >> 8);
+            dst[2] = (Uint8) (p >> 16);
+#else
+            dst[0] = (Uint8) (p >> 16);
+            dst[1] = (Uint8) (p >> 8);
+            dst[2] = (Uint8) p;
+#endif
+            break;
+        default:
+            *(Uint32 *) dst = p;
+            break;
+        }
+    }
+}
+
+#if HAVE_SSE2_INTRINSICS
+/* 4 pixels at once; a shift left then right keeps the branches out */
+static void
+SDL_ConvertRow_SSE2(const SDL_PixelConverter * converter, const Uint8 * src, Uint8 * dst, int width)
+{
+    __m128i left[CONVERT_MAX_OPS], right[CONVERT_MAX_OPS], masks[CONVERT_MAX_OPS];
+    const __m128i fill = _mm_set1_epi32((int) converter->fill);
+    __m128i expand_src[4], expand_mask[4], expand_mul[4], expand_add[4], expand_shift[4], expand_dst[4];
+    const __m128i zero = _mm_setzero_si128();
+    const int num_ops = converter->num_ops;
+    const int num_expand = converter->num_expand;
+    const int src_bpp = converter->src_bpp;
+    const int dst_bpp = converter->dst_bpp;
+    /* 24-bit pixels are read 4 bytes at a time, touching the next pixel */
+    const int overrun = (src_bpp == 3) ? 1 : 0;
+    int i, x;
+
+    for (i = 0; i < num_expand; ++i) {
+        const SDL_ConvertExpand *expand = &converter->expand[i];
+        expand_src[i] = _mm_cvtsi32_si128(expand->src_shift);
+        expand_mask[i] = _mm_set1_epi32((int) expand->src_mask);
+        expand_mul[i] = _mm_set1_epi32(expand->mul);
+        expand_add[i] = _mm_set1_epi32(expand->add);
+        expand_shift[i] = _mm_cvtsi32_si128(expand->shift);
+        expand_dst[i] = _mm_cvtsi32_si128(expand->dst_shift);
+    }
+    for (i = 0; i < num_ops; ++i) {
+        left[i] = _mm_cvtsi32_si128(SDL_max(converter->shifts[i], 0));
+        right[i] = _mm_cvtsi32_si128(SDL_max(-converter->shifts[i], 0));
+        masks[i] = _mm_set1_epi32((int) converter->masks[i]);
+    }
+
+    for (x = 0; x + 4 + overrun <= width; x += 4) {
+        __m128i p, result = fill;
+
+        if (src_bpp == 2) {
+            p = _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i *) (src + x * 2)), zero);
+        } else if (src_bpp == 3) {
+            /* The stray top bytes are outside every channel mask */
+            const Uint8 *s = src + x * 3;
+            p = _mm_setr_epi32(*(const int *) s, *(const int *) (s + 3),
+                               *(const int *) (s + 6), *(const int *) (s + 9));
+        } else {
+            p = _mm_loadu_si128((const __m128i *) (src + x * 4));
+        }
+        for (i = 0; i < num_ops; ++i) {
+            const __m128i t = _mm_srl_epi32(_mm_sll_epi32(p, left[i]), right[i]);
+            result = _mm_or_si128(result, _mm_and_si128(t, masks[i]));
+        }
+        for (i = 0; i < num_expand; ++i) {
+            /* The high halves are zero, so a 16-bit multiply will do */
+            __m128i v = _mm_and_si128(_mm_srl_epi32(p, expand_src[i]), expand_mask[i]);
+            v = _mm_add_epi32(_mm_mullo_epi16(v, expand_mul[i]), expand_add[i]);
+            v = _mm_sll_epi32(_mm_srl_epi32(v, expand_shift[i]), expand_dst[i]);
+            result = _mm_or_si128(result, v);
+        }
+        if (dst_bpp == 2) {
+            /* Sign extended, the saturating pack keeps the low 16 bits */
+            result = _mm_srai_epi32(_mm_slli_epi32(result, 16), 16);
+            _mm_storel_epi64((__m128i *) (dst + x * 2), _mm_packs_epi32(result, result));
+        } else if (dst_bpp == 3) {
+            /* In order, each store overwrites the previous stray byte. The
+               last one is exact, the next pixel may not be read yet when
+               converting in place. */
+            Uint8 *d = dst + x * 3;
+            const int last = _mm_cvtsi128_si32(_mm_srli_si128(result, 12));
+            *(int *) d = _mm_cvtsi128_si32(result);
+            *(int *) (d + 3) = _mm_cvtsi128_si32(_mm_srli_si128(result, 4));
+            *(int *) (d + 6) = _mm_cvtsi128_si32(_mm_srli_si128(result, 8));
+            SDL_memcpy(d + 9, &last, 3);
+        } else {
+            _mm_storeu_si128((__m128i *) (dst + x * 4), result);
+        }
+    }
+    SDL_ConvertRow_scalar(converter, src + x * src_bpp, dst + x * dst_bpp, width - x);
+}
+#endif /* HAVE_SSE2_INTRINSICS */
+
+#if HAVE_NEON_INTRINSICS
+/* 4 pixels at once, NEON shifts right by negative counts */
+static void
+SDL_ConvertRow_NEON(const SDL_PixelConverter * converter, const Uint8 * src, Uint8 * dst, int width)
+{
+    int32x4_t shifts[CONVERT_MAX_OPS];
+    uint32x4_t masks[CONVERT_MAX_OPS];
+    const uint32x4_t fill = vdupq_n_u32(converter->fill);
+    int32x4_t expand_src[4], expand_shift[4], expand_dst[4];
+    uint32x4_t expand_mask[4], expand_add[4];
+    const int num_ops = converter->num_ops;
+    const int num_expand = converter->num_expand;
+    const int src_bpp = converter->src_bpp;
+    const int dst_bpp = converter->dst_bpp;
+    int i, x;
+
+    for (i = 0; i < num_expand; ++i) {
+        const SDL_ConvertExpand *expand = &converter->expand[i];
+        expand_src[i] = vdupq_n_s32(-expand->src_shift);
+        expand_mask[i] = vdupq_n_u32(expand->src_mask);
+        expand_add[i] = vdupq_n_u32((Uint32) expand->add);
+        expand_shift[i] = vdupq_n_s32(-expand->shift);
+        expand_dst[i] = vdupq_n_s32(expand->dst_shift);
+    }
+
+    for (i = 0; i < num_ops; ++i) {
+        shifts[i] = vdupq_n_s32(converter->shifts[i]);
+        masks[i] = vdupq_n_u32(converter->masks[i]);
+    }
+
+    for (x = 0; x + 4 <= width; x += 4) {
+        uint32x4_t p, result = fill;
+
+        if (src_bpp == 2) {
+            p = vmovl_u16(vld1_u16((const uint16_t *) (src + x * 2)));
+        } else {
+            p = vld1q_u32((const uint32_t *) (src + x * 4));
+        }
+        for (i = 0; i < num_ops; ++i) {
+            result = vorrq_u32(result, vandq_u32(vshlq_u32(p, shifts[i]), masks[i]));
+        }
+        for (i = 0; i < num_expand; ++i) {
+            uint32x4_t v = vandq_u32(vshlq_u32(p, expand_src[i]), expand_mask[i]);
+            v = vmlaq_n_u32(expand_add[i], v, (Uint32) converter->expand[i].mul);
+            result = vorrq_u32(result, vshlq_u32(vshlq_u32(v, expand_shift[i]), expand_dst[i]));
+        }
+        if (dst_bpp == 2) {
+            vst1_u16((uint16_t *) (dst + x * 2), vmovn_u32(result));
+        } else {
+            vst1q_u32((uint32_t *) (dst + x * 4), result);
+        }
+    }
+    SDL_ConvertRow_scalar(converter, src + x * src_bpp, dst + x * dst_bpp, width - x);
+}
+#endif /* HAVE_NEON_INTRINSICS */
+
+static int
+SDL_ConvertRowsFunc(void *data, int first, int last)
+{
+    const SDL_ConvertRows *rows = (const SDL_ConvertRows *) data;
+    const SDL_PixelConverter *converter = rows->converter;
+    void (*convert_row) (const SDL_PixelConverter *, const Uint8 *, Uint8 *, int) = SDL_ConvertRow_scalar;
+    int y;
+
+#if HAVE_SSE2_INTRINSICS
+    if (SDL_HasSSE2()) {
+        convert_row = SDL_ConvertRow_SSE2;
+    }
+#endif
+#if HAVE_NEON_INTRINSICS
+    /* The NEON kernel only reads and writes whole 16 and 32-bit pixels */
+    if (SDL_HasNEON() && converter->src_bpp != 3 && converter->dst_bpp != 3) {
+        convert_row = SDL_ConvertRow_NEON;
+    }
+#endif
+
+    for (y = first; y < last; ++y) {
+        convert_row(converter, rows->src + y * rows->src_pitch,
+                    rows->dst + y * rows->dst_pitch, rows->width);
+    }
+    return 0;
+}
+
+SDL_bool
+SDL_ConvertPixelsRGB(int width, int height,
+                     Uint32 src_format, const void * src, int src_pitch,
+                     Uint32 dst_format, void * dst, int dst_pitch)
+{
+    SDL_PixelConverter converter;
+    SDL_ConvertRows rows;
+
+    if (!SDL_InitPixelConverter(&converter, src_format, dst_format)) {
+        return SDL_FALSE;
+    }
+    if (width <= 0 || height <= 0) {
+        return SDL_TRUE;
+    }
+
+    rows.converter = &converter;
+    rows.width = width;
+    rows.src = (const Uint8 *) src;
+    rows.src_pitch = src_pitch;
+    rows.dst = (Uint8 *) dst;
+    rows.dst_pitch = dst_pitch;
+    SDL_RunBlitRows(SDL_ConvertRowsFunc, &rows, height, (Sint64) width * height);
+    return SDL_TRUE;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,312 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2017 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../SDL_internal.h"
+
+#include "SDL_video.h"
+#include "SDL_cpuinfo.h"
+#include "SDL_blit.h"
+
+/* Color and alpha modulation of 32-bit pixels.
+
+   Every byte is multiplied by the byte at the same position of the
+   modulation pixel. The division by 255 is done as
+
+       x / 255 == (x + 1 + (x >> 8)) >> 8   for 0 <= x <= 255 * 255
+
+   which fits in 16 bits, so the SIMD versions work on 8 bytes per vector
+   half and give exactly the same results as the lookup tables.
+*/
+
+#ifdef __SSE2__
+#define HAVE_SSE2_INTRINSICS 1
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define HAVE_NEON_INTRINSICS 1
+#endif
+
+#if SDL_ALTIVEC_BLITTERS && defined(__ALTIVEC__)
+#define HAVE_ALTIVEC_INTRINSICS 1
+#endif
+
+#define DIV255(x)   (((x) + 1 + ((x) >> 8)) >> 8)
+
+static SDL_INLINE Uint32
+modulate_pixel(Uint32 pixel, Uint32 modulation)
+{
+    Uint32 result = 0;
+    int shift;
+
+    for (shift = 0; shift < 32; shift += 8) {
+        const Uint32 x = ((pixel >> shift) & 0xFF) * ((modulation >> shift) & 0xFF);
+        result |= DIV255(x) << shift;
+    }
+    return result;
+}
+
+static void
+modulate_rows_scalar(const Uint8 *src, int src_pitch, Uint8 *dst, int dst_pitch,
+                     int width, int height, Uint32 modulation)
+{
+    Uint8 lut[4][256];
+    int x, i;
+
+    if (width * height < 256) {
+        /* Not worth building the tables */
+        while (height--) {
+            const Uint32 *s = (const Uint32 *) src;
+            Uint32 *d = (Uint32 *) dst;
+
+            for (x = 0; x < width; ++x) {
+                d[x] = modulate_pixel(s[x], modulation);
+            }
+            src += src_pitch;
+            dst += dst_pitch;
+        }
+        return;
+    }
+
+    for (i = 0; i < 4; ++i) {
+        const Uint32 m = (modulation >> (i * 8)) & 0xFF;
+
+        for (x = 0; x < 256; ++x) {
+            lut[i][x] = (Uint8) DIV255(x * m);
+        }
+    }
+
+    while (height--) {
+        const Uint32 *s = (const Uint32 *) src;
+        Uint32 *d = (Uint32 *) dst;
+
+        for (x = 0; x < width; ++x) {
+            const Uint32 p = s[x];
+
+            d[x] = (Uint32) lut[0][p & 0xFF] |
+                   ((Uint32) lut[1][(p >> 8) & 0xFF] << 8) |
+                   ((Uint32) lut[2][(p >> 16) & 0xFF] << 16) |
+                   ((Uint32) lut[3][p >> 24] << 24);
+        }
+        src += src_pitch;
+        dst += dst_pitch;
+    }
+}
+
+#if HAVE_SSE2_INTRINSICS
+static void
+modulate_rows_SSE2(const Uint8 *src, int src_pitch, Uint8 *dst, int dst_pitch,
+                   int width, int height, Uint32 modulation)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i one = _mm_set1_epi16(1);
+    const __m128i m = _mm_unpacklo_epi8(_mm_set1_epi32((int) modulation), zero);
+
+    while (height--) {
+        const Uint32 *s = (const Uint32 *) src;
+        Uint32 *d = (Uint32 *) dst;
+        int x;
+
+        for (x = 0; x + 4 <= width; x += 4) {
+            const __m128i v = _mm_loadu_si128((const __m128i *) &s[x]);
+            __m128i lo = _mm_mullo_epi16(_mm_unpacklo_epi8(v, zero), m);
+            __m128i hi = _mm_mullo_epi16(_mm_unpackhi_epi8(v, zero), m);
+
+            lo = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(lo, _mm_srli_epi16(lo, 8)), one), 8);
+            hi = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(hi, _mm_srli_epi16(hi, 8)), one), 8);
+            _mm_storeu_si128((__m128i *) &d[x], _mm_packus_epi16(lo, hi));
+        }
+        for (; x < width; ++x) {
+            d[x] = modulate_pixel(s[x], modulation);
+        }
+        src += src_pitch;
+        dst += dst_pitch;
+    }
+}
+#endif /* HAVE_SSE2_INTRINSICS */
+
+#if HAVE_NEON_INTRINSICS
+static void
+modulate_rows_NEON(const Uint8 *src, int src_pitch, Uint8 *dst, int dst_pitch,
+                   int width, int height, Uint32 modulation)
+{
+    const uint8x8_t m = vreinterpret_u8_u32(vdup_n_u32(modulation));
+    const uint16x8_t one = vdupq_n_u16(1);
+
+    while (height--) {
+        const Uint32 *s = (const Uint32 *) src;
+        Uint32 *d = (Uint32 *) dst;
+        int x;
+
+        for (x = 0; x + 4 <= width; x += 4) {
+            const uint8x16_t v = vld1q_u8((const uint8_t *) &s[x]);
+            uint16x8_t lo = vmull_u8(vget_low_u8(v), m);
+            uint16x8_t hi = vmull_u8(vget_high_u8(v), m);
+
+            lo = vaddq_u16(vaddq_u16(lo, vshrq_n_u16(lo, 8)), one);
+            hi = vaddq_u16(vaddq_u16(hi, vshrq_n_u16(hi, 8)), one);
+            vst1q_u8((uint8_t *) &d[x], vcombine_u8(vshrn_n_u16(lo, 8), vshrn_n_u16(hi, 8)));
+        }
+        for (; x < width; ++x) {
+            d[x] = modulate_pixel(s[x], modulation);
+        }
+        src += src_pitch;
+        dst += dst_pitch;
+    }
+}
+#endif /* HAVE_NEON_INTRINSICS */
+
+#if HAVE_ALTIVEC_INTRINSICS
+static void
+modulate_rows_AltiVec(const Uint8 *src, int src_pitch, Uint8 *dst, int dst_pitch,
+                      int width, int height, Uint32 modulation)
+{
+    const vector unsigned char zero = vec_splat_u8(0);
+    const vector unsigned short one = vec_splat_u16(1);
+    const vector unsigned short shift = vec_splat_u16(8);
+    vector unsigned short mhi, mlo;
+    union {
+        vector unsigned char v;
+        Uint32 u[4];
+    } m;
+
+    m.u[0] = m.u[1] = m.u[2] = m.u[3] = modulation;
+    mhi = (vector unsigned short) vec_mergeh(zero, m.v);
+    mlo = (vector unsigned short) vec_mergel(zero, m.v);
+
+    while (height--) {
+        const Uint32 *s = (const Uint32 *) src;
+        Uint32 *d = (Uint32 *) dst;
+        int x = 0;
+
+        /* Only the stores need to be aligned */
+        while (x < width && ((uintptr_t) &d[x] & 15)) {
+            d[x] = modulate_pixel(s[x], modulation);
+            ++x;
+        }
+        for (; x + 4 <= width; x += 4) {
+            const unsigned char *sp = (const unsigned char *) &s[x];
+            const vector unsigned char v = vec_perm(vec_ld(0, sp), vec_ld(15, sp), vec_lvsl(0, sp));
+            vector unsigned short hi = vec_mladd((vector unsigned short) vec_mergeh(zero, v), mhi, vec_splat_u16(0));
+            vector unsigned short lo = vec_mladd((vector unsigned short) vec_mergel(zero, v), mlo, vec_splat_u16(0));
+
+            hi = vec_sr(vec_add(vec_add(hi, vec_sr(hi, shift)), one), shift);
+            lo = vec_sr(vec_add(vec_add(lo, vec_sr(lo, shift)), one), shift);
+            vec_st(vec_packsu(hi, lo), 0, (unsigned char *) &d[x]);
+        }
+        for (; x < width; ++x) {
+            d[x] = modulate_pixel(s[x], modulation);
+        }
+        src += src_pitch;
+        dst += dst_pitch;
+    }
+}
+#endif /* HAVE_ALTIVEC_INTRINSICS */
+
+void
+SDL_Modulate32(const void *src, int src_pitch, void *dst, int dst_pitch,
+               int width, int height, Uint32 modulation)
+{
+    if (width <= 0 || height <= 0) {
+        return;
+    }
+
+#if HAVE_SSE2_INTRINSICS
+    if (SDL_HasSSE2()) {
+        modulate_rows_SSE2((const Uint8 *) src, src_pitch, (Uint8 *) dst, dst_pitch, width, height, modulation);
+        return;
+    }
+#endif
+#if HAVE_NEON_INTRINSICS
+    if (SDL_HasNEON()) {
+        modulate_rows_NEON((const Uint8 *) src, src_pitch, (Uint8 *) dst, dst_pitch, width, height, modulation);
+        return;
+    }
+#endif
+#if HAVE_ALTIVEC_INTRINSICS
+    if (SDL_HasAltiVec()) {
+        modulate_rows_AltiVec((const Uint8 *) src, src_pitch, (Uint8 *) dst, dst_pitch, width, height, modulation);
+        return;
+    }
+#endif
+    modulate_rows_scalar((const Uint8 *) src, src_pitch, (Uint8 *) dst, dst_pitch, width, height, modulation);
+}
+
+static void
+SDL_Blit_Modulate32(SDL_BlitInfo *info)
+{
+    const SDL_PixelFormat *fmt = info->src_fmt;
+    Uint32 modulation;
+
+    /* Unmodulated channels are multiplied by 255, the byte that isn't part
+       of a destination without alpha by 0 like the other blitters do */
+    if (info->flags & SDL_COPY_MODULATE_COLOR) {
+        modulation = ((Uint32) info->r << fmt->Rshift) |
+                     ((Uint32) info->g << fmt->Gshift) |
+                     ((Uint32) info->b << fmt->Bshift);
+    } else {
+        modulation = fmt->Rmask | fmt->Gmask | fmt->Bmask;
+    }
+    if (info->dst_fmt->Amask) {
+        if (info->flags & SDL_COPY_MODULATE_ALPHA) {
+            modulation |= (Uint32) info->a << fmt->Ashift;
+        } else {
+            modulation |= fmt->Amask;
+        }
+    }
+
+    SDL_Modulate32(info->src, info->src_pitch, info->dst, info->dst_pitch,
+                   info->dst_w, info->dst_h, modulation);
+}
+
+static SDL_bool
+IsByteMask(Uint32 mask)
+{
+    return (mask == 0x000000FF || mask == 0x0000FF00 ||
+            mask == 0x00FF0000 || mask == 0xFF000000);
+}
+
+SDL_BlitFunc
+SDL_CalculateBlitModulate(SDL_Surface * surface)
+{
+    const SDL_PixelFormat *srcfmt = surface->format;
+    const SDL_PixelFormat *dstfmt = surface->map->dst->format;
+    const int flags = surface->map->info.flags & ~SDL_COPY_RLE_MASK;
+
+    /* Unscaled modulated copies without blending or colorkey */
+    if (!(flags & (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA)) ||
+        (flags & ~(SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA))) {
+        return NULL;
+    }
+
+    /* Between 8888 formats with the same color layout, and the alpha kept
+       or dropped, so that every byte maps to the same byte */
+    if (srcfmt->BytesPerPixel != 4 || dstfmt->BytesPerPixel != 4 ||
+        !IsByteMask(srcfmt->Rmask) || !IsByteMask(srcfmt->Gmask) || !IsByteMask(srcfmt->Bmask) ||
+        srcfmt->Rmask != dstfmt->Rmask || srcfmt->Gmask != dstfmt->Gmask || srcfmt->Bmask != dstfmt->Bmask) {
+        return NULL;
+    }
+    if (dstfmt->Amask && dstfmt->Amask != srcfmt->Amask) {
+        return NULL;
+    }
+    return SDL_Blit_Modulate32;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -21,33 +21,546 @@
 #include "../SDL_internal.h"
 
 #include "SDL_video.h"
+#include "SDL_cpuinfo.h"
 #include "SDL_blit.h"
 #include "SDL_blit_slow.h"
 
 /* The ONE TRUE BLITTER
- * This puppy has to handle all the unoptimized cases - yes, it's slow.
+ * This puppy has to handle all the unoptimized cases.
+ *
+ * It works through each destination row in chunks: the source pixels are
+ * gathered and unpacked to ARGB8888, modulated, blended with the unpacked
+ * destination pixels and packed back, one whole chunk per step. That keeps
+ * the format and blend mode decisions out of the inner loops, and the steps
+ * for 32-bit formats and the blend modes have SSE2 versions. The division
+ * by 255 is done as
+ *
+ *     x / 255 == (x + 1 + (x >> 8)) >> 8   for 0 <= x <= 255 * 255
+ *
+ * so every step gives exactly the results of the per pixel formulas.
  */
+
+#ifdef __SSE2__
+#define HAVE_SSE2_INTRINSICS 1
+#endif
+
+#define DIV255(x)   (((x) + 1 + ((x) >> 8)) >> 8)
+
+/* Pixels per chunk, the buffers live on the stack */
+#define SLOW_CHUNK  256
+
+/* 32-bit formats with 8 bits per channel only need shifts */
+static SDL_bool
+is_8888(const SDL_PixelFormat *fmt)
+{
+    return (fmt->BytesPerPixel == 4 && !fmt->Rloss && !fmt->Gloss && !fmt->Bloss &&
+            (!fmt->Amask || !fmt->Aloss)) ? SDL_TRUE : SDL_FALSE;
+}
+
+static void
+unpack_8888_scalar(const Uint32 *src, Uint32 *dst, int n, const SDL_PixelFormat *fmt)
+{
+    const Uint32 alpha = fmt->Amask ? 0 : 0xFF000000;
+    const int Ashift = fmt->Amask ? fmt->Ashift : 0;
+    const Uint32 Amask = fmt->Amask ? 0xFF : 0;
+    int i;
+
+    for (i = 0; i < n; ++i) {
+        const Uint32 p = src[i];
+
+        dst[i] = alpha | (((p >> Ashift) & Amask) << 24) |
+                 (((p >> fmt->Rshift) & 0xFF) << 16) |
+                 (((p >> fmt->Gshift) & 0xFF) << 8) |
+                 ((p >> fmt->Bshift) & 0xFF);
+    }
+}
+
+static void
+pack_8888_scalar(const Uint32 *src, Uint32 *dst, int n, const SDL_PixelFormat *fmt)
+{
+    const int Ashift = fmt->Amask ? fmt->Ashift : 0;
+    const Uint32 Amask = fmt->Amask ? 0xFF : 0;
+    int i;
+
+    for (i = 0; i < n; ++i) {
+        const Uint32 c = src[i];
+
+        dst[i] = (((c >> 24) & Amask) << Ashift) |
+                 (((c >> 16) & 0xFF) << fmt->Rshift) |
+                 (((c >> 8) & 0xFF) << fmt->Gshift) |
+                 ((c & 0xFF) << fmt->Bshift);
+    }
+}
+
+static void
+premultiply_scalar(Uint32 *src, int n)
+{
+    int i;
+
+    for (i = 0; i < n; ++i) {
+        const Uint32 s = src[i];
+        const Uint32 a = s >> 24;
+
+        if (a < 255) {
+            src[i] = (s & 0xFF000000) |
+                     (DIV255(((s >> 16) & 0xFF) * a) << 16) |
+                     (DIV255(((s >> 8) & 0xFF) * a) << 8) |
+                     DIV255((s & 0xFF) * a);
+        }
+    }
+}
+
+static void
+blend_scalar(const Uint32 *src, Uint32 *dst, int n)
+{
+    int i, shift;
+
+    for (i = 0; i < n; ++i) {
+        const Uint32 s = src[i];
+        const Uint32 d = dst[i];
+        const Uint32 inv = 255 - (s >> 24);
+        Uint32 result = 0;
+
+        for (shift = 0; shift < 32; shift += 8) {
+            result |= (((s >> shift) & 0xFF) + DIV255(((d >> shift) & 0xFF) * inv)) << shift;
+        }
+        dst[i] = result;
+    }
+}
+
+static void
+add_scalar(const Uint32 *src, Uint32 *dst, int n)
+{
+    int i, shift;
+
+    for (i = 0; i < n; ++i) {
+        const Uint32 s = src[i];
+        const Uint32 d = dst[i];
+        Uint32 result = d & 0xFF000000;
+
+        for (shift = 0; shift < 24; shift += 8) {
+            const Uint32 c = ((s >> shift) & 0xFF) + ((d >> shift) & 0xFF);
+            result |= SDL_min(c, 255) << shift;
+        }
+        dst[i] = result;
+    }
+}
+
+static void
+mod_scalar(const Uint32 *src, Uint32 *dst, int n)
+{
+    int i, shift;
+
+    for (i = 0; i < n; ++i) {
+        const Uint32 s = src[i];
+        const Uint32 d = dst[i];
+        Uint32 result = d & 0xFF000000;
+
+        for (shift = 0; shift < 24; shift += 8) {
+            result |= DIV255(((s >> shift) & 0xFF) * ((d >> shift) & 0xFF)) << shift;
+        }
+        dst[i] = result;
+    }
+}
+
+#if HAVE_SSE2_INTRINSICS
+static void
+unpack_8888_SSE2(const Uint32 *src, Uint32 *dst, int n, const SDL_PixelFormat *fmt)
+{
+    const __m128i mask = _mm_set1_epi32(0xFF);
+    const __m128i alpha = _mm_set1_epi32(fmt->Amask ? 0 : 0xFF000000);
+    const __m128i amask = _mm_set1_epi32(fmt->Amask ? 0xFF : 0);
+    const __m128i ashift = _mm_cvtsi32_si128(fmt->Amask ? fmt->Ashift : 0);
+    const __m128i rshift = _mm_cvtsi32_si128(fmt->Rshift);
+    const __m128i gshift = _mm_cvtsi32_si128(fmt->Gshift);
+    const __m128i bshift = _mm_cvtsi32_si128(fmt->Bshift);
+    int i;
+
+    for (i = 0; i + 4 <= n; i += 4) {
+        const __m128i p = _mm_loadu_si128((const __m128i *) &src[i]);
+        __m128i c;
+
+        c = _mm_or_si128(alpha, _mm_slli_epi32(_mm_and_si128(_mm_srl_epi32(p, ashift), amask), 24));
+        c = _mm_or_si128(c, _mm_slli_epi32(_mm_and_si128(_mm_srl_epi32(p, rshift), mask), 16));
+        c = _mm_or_si128(c, _mm_slli_epi32(_mm_and_si128(_mm_srl_epi32(p, gshift), mask), 8));
+        c = _mm_or_si128(c, _mm_and_si128(_mm_srl_epi32(p, bshift), mask));
+        _mm_storeu_si128((__m128i *) &dst[i], c);
+    }
+    unpack_8888_scalar(&src[i], &dst[i], n - i, fmt);
+}
+
+static void
+pack_8888_SSE2(const Uint32 *src, Uint32 *dst, int n, const SDL_PixelFormat *fmt)
+{
+    const __m128i mask = _mm_set1_epi32(0xFF);
+    const __m128i amask = _mm_set1_epi32(fmt->Amask ? 0xFF : 0);
+    const __m128i ashift = _mm_cvtsi32_si128(fmt->Amask ? fmt->Ashift : 0);
+    const __m128i rshift = _mm_cvtsi32_si128(fmt->Rshift);
+    const __m128i gshift = _mm_cvtsi32_si128(fmt->Gshift);
+    const __m128i bshift = _mm_cvtsi32_si128(fmt->Bshift);
+    int i;
+
+    for (i = 0; i + 4 <= n; i += 4) {
+        const __m128i c = _mm_loadu_si128((const __m128i *) &src[i]);
+        __m128i p;
+
+        p = _mm_sll_epi32(_mm_and_si128(_mm_srli_epi32(c, 24), amask), ashift);
+        p = _mm_or_si128(p, _mm_sll_epi32(_mm_and_si128(_mm_srli_epi32(c, 16), mask), rshift));
+        p = _mm_or_si128(p, _mm_sll_epi32(_mm_and_si128(_mm_srli_epi32(c, 8), mask), gshift));
+        p = _mm_or_si128(p, _mm_sll_epi32(_mm_and_si128(c, mask), bshift));
+        _mm_storeu_si128((__m128i *) &dst[i], p);
+    }
+    pack_8888_scalar(&src[i], &dst[i], n - i, fmt);
+}
+
+/* x / 255 in each 16-bit lane */
+static SDL_INLINE __m128i
+div255_SSE2(__m128i x)
+{
+    return _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(x, _mm_set1_epi16(1)), _mm_srli_epi16(x, 8)), 8);
+}
+
+/* The alpha of each of the two pixels in all four of its lanes */
+static SDL_INLINE __m128i
+alpha_SSE2(__m128i x)
+{
+    return _mm_shufflehi_epi16(_mm_shufflelo_epi16(x, 0xFF), 0xFF);
+}
+
+static void
+premultiply_SSE2(Uint32 *src, int n)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i rgb = _mm_set_epi16(0, -1, -1, -1, 0, -1, -1, -1);
+    const __m128i opaque = _mm_set_epi16(255, 0, 0, 0, 255, 0, 0, 0);
+    int i;
+
+    /* Alpha is multiplied by 255, which leaves it and opaque pixels as is */
+    for (i = 0; i + 4 <= n; i += 4) {
+        const __m128i s = _mm_loadu_si128((const __m128i *) &src[i]);
+        __m128i lo = _mm_unpacklo_epi8(s, zero);
+        __m128i hi = _mm_unpackhi_epi8(s, zero);
+
+        lo = div255_SSE2(_mm_mullo_epi16(lo, _mm_or_si128(_mm_and_si128(alpha_SSE2(lo), rgb), opaque)));
+        hi = div255_SSE2(_mm_mullo_epi16(hi, _mm_or_si128(_mm_and_si128(alpha_SSE2(hi), rgb), opaque)));
+        _mm_storeu_si128((__m128i *) &src[i], _mm_packus_epi16(lo, hi));
+    }
+    premultiply_scalar(&src[i], n - i);
+}
+
+static void
+blend_SSE2(const Uint32 *src, Uint32 *dst, int n)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i full = _mm_set1_epi16(255);
+    int i;
+
+    for (i = 0; i + 4 <= n; i += 4) {
+        const __m128i s = _mm_loadu_si128((const __m128i *) &src[i]);
+        const __m128i d = _mm_loadu_si128((const __m128i *) &dst[i]);
+        const __m128i slo = _mm_unpacklo_epi8(s, zero);
+        const __m128i shi = _mm_unpackhi_epi8(s, zero);
+        __m128i lo, hi;
+
+        lo = _mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), _mm_sub_epi16(full, alpha_SSE2(slo)));
+        hi = _mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), _mm_sub_epi16(full, alpha_SSE2(shi)));
+        lo = _mm_add_epi16(slo, div255_SSE2(lo));
+        hi = _mm_add_epi16(shi, div255_SSE2(hi));
+        _mm_storeu_si128((__m128i *) &dst[i], _mm_packus_epi16(lo, hi));
+    }
+    blend_scalar(&src[i], &dst[i], n - i);
+}
+
+static void
+add_SSE2(const Uint32 *src, Uint32 *dst, int n)
+{
+    const __m128i amask = _mm_set1_epi32(0xFF000000);
+    int i;
+
+    for (i = 0; i + 4 <= n; i += 4) {
+        const __m128i s = _mm_loadu_si128((const __m128i *) &src[i]);
+        const __m128i d = _mm_loadu_si128((const __m128i *) &dst[i]);
+
+        _mm_storeu_si128((__m128i *) &dst[i],
+                         _mm_or_si128(_mm_andnot_si128(amask, _mm_adds_epu8(s, d)),
+                                      _mm_and_si128(amask, d)));
+    }
+    add_scalar(&src[i], &dst[i], n - i);
+}
+
+static void
+mod_SSE2(const Uint32 *src, Uint32 *dst, int n)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i amask = _mm_set1_epi32(0xFF000000);
+    int i;
+
+    for (i = 0; i + 4 <= n; i += 4) {
+        const __m128i s = _mm_loadu_si128((const __m128i *) &src[i]);
+        const __m128i d = _mm_loadu_si128((const __m128i *) &dst[i]);
+        __m128i lo, hi;
+
+        lo = div255_SSE2(_mm_mullo_epi16(_mm_unpacklo_epi8(s, zero), _mm_unpacklo_epi8(d, zero)));
+        hi = div255_SSE2(_mm_mullo_epi16(_mm_unpackhi_epi8(s, zero), _mm_unpackhi_epi8(d, zero)));
+        _mm_storeu_si128((__m128i *) &dst[i],
+                         _mm_or_si128(_mm_andnot_si128(amask, _mm_packus_epi16(lo, hi)),
+                                      _mm_and_si128(amask, d)));
+    }
+    mod_scalar(&src[i], &dst[i], n - i);
+}
+#endif /* HAVE_SSE2_INTRINSICS */
+
+typedef struct
+{
+    void (*unpack_8888)(const Uint32 *, Uint32 *, int, const SDL_PixelFormat *);
+    void (*pack_8888)(const Uint32 *, Uint32 *, int, const SDL_PixelFormat *);
+    void (*premultiply)(Uint32 *, int);
+    void (*blend)(const Uint32 *, Uint32 *, int);
+    void (*add)(const Uint32 *, Uint32 *, int);
+    void (*mod)(const Uint32 *, Uint32 *, int);
+} SlowBlitKernels;
+
+static void
+get_kernels(SlowBlitKernels *kernels)
+{
+    kernels->unpack_8888 = unpack_8888_scalar;
+    kernels->pack_8888 = pack_8888_scalar;
+    kernels->premultiply = premultiply_scalar;
+    kernels->blend = blend_scalar;
+    kernels->add = add_scalar;
+    kernels->mod = mod_scalar;
+#if HAVE_SSE2_INTRINSICS
+    if (SDL_HasSSE2()) {
+        kernels->unpack_8888 = unpack_8888_SSE2;
+        kernels->pack_8888 = pack_8888_SSE2;
+        kernels->premultiply = premultiply_SSE2;
+        kernels->blend = blend_SSE2;
+        kernels->add = add_SSE2;
+        kernels->mod = mod_SSE2;
+    }
+#endif
+}
+
+/* Unpack 'n' pixels to ARGB8888, either consecutive ones or the ones at the
+   byte 'offsets' from 'row'. Pixels with fewer bits per channel are expanded
+   with the same tables as RGBA_FROM_PIXEL(). */
+static void
+unpack_pixels(const SlowBlitKernels *kernels, const Uint8 *row, const int *offsets,
+              int n, const SDL_PixelFormat *fmt, Uint32 *dst)
+{
+    const int bpp = fmt->BytesPerPixel;
+    const Uint32 Rmask = fmt->Rmask, Gmask = fmt->Gmask, Bmask = fmt->Bmask, Amask = fmt->Amask;
+    const int Rshift = fmt->Rshift, Gshift = fmt->Gshift, Bshift = fmt->Bshift, Ashift = fmt->Ashift;
+    const Uint8 *Rexpand = SDL_expand_byte[fmt->Rloss];
+    const Uint8 *Gexpand = SDL_expand_byte[fmt->Gloss];
+    const Uint8 *Bexpand = SDL_expand_byte[fmt->Bloss];
+    const Uint8 *Aexpand = SDL_expand_byte[fmt->Aloss];
+    int i;
+
+#define UNPACK_PIXEL(p) \
+    ((Amask ? ((Uint32) Aexpand[((p) & Amask) >> Ashift] << 24) : 0xFF000000) | \
+     ((Uint32) Rexpand[((p) & Rmask) >> Rshift] << 16) | \
+     ((Uint32) Gexpand[((p) & Gmask) >> Gshift] << 8) | \
+     (Uint32) Bexpand[((p) & Bmask) >> Bshift])
+
+    switch (bpp) {
+    case 1:
+        for (i = 0; i < n; ++i) {
+            const Uint32 p = row[offsets ? offsets[i] : i];
+            dst[i] = UNPACK_PIXEL(p);
+        }
+        break;
+    case 2:
+        for (i = 0; i < n; ++i) {
+            const Uint32 p = *(const Uint16 *) (row + (offsets ? offsets[i] : i * 2));
+            dst[i] = UNPACK_PIXEL(p);
+        }
+        break;
+    case 3: {
+        /* Always 8 bits per channel, read as bytes like DISEMBLE_RGB() */
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+        const int r = Rshift / 8, g = Gshift / 8, b = Bshift / 8;
+#else
+        const int r = 2 - Rshift / 8, g = 2 - Gshift / 8, b = 2 - Bshift / 8;
+#endif
+        for (i = 0; i < n; ++i) {
+            const Uint8 *p = row + (offsets ? offsets[i] : i * 3);
+            dst[i] = 0xFF000000 | ((Uint32) p[r] << 16) | ((Uint32) p[g] << 8) | p[b];
+        }
+        break;
+    }
+    case 4:
+        if (is_8888(fmt)) {
+            const Uint32 *src = (const Uint32 *) row;
+
+            if (offsets) {
+                for (i = 0; i < n; ++i) {
+                    dst[i] = *(const Uint32 *) (row + offsets[i]);
+                }
+                src = dst;
+            }
+            kernels->unpack_8888(src, dst, n, fmt);
+        } else {
+            for (i = 0; i < n; ++i) {
+                const Uint32 p = *(const Uint32 *) (row + (offsets ? offsets[i] : i * 4));
+                dst[i] = UNPACK_PIXEL(p);
+            }
+        }
+        break;
+    }
+#undef UNPACK_PIXEL
+}
+
+/* Flag the pixels matching the colorkey */
+static void
+key_pixels(const Uint8 *row, const int *offsets, int n, const SDL_PixelFormat *fmt,
+           Uint32 ckey, Uint8 *keyed)
+{
+    const int bpp = fmt->BytesPerPixel;
+    const Uint32 rgbmask = ~fmt->Amask;
+    Uint32 pixel;
+    int i;
+
+    for (i = 0; i < n; ++i) {
+        RETRIEVE_RGB_PIXEL(row + (offsets ? offsets[i] : i * bpp), bpp, pixel);
+        keyed[i] = ((pixel & rgbmask) == ckey);
+    }
+}
+
+/* Pack 'n' ARGB8888 pixels, leaving the 'keyed' ones out if given. Channels
+   are truncated like PIXEL_FROM_RGBA(), formats without alpha drop it. */
+static void
+pack_pixels(const SlowBlitKernels *kernels, const Uint32 *src, int n,
+            const SDL_PixelFormat *fmt, Uint8 *row, const Uint8 *keyed)
+{
+    const int bpp = fmt->BytesPerPixel;
+    const int Rshift = fmt->Rshift, Gshift = fmt->Gshift, Bshift = fmt->Bshift;
+    const int Rloss = fmt->Rloss, Gloss = fmt->Gloss, Bloss = fmt->Bloss;
+    const int Ashift = fmt->Amask ? fmt->Ashift : 0;
+    const int Aloss = fmt->Amask ? fmt->Aloss : 8;
+    int i;
+
+#define PACK_PIXEL(c) \
+    (((((c) >> 24) >> Aloss) << Ashift) | \
+     ((((c) >> 16) & 0xFF) >> Rloss << Rshift) | \
+     ((((c) >> 8) & 0xFF) >> Gloss << Gshift) | \
+     (((c) & 0xFF) >> Bloss << Bshift))
+
+    switch (bpp) {
+    case 1:
+        for (i = 0; i < n; ++i) {
+            if (!keyed || !keyed[i]) {
+                row[i] = (Uint8) PACK_PIXEL(src[i]);
+            }
+        }
+        break;
+    case 2:
+        for (i = 0; i < n; ++i) {
+            if (!keyed || !keyed[i]) {
+                ((Uint16 *) row)[i] = (Uint16) PACK_PIXEL(src[i]);
+            }
+        }
+        break;
+    case 3: {
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+        const int r = Rshift / 8, g = Gshift / 8, b = Bshift / 8;
+#else
+        const int r = 2 - Rshift / 8, g = 2 - Gshift / 8, b = 2 - Bshift / 8;
+#endif
+        for (i = 0; i < n; ++i, row += 3) {
+            if (!keyed || !keyed[i]) {
+                row[r] = (Uint8) (src[i] >> 16);
+                row[g] = (Uint8) (src[i] >> 8);
+                row[b] = (Uint8) src[i];
+            }
+        }
+        break;
+    }
+    case 4:
+        if (is_8888(fmt) && !keyed) {
+            kernels->pack_8888(src, (Uint32 *) row, n, fmt);
+        } else {
+            for (i = 0; i < n; ++i) {
+                if (!keyed || !keyed[i]) {
+                    ((Uint32 *) row)[i] = PACK_PIXEL(src[i]);
+                }
+            }
+        }
+        break;
+    }
+#undef PACK_PIXEL
+}
+
+/* Modulate, blend and pack 'n' pixels unpacked into 'srcbuf' onto 'dst' */
+static void
+blit_pixels(const SlowBlitKernels *kernels, int flags, Uint32 modulation,
+            Uint32 *srcbuf, Uint32 *dstbuf, int n,
+            const SDL_PixelFormat *dst_fmt, Uint8 *dst, const Uint8 *keyed)
+{
+    const int blend = flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD);
+    Uint32 *result = srcbuf;
+
+    if (modulation != 0xFFFFFFFF) {
+        SDL_Modulate32(srcbuf, 0, srcbuf, 0, n, 1, modulation);
+    }
+    if (blend & (SDL_COPY_BLEND | SDL_COPY_ADD)) {
+        /* This goes away if we ever use premultiplied alpha */
+        kernels->premultiply(srcbuf, n);
+    }
+    if (blend) {
+        unpack_pixels(kernels, dst, NULL, n, dst_fmt, dstbuf);
+        switch (blend) {
+        case SDL_COPY_BLEND:
+            kernels->blend(srcbuf, dstbuf, n);
+            break;
+        case SDL_COPY_ADD:
+            kernels->add(srcbuf, dstbuf, n);
+            break;
+        case SDL_COPY_MOD:
+            kernels->mod(srcbuf, dstbuf, n);
+            break;
+        }
+        result = dstbuf;
+    }
+    pack_pixels(kernels, result, n, dst_fmt, dst, keyed);
+}
+
+/* Channels that aren't modulated are multiplied by 255, which keeps them */
+static Uint32
+get_modulation(const SDL_BlitInfo * info)
+{
+    Uint32 modulation = 0xFFFFFFFF;
+
+    if (info->flags & SDL_COPY_MODULATE_COLOR) {
+        modulation = 0xFF000000 | ((Uint32) info->r << 16) | ((Uint32) info->g << 8) | info->b;
+    }
+    if (info->flags & SDL_COPY_MODULATE_ALPHA) {
+        modulation = (modulation & 0x00FFFFFF) | ((Uint32) info->a << 24);
+    }
+    return modulation;
+}
+
 void
 SDL_Blit_Slow(SDL_BlitInfo * info)
 {
     const int flags = info->flags;
-    const Uint32 modulateR = info->r;
-    const Uint32 modulateG = info->g;
-    const Uint32 modulateB = info->b;
-    const Uint32 modulateA = info->a;
-    Uint32 srcpixel;
-    Uint32 srcR, srcG, srcB, srcA;
-    Uint32 dstpixel;
-    Uint32 dstR, dstG, dstB, dstA;
+    SDL_PixelFormat *src_fmt = info->src_fmt;
+    SDL_PixelFormat *dst_fmt = info->dst_fmt;
+    const int srcbpp = src_fmt->BytesPerPixel;
+    const int dstbpp = dst_fmt->BytesPerPixel;
+    const Uint32 ckey = info->colorkey & ~src_fmt->Amask;
+    const Uint32 modulation = get_modulation(info);
+    Uint32 srcbuf[SLOW_CHUNK];
+    Uint32 dstbuf[SLOW_CHUNK];
+    Uint8 keyed[SLOW_CHUNK];
+    int offsets[SLOW_CHUNK];
+    SlowBlitKernels kernels;
     int srcy, srcx;
     int posy, posx;
     int incy, incx;
-    SDL_PixelFormat *src_fmt = info->src_fmt;
-    SDL_PixelFormat *dst_fmt = info->dst_fmt;
-    int srcbpp = src_fmt->BytesPerPixel;
-    int dstbpp = dst_fmt->BytesPerPixel;
-    Uint32 rgbmask = ~src_fmt->Amask;
-    Uint32 ckey = info->colorkey & rgbmask;
+    int x, n, i;
+
+    get_kernels(&kernels);
 
     srcy = 0;
     posy = 0;
@@ -55,110 +568,75 @@ SDL_Blit_Slow(SDL_BlitInfo * info)
     incx = (info->src_w << 16) / info->dst_w;
 
     while (info->dst_h--) {
-        Uint8 *src = 0;
+        const Uint8 *src;
         Uint8 *dst = (Uint8 *) info->dst;
-        int n = info->dst_w;
+
         srcx = -1;
         posx = 0x10000L;
         while (posy >= 0x10000L) {
             ++srcy;
             posy -= 0x10000L;
         }
-        while (n--) {
-            if (posx >= 0x10000L) {
-                while (posx >= 0x10000L) {
-                    ++srcx;
-                    posx -= 0x10000L;
-                }
-                src =
-                    (info->src + (srcy * info->src_pitch) + (srcx * srcbpp));
-            }
-            if (src_fmt->Amask) {
-                DISEMBLE_RGBA(src, srcbpp, src_fmt, srcpixel, srcR, srcG,
-                              srcB, srcA);
+        src = info->src + (srcy * info->src_pitch);
+
+        for (x = 0; x < info->dst_w; x += n) {
+            const Uint8 *srcp = src;
+            const int *srcoffsets = NULL;
+
+            n = SDL_min(info->dst_w - x, SLOW_CHUNK);
+
+            /* The source pixels each destination pixel samples */
+            if (incx == 0x10000L) {
+                srcp += x * srcbpp;
             } else {
-                DISEMBLE_RGB(src, srcbpp, src_fmt, srcpixel, srcR, srcG,
-                             srcB);
-                srcA = 0xFF;
-            }
-            if (flags & SDL_COPY_COLORKEY) {
-                /* srcpixel isn't set for 24 bpp */
-                if (srcbpp == 3) {
-                    srcpixel = (srcR << src_fmt->Rshift) |
-                        (srcG << src_fmt->Gshift) | (srcB << src_fmt->Bshift);
-                }
-                if ((srcpixel & rgbmask) == ckey) {
+                for (i = 0; i < n; ++i) {
+                    while (posx >= 0x10000L) {
+                        ++srcx;
+                        posx -= 0x10000L;
+                    }
+                    offsets[i] = srcx * srcbpp;
                     posx += incx;
-                    dst += dstbpp;
-                    continue;
                 }
-            }
-            if (dst_fmt->Amask) {
-                DISEMBLE_RGBA(dst, dstbpp, dst_fmt, dstpixel, dstR, dstG,
-                              dstB, dstA);
-            } else {
-                DISEMBLE_RGB(dst, dstbpp, dst_fmt, dstpixel, dstR, dstG,
-                             dstB);
-                dstA = 0xFF;
+                srcoffsets = offsets;
             }
 
-            if (flags & SDL_COPY_MODULATE_COLOR) {
-                srcR = (srcR * modulateR) / 255;
-                srcG = (srcG * modulateG) / 255;
-                srcB = (srcB * modulateB) / 255;
-            }
-            if (flags & SDL_COPY_MODULATE_ALPHA) {
-                srcA = (srcA * modulateA) / 255;
-            }
-            if (flags & (SDL_COPY_BLEND | SDL_COPY_ADD)) {
-                /* This goes away if we ever use premultiplied alpha */
-                if (srcA < 255) {
-                    srcR = (srcR * srcA) / 255;
-                    srcG = (srcG * srcA) / 255;
-                    srcB = (srcB * srcA) / 255;
-                }
-            }
-            switch (flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD)) {
-            case 0:
-                dstR = srcR;
-                dstG = srcG;
-                dstB = srcB;
-                dstA = srcA;
-                break;
-            case SDL_COPY_BLEND:
-                dstR = srcR + ((255 - srcA) * dstR) / 255;
-                dstG = srcG + ((255 - srcA) * dstG) / 255;
-                dstB = srcB + ((255 - srcA) * dstB) / 255;
-                dstA = srcA + ((255 - srcA) * dstA) / 255;
-                break;
-            case SDL_COPY_ADD:
-                dstR = srcR + dstR;
-                if (dstR > 255)
-                    dstR = 255;
-                dstG = srcG + dstG;
-                if (dstG > 255)
-                    dstG = 255;
-                dstB = srcB + dstB;
-                if (dstB > 255)
-                    dstB = 255;
-                break;
-            case SDL_COPY_MOD:
-                dstR = (srcR * dstR) / 255;
-                dstG = (srcG * dstG) / 255;
-                dstB = (srcB * dstB) / 255;
-                break;
-            }
-            if (dst_fmt->Amask) {
-                ASSEMBLE_RGBA(dst, dstbpp, dst_fmt, dstR, dstG, dstB, dstA);
-            } else {
-                ASSEMBLE_RGB(dst, dstbpp, dst_fmt, dstR, dstG, dstB);
+            unpack_pixels(&kernels, srcp, srcoffsets, n, src_fmt, srcbuf);
+            if (flags & SDL_COPY_COLORKEY) {
+                key_pixels(srcp, srcoffsets, n, src_fmt, ckey, keyed);
             }
-            posx += incx;
-            dst += dstbpp;
+            blit_pixels(&kernels, flags, modulation, srcbuf, dstbuf, n,
+                        dst_fmt, dst + x * dstbpp,
+                        (flags & SDL_COPY_COLORKEY) ? keyed : NULL);
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
 }
 
+void
+SDL_Blit_SlowSpan(const SDL_BlitInfo * info, const Uint8 * src,
+                  const int *offsets, Uint8 * dst, int n)
+{
+    const int dstbpp = info->dst_fmt->BytesPerPixel;
+    const Uint32 modulation = get_modulation(info);
+    Uint32 srcbuf[SLOW_CHUNK];
+    Uint32 dstbuf[SLOW_CHUNK];
+    SlowBlitKernels kernels;
+    int x, len;
+
+    get_kernels(&kernels);
+
+    for (x = 0; x < n; x += len) {
+        len = SDL_min(n - x, SLOW_CHUNK);
+        if (offsets) {
+            unpack_pixels(&kernels, src, offsets + x, len, info->src_fmt, srcbuf);
+        } else {
+            unpack_pixels(&kernels, src + x * info->src_fmt->BytesPerPixel, NULL,
+                          len, info->src_fmt, srcbuf);
+        }
+        blit_pixels(&kernels, info->flags, modulation, srcbuf, dstbuf, len,
+                    info->dst_fmt, dst + x * dstbpp, NULL);
+    }
+}
+
 /* vi: set ts=4 sw=4 expandtab: */
@@ -22,4 +22,10 @@
 
 extern void SDL_Blit_Slow(SDL_BlitInfo * info);
 
+/* Blit a run of 'n' source pixels with the modulation and blend mode of
+   'info', ignoring its colorkey. If 'offsets' isn't NULL, it gives the byte
+   offset of each pixel from 'src', otherwise the pixels are consecutive. */
+extern void SDL_Blit_SlowSpan(const SDL_BlitInfo * info, const Uint8 * src,
+                              const int *offsets, Uint8 * dst, int n);
+
 /* vi: set ts=4 sw=4 expandtab: */
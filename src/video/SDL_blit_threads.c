@@ -0,0 +1,244 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2017 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../SDL_internal.h"
+
+#include "SDL_atomic.h"
+#include "SDL_cpuinfo.h"
+#include "SDL_hints.h"
+#include "SDL_thread.h"
+#include "SDL_blit.h"
+
+/* Threaded blits: the destination rows are cut into bands, which the
+   calling thread and a pool of workers take in turn. The pool is created
+   on the first large blit, sized by SDL_HINT_BLIT_THREADS, and is used by
+   one blit at a time; blits started while it is busy run on their own
+   thread.
+ */
+#define SDL_BLIT_MAX_THREADS            64
+
+/* Blits covering fewer pixels aren't worth waking the workers */
+#define SDL_BLIT_MIN_THREADED_PIXELS    (128 * 1024)
+
+/* A few bands per thread even out the work, but not shorter than this */
+#define SDL_BLIT_BANDS_PER_THREAD       4
+#define SDL_BLIT_MIN_BAND_ROWS          8
+
+typedef struct
+{
+    int num_threads;            /* including the calling thread */
+    SDL_Thread **threads;
+    SDL_sem *work;
+    SDL_sem *done;
+    SDL_atomic_t quit;
+
+    /* The blit being drawn */
+    SDL_BlitRowsFunc func;
+    void *data;
+    int rows;
+    int num_bands;
+    SDL_atomic_t next_band;
+    SDL_atomic_t status;
+} SDL_BlitThreadPool;
+
+static SDL_SpinLock SDL_blit_pool_lock;
+static SDL_BlitThreadPool *SDL_blit_pool;
+
+static int
+SDL_GetBlitThreadCount(void)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_BLIT_THREADS);
+    int count;
+
+    if (!hint) {
+        return 1;
+    }
+    if (SDL_strcasecmp(hint, "auto") == 0) {
+        count = SDL_GetCPUCount();
+    } else {
+        count = SDL_atoi(hint);
+    }
+    return SDL_max(1, SDL_min(count, SDL_BLIT_MAX_THREADS));
+}
+
+static void
+SDL_DrawBlitBands(SDL_BlitThreadPool * pool)
+{
+    int band;
+
+    while ((band = SDL_AtomicAdd(&pool->next_band, 1)) < pool->num_bands) {
+        const int first = (int) ((Sint64) band * pool->rows / pool->num_bands);
+        const int last = (int) ((Sint64) (band + 1) * pool->rows / pool->num_bands);
+
+        if (pool->func(pool->data, first, last) < 0) {
+            SDL_AtomicSet(&pool->status, -1);
+        }
+    }
+}
+
+static int SDLCALL
+SDL_BlitThread(void *data)
+{
+    SDL_BlitThreadPool *pool = (SDL_BlitThreadPool *) data;
+
+    for (;;) {
+        SDL_SemWait(pool->work);
+        if (SDL_AtomicGet(&pool->quit)) {
+            break;
+        }
+        SDL_DrawBlitBands(pool);
+        SDL_SemPost(pool->done);
+    }
+    return 0;
+}
+
+static void
+SDL_DestroyBlitThreadPool(SDL_BlitThreadPool * pool)
+{
+    int i;
+
+    SDL_AtomicSet(&pool->quit, 1);
+    for (i = 1; i < pool->num_threads; ++i) {
+        SDL_SemPost(pool->work);
+    }
+    for (i = 1; i < pool->num_threads; ++i) {
+        SDL_WaitThread(pool->threads[i], NULL);
+    }
+    if (pool->work) {
+        SDL_DestroySemaphore(pool->work);
+    }
+    if (pool->done) {
+        SDL_DestroySemaphore(pool->done);
+    }
+    SDL_free(pool->threads);
+    SDL_free(pool);
+}
+
+static SDL_BlitThreadPool *
+SDL_CreateBlitThreadPool(int num_threads)
+{
+    SDL_BlitThreadPool *pool;
+    int i;
+
+    pool = (SDL_BlitThreadPool *) SDL_calloc(1, sizeof(*pool));
+    if (!pool) {
+        return NULL;
+    }
+    pool->threads = (SDL_Thread **) SDL_calloc(num_threads, sizeof(*pool->threads));
+    pool->work = SDL_CreateSemaphore(0);
+    pool->done = SDL_CreateSemaphore(0);
+    pool->num_threads = 1;
+    if (!pool->threads || !pool->work || !pool->done) {
+        SDL_DestroyBlitThreadPool(pool);
+        return NULL;
+    }
+
+    for (i = 1; i < num_threads; ++i) {
+        pool->threads[i] = SDL_CreateThread(SDL_BlitThread, "SDLBlitBands", pool);
+        if (!pool->threads[i]) {
+            break;
+        }
+        ++pool->num_threads;
+    }
+    if (pool->num_threads < 2) {
+        SDL_DestroyBlitThreadPool(pool);
+        return NULL;
+    }
+    return pool;
+}
+
+/* Get the pool with the number of threads the hint asks for, with its lock
+   held, or NULL if the blit should be done on the calling thread */
+static SDL_BlitThreadPool *
+SDL_LockBlitThreadPool(void)
+{
+    const int num_threads = SDL_GetBlitThreadCount();
+
+    if (num_threads < 2 && !SDL_blit_pool) {
+        return NULL;
+    }
+    if (!SDL_AtomicTryLock(&SDL_blit_pool_lock)) {
+        return NULL;
+    }
+    if (SDL_blit_pool && SDL_blit_pool->num_threads != num_threads) {
+        SDL_DestroyBlitThreadPool(SDL_blit_pool);
+        SDL_blit_pool = NULL;
+    }
+    if (!SDL_blit_pool && num_threads >= 2) {
+        SDL_blit_pool = SDL_CreateBlitThreadPool(num_threads);
+    }
+    if (!SDL_blit_pool) {
+        SDL_AtomicUnlock(&SDL_blit_pool_lock);
+        return NULL;
+    }
+    return SDL_blit_pool;
+}
+
+int
+SDL_RunBlitRows(SDL_BlitRowsFunc func, void *data, int rows, Sint64 pixels)
+{
+    SDL_BlitThreadPool *pool;
+    int num_bands, i;
+
+    if (pixels < SDL_BLIT_MIN_THREADED_PIXELS || rows < 2 * SDL_BLIT_MIN_BAND_ROWS) {
+        return func(data, 0, rows);
+    }
+    pool = SDL_LockBlitThreadPool();
+    if (!pool) {
+        return func(data, 0, rows);
+    }
+
+    num_bands = SDL_min(pool->num_threads * SDL_BLIT_BANDS_PER_THREAD,
+                        rows / SDL_BLIT_MIN_BAND_ROWS);
+    pool->func = func;
+    pool->data = data;
+    pool->rows = rows;
+    pool->num_bands = num_bands;
+    SDL_AtomicSet(&pool->next_band, 0);
+    SDL_AtomicSet(&pool->status, 0);
+
+    for (i = 1; i < pool->num_threads; ++i) {
+        SDL_SemPost(pool->work);
+    }
+    SDL_DrawBlitBands(pool);
+    for (i = 1; i < pool->num_threads; ++i) {
+        SDL_SemWait(pool->done);
+    }
+
+    i = SDL_AtomicGet(&pool->status);
+    SDL_AtomicUnlock(&SDL_blit_pool_lock);
+    if (i < 0) {
+        return SDL_SetError("Couldn't blit all bands");
+    }
+    return 0;
+}
+
+void
+SDL_QuitBlitThreads(void)
+{
+    SDL_AtomicLock(&SDL_blit_pool_lock);
+    if (SDL_blit_pool) {
+        SDL_DestroyBlitThreadPool(SDL_blit_pool);
+        SDL_blit_pool = NULL;
+    }
+    SDL_AtomicUnlock(&SDL_blit_pool_lock);
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -130,6 +130,107 @@ DEFINE_SSE_FILLRECT(4, Uint32)
 /* *INDENT-ON* */
 #endif /* __SSE__ */
 
+/* The AVX and NEON fills use plain stores, as what was filled is usually
+   drawn over or read again soon */
+#define DEFINE_VECTOR_FILLRECT(ext, target, bpp, type, align) \
+static target void \
+SDL_FillRect##bpp##ext(Uint8 *pixels, int pitch, Uint32 color, int w, int h) \
+{ \
+    int i, n; \
+    Uint8 *p = NULL; \
+ \
+    ext##_BEGIN; \
+ \
+    while (h--) { \
+        n = w * bpp; \
+        p = pixels; \
+ \
+        if (n > 63) { \
+            int adjust = (int) ((align - ((uintptr_t)p & (align - 1))) & (align - 1)) / bpp; \
+            n -= adjust * bpp; \
+            while (adjust--) { \
+                *((type *)p) = (type)color; \
+                p += bpp; \
+            } \
+            ext##_WORK; \
+        } \
+        if (n & 63) { \
+            int remainder = (n & 63); \
+            remainder /= bpp; \
+            while (remainder--) { \
+                *((type *)p) = (type)color; \
+                p += bpp; \
+            } \
+        } \
+        pixels += pitch; \
+    } \
+}
+
+#ifdef __SSE2__
+/* *INDENT-OFF* */
+
+#define SSE2_BEGIN \
+    const __m128i c128 = _mm_set1_epi32((int)color);
+
+#define SSE2_WORK \
+    for (i = n / 64; i--;) { \
+        _mm_storeu_si128((__m128i *)(p+0), c128); \
+        _mm_storeu_si128((__m128i *)(p+16), c128); \
+        _mm_storeu_si128((__m128i *)(p+32), c128); \
+        _mm_storeu_si128((__m128i *)(p+48), c128); \
+        p += 64; \
+    }
+
+DEFINE_VECTOR_FILLRECT(SSE2, , 1, Uint8, 16)
+DEFINE_VECTOR_FILLRECT(SSE2, , 2, Uint16, 16)
+DEFINE_VECTOR_FILLRECT(SSE2, , 4, Uint32, 16)
+
+/* *INDENT-ON* */
+#endif /* __SSE2__ */
+
+#if HAVE_AVX_INTRINSICS
+/* *INDENT-OFF* */
+
+#define AVX_BEGIN \
+    const __m256i c256 = _mm256_set1_epi32((int)color);
+
+#define AVX_WORK \
+    for (i = n / 64; i--;) { \
+        _mm256_storeu_si256((__m256i *)(p+0), c256); \
+        _mm256_storeu_si256((__m256i *)(p+32), c256); \
+        p += 64; \
+    }
+
+DEFINE_VECTOR_FILLRECT(AVX, SDL_TARGET_AVX, 1, Uint8, 32)
+DEFINE_VECTOR_FILLRECT(AVX, SDL_TARGET_AVX, 2, Uint16, 32)
+DEFINE_VECTOR_FILLRECT(AVX, SDL_TARGET_AVX, 4, Uint32, 32)
+
+/* *INDENT-ON* */
+#endif /* HAVE_AVX_INTRINSICS */
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+/* *INDENT-OFF* */
+
+#define NEON_BEGIN \
+    const uint32x4_t c128 = vdupq_n_u32(color);
+
+#define NEON_WORK \
+    for (i = n / 64; i--;) { \
+        vst1q_u32((uint32_t *)(p+0), c128); \
+        vst1q_u32((uint32_t *)(p+16), c128); \
+        vst1q_u32((uint32_t *)(p+32), c128); \
+        vst1q_u32((uint32_t *)(p+48), c128); \
+        p += 64; \
+    }
+
+DEFINE_VECTOR_FILLRECT(NEON, , 1, Uint8, 16)
+DEFINE_VECTOR_FILLRECT(NEON, , 2, Uint16, 16)
+DEFINE_VECTOR_FILLRECT(NEON, , 4, Uint32, 16)
+
+/* *INDENT-ON* */
+#endif /* __ARM_NEON */
+
 static void
 SDL_FillRect1(Uint8 * pixels, int pitch, Uint32 color, int w, int h)
 {
@@ -230,6 +331,91 @@ SDL_FillRect4(Uint8 * pixels, int pitch, Uint32 color, int w, int h)
     }
 }
 
+typedef void (*SDL_FillRectFunc) (Uint8 * pixels, int pitch, Uint32 color, int w, int h);
+
+/* Picks the fill for the surface, and repeats 'color' to 32 bits for it */
+static SDL_FillRectFunc
+SDL_CalculateFillRect(SDL_Surface * dst, Uint32 * color)
+{
+    switch (dst->format->BytesPerPixel) {
+    case 1:
+        *color |= (*color << 8);
+        *color |= (*color << 16);
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+        if (SDL_HasNEON()) {
+            return SDL_FillRect1NEON;
+        }
+#endif
+#if HAVE_AVX_INTRINSICS
+        if (SDL_HasAVX()) {
+            return SDL_FillRect1AVX;
+        }
+#endif
+#ifdef __SSE2__
+        if (SDL_HasSSE2()) {
+            return SDL_FillRect1SSE2;
+        }
+#endif
+#ifdef __SSE__
+        if (SDL_HasSSE()) {
+            return SDL_FillRect1SSE;
+        }
+#endif
+        return SDL_FillRect1;
+
+    case 2:
+        *color |= (*color << 16);
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+        if (SDL_HasNEON()) {
+            return SDL_FillRect2NEON;
+        }
+#endif
+#if HAVE_AVX_INTRINSICS
+        if (SDL_HasAVX()) {
+            return SDL_FillRect2AVX;
+        }
+#endif
+#ifdef __SSE2__
+        if (SDL_HasSSE2()) {
+            return SDL_FillRect2SSE2;
+        }
+#endif
+#ifdef __SSE__
+        if (SDL_HasSSE()) {
+            return SDL_FillRect2SSE;
+        }
+#endif
+        return SDL_FillRect2;
+
+    case 3:
+        /* 24-bit RGB is a slow path, at least for now. */
+        return SDL_FillRect3;
+
+    default:
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+        if (SDL_HasNEON()) {
+            return SDL_FillRect4NEON;
+        }
+#endif
+#if HAVE_AVX_INTRINSICS
+        if (SDL_HasAVX()) {
+            return SDL_FillRect4AVX;
+        }
+#endif
+#ifdef __SSE2__
+        if (SDL_HasSSE2()) {
+            return SDL_FillRect4SSE2;
+        }
+#endif
+#ifdef __SSE__
+        if (SDL_HasSSE()) {
+            return SDL_FillRect4SSE;
+        }
+#endif
+        return SDL_FillRect4;
+    }
+}
+
 /* 
  * This function performs a fast fill of the given rectangle with 'color'
  */
@@ -238,6 +424,7 @@ SDL_FillRect(SDL_Surface * dst, const SDL_Rect * rect, Uint32 color)
 {
     SDL_Rect clipped;
     Uint8 *pixels;
+    SDL_FillRectFunc fill;
 
     if (!dst) {
         return SDL_SetError("Passed NULL destination surface");
@@ -271,73 +458,190 @@ SDL_FillRect(SDL_Surface * dst, const SDL_Rect * rect, Uint32 color)
     pixels = (Uint8 *) dst->pixels + rect->y * dst->pitch +
                                      rect->x * dst->format->BytesPerPixel;
 
-    switch (dst->format->BytesPerPixel) {
-    case 1:
-        {
-            color |= (color << 8);
-            color |= (color << 16);
-#ifdef __SSE__
-            if (SDL_HasSSE()) {
-                SDL_FillRect1SSE(pixels, dst->pitch, color, rect->w, rect->h);
-                break;
+    fill = SDL_CalculateFillRect(dst, &color);
+    fill(pixels, dst->pitch, color, rect->w, rect->h);
+
+    /* We're done! */
+    return 0;
+}
+
+/* Rectangles filled at once without a heap allocation */
+#define FILLRECTS_STACK 32
+
+/* Spans narrower than this on average are filled one at a time */
+#define FILLRECTS_ROW_BYTES 256
+
+static int
+SDL_CompareFillRects(const void *a, const void *b)
+{
+    const SDL_Rect *A = (const SDL_Rect *) a;
+    const SDL_Rect *B = (const SDL_Rect *) b;
+
+    if (A->y != B->y) {
+        return (A->y < B->y) ? -1 : 1;
+    }
+    if (A->x != B->x) {
+        return (A->x < B->x) ? -1 : 1;
+    }
+    return 0;
+}
+
+/* Fills clipped rectangles sorted by SDL_CompareFillRects() a band of rows
+   at a time, where a band ends whenever a rectangle starts or ends. The
+   rectangles in a band are merged into spans left to right, and wide spans
+   are filled row by row, so memory is written in order. 'active' and
+   'spans' have room for 'count' entries. */
+static void
+SDL_FillSortedRects(SDL_Surface * dst, SDL_FillRectFunc fill, Uint32 color,
+                    const SDL_Rect * rects, int count, int *active, SDL_Rect * spans)
+{
+    const int bpp = dst->format->BytesPerPixel;
+    const int pitch = dst->pitch;
+    int i = 0, num_active = 0, y = 0;
+
+    while (i < count || num_active > 0) {
+        int j, k, end, num_spans, span_bytes, merged;
+
+        if (num_active == 0) {
+            y = rects[i].y;
+        }
+
+        /* Merge the rectangles starting here into the active ones by x */
+        for (k = i; k < count && rects[k].y == y; ++k) {
+        }
+        if (k > i) {
+            int a = num_active - 1, b = k - 1;
+
+            for (j = num_active + (k - i) - 1; b >= i; --j) {
+                if (a >= 0 && rects[active[a]].x > rects[b].x) {
+                    active[j] = active[a--];
+                } else {
+                    active[j] = b--;
+                }
             }
-#endif
-            SDL_FillRect1(pixels, dst->pitch, color, rect->w, rect->h);
-            break;
+            num_active += k - i;
+            i = k;
         }
 
-    case 2:
-        {
-            color |= (color << 16);
-#ifdef __SSE__
-            if (SDL_HasSSE()) {
-                SDL_FillRect2SSE(pixels, dst->pitch, color, rect->w, rect->h);
-                break;
+        /* The band ends where the next rectangle starts or one ends */
+        end = (i < count) ? rects[i].y : SDL_MAX_SINT32;
+        for (j = 0; j < num_active; ++j) {
+            end = SDL_min(end, rects[active[j]].y + rects[active[j]].h);
+        }
+
+        /* Overlapping and touching rectangles become one span */
+        num_spans = 0;
+        span_bytes = 0;
+        for (j = 0; j < num_active; ++j) {
+            const SDL_Rect *rect = &rects[active[j]];
+            SDL_Rect *span = &spans[num_spans - 1];
+
+            if (num_spans > 0 && rect->x <= span->x + span->w) {
+                span->w = SDL_max(span->w, rect->x + rect->w - span->x);
+            } else {
+                spans[num_spans].x = rect->x;
+                spans[num_spans].w = rect->w;
+                ++num_spans;
             }
-#endif
-            SDL_FillRect2(pixels, dst->pitch, color, rect->w, rect->h);
-            break;
+        }
+        for (j = 0; j < num_spans; ++j) {
+            span_bytes += spans[j].w * bpp;
         }
 
-    case 3:
-        /* 24-bit RGB is a slow path, at least for now. */
-        {
-            SDL_FillRect3(pixels, dst->pitch, color, rect->w, rect->h);
-            break;
+        if (num_spans == 1 || span_bytes < num_spans * FILLRECTS_ROW_BYTES) {
+            /* Narrow spans touch few cache lines per row, and are cheaper
+               filled whole */
+            for (j = 0; j < num_spans; ++j) {
+                fill((Uint8 *) dst->pixels + y * pitch + spans[j].x * bpp,
+                     pitch, color, spans[j].w, end - y);
+            }
+        } else {
+            int row;
+
+            for (row = y; row < end; ++row) {
+                Uint8 *pixels = (Uint8 *) dst->pixels + row * pitch;
+
+                for (j = 0; j < num_spans; ++j) {
+                    fill(pixels + spans[j].x * bpp, pitch, color, spans[j].w, 1);
+                }
+            }
         }
 
-    case 4:
-        {
-#ifdef __SSE__
-            if (SDL_HasSSE()) {
-                SDL_FillRect4SSE(pixels, dst->pitch, color, rect->w, rect->h);
-                break;
+        /* Drop the rectangles that end with the band */
+        merged = 0;
+        for (j = 0; j < num_active; ++j) {
+            if (rects[active[j]].y + rects[active[j]].h != end) {
+                active[merged++] = active[j];
             }
-#endif
-            SDL_FillRect4(pixels, dst->pitch, color, rect->w, rect->h);
-            break;
         }
+        num_active = merged;
+        y = end;
     }
-
-    /* We're done! */
-    return 0;
 }
 
 int
 SDL_FillRects(SDL_Surface * dst, const SDL_Rect * rects, int count,
               Uint32 color)
 {
-    int i;
-    int status = 0;
+    SDL_Rect stack_rects[FILLRECTS_STACK], stack_spans[FILLRECTS_STACK];
+    int stack_active[FILLRECTS_STACK];
+    SDL_Rect *clipped = stack_rects, *spans = stack_spans;
+    int *active = stack_active;
+    void *data = NULL;
+    SDL_FillRectFunc fill;
+    int i, num_clipped;
 
     if (!rects) {
         return SDL_SetError("SDL_FillRects() passed NULL rects");
     }
+    if (count <= 0) {
+        return 0;
+    }
+
+    if (!dst) {
+        return SDL_SetError("Passed NULL destination surface");
+    }
+
+    /* This function doesn't work on surfaces < 8 bpp */
+    if (dst->format->BitsPerPixel < 8) {
+        return SDL_SetError("SDL_FillRects(): Unsupported surface format");
+    }
+
+    if (!dst->pixels) {
+        return SDL_SetError("SDL_FillRects(): You must lock the surface");
+    }
 
+    if (count > FILLRECTS_STACK) {
+        data = SDL_malloc(count * (2 * sizeof (SDL_Rect) + sizeof (int)));
+        if (!data) {
+            return SDL_OutOfMemory();
+        }
+        clipped = (SDL_Rect *) data;
+        spans = clipped + count;
+        active = (int *) (spans + count);
+    }
+
+    /* Clip once up front, then fill top to bottom */
+    num_clipped = 0;
     for (i = 0; i < count; ++i) {
-        status += SDL_FillRect(dst, &rects[i], color);
+        if (SDL_IntersectRect(&rects[i], &dst->clip_rect, &clipped[num_clipped])) {
+            ++num_clipped;
+        }
+    }
+    if (num_clipped > 0) {
+        /* Callers often pass their rectangles in order already */
+        for (i = 1; i < num_clipped; ++i) {
+            if (SDL_CompareFillRects(&clipped[i - 1], &clipped[i]) > 0) {
+                SDL_qsort(clipped, num_clipped, sizeof (SDL_Rect), SDL_CompareFillRects);
+                break;
+            }
+        }
+        fill = SDL_CalculateFillRect(dst, &color);
+        SDL_FillSortedRects(dst, fill, color, clipped, num_clipped, active, spans);
     }
-    return status;
+
+    SDL_free(data);
+    return 0;
 }
 
 /* vi: set ts=4 sw=4 expandtab: */
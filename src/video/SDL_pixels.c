@@ -996,6 +996,100 @@ SDL_InvalidateMap(SDL_BlitMap * map)
     map->info.table = NULL;
 }
 
+/* Palettes change behind the map's back and RLE data is encoded for one
+   destination, so only blits between bitfield formats are remembered */
+static SDL_bool
+SDL_IsCacheableMap(SDL_Surface * src, SDL_PixelFormat * dstfmt)
+{
+    if (SDL_ISPIXELFORMAT_INDEXED(src->format->format) ||
+        SDL_ISPIXELFORMAT_INDEXED(dstfmt->format)) {
+        return SDL_FALSE;
+    }
+    if (src->map->info.flags & SDL_COPY_RLE_MASK) {
+        return SDL_FALSE;
+    }
+    return SDL_TRUE;
+}
+
+/* Remember the blit of a valid mapping for its destination format */
+static void
+SDL_CacheMap(SDL_Surface * src)
+{
+    SDL_BlitMap *map = src->map;
+    SDL_BlitMapCacheEntry entry;
+    int i;
+
+    if (!map->dst || !map->data || !SDL_IsCacheableMap(src, map->dst->format)) {
+        return;
+    }
+
+    entry.dst_fmt = map->dst->format;
+    entry.flags = map->info.flags;
+    entry.identity = map->identity;
+    entry.blit = map->blit;
+    entry.data = map->data;
+    ++entry.dst_fmt->refcount;
+
+    /* Drop an older entry for the same blit, or the least recent one */
+    for (i = 0; i < map->num_cached; ++i) {
+        if (map->cache[i].dst_fmt == entry.dst_fmt &&
+            map->cache[i].flags == entry.flags) {
+            break;
+        }
+    }
+    if (i == SDL_BLITMAP_CACHE_SIZE) {
+        --i;
+    }
+    if (i < map->num_cached) {
+        SDL_FreeFormat(map->cache[i].dst_fmt);
+    } else {
+        ++map->num_cached;
+    }
+    SDL_memmove(&map->cache[1], &map->cache[0], i * sizeof(map->cache[0]));
+    map->cache[0] = entry;
+}
+
+/* Map src to dst with a remembered blit, if there is one */
+static SDL_bool
+SDL_MapSurfaceFromCache(SDL_Surface * src, SDL_Surface * dst)
+{
+    SDL_BlitMap *map = src->map;
+    int i;
+
+    if (!SDL_IsCacheableMap(src, dst->format)) {
+        return SDL_FALSE;
+    }
+    for (i = 0; i < map->num_cached; ++i) {
+        const SDL_BlitMapCacheEntry *entry = &map->cache[i];
+
+        if (entry->dst_fmt == dst->format && entry->flags == map->info.flags) {
+            /* What SDL_MapSurface() and SDL_CalculateBlit() would set up */
+            map->identity = entry->identity;
+            map->blit = entry->blit;
+            map->data = entry->data;
+            map->info.src_fmt = src->format;
+            map->info.src_pitch = src->pitch;
+            map->info.dst_fmt = dst->format;
+            map->info.dst_pitch = dst->pitch;
+            map->dst = dst;
+            ++dst->refcount;
+            return SDL_TRUE;
+        }
+    }
+    return SDL_FALSE;
+}
+
+static void
+SDL_FlushMapCache(SDL_BlitMap * map)
+{
+    int i;
+
+    for (i = 0; i < map->num_cached; ++i) {
+        SDL_FreeFormat(map->cache[i].dst_fmt);
+    }
+    map->num_cached = 0;
+}
+
 int
 SDL_MapSurface(SDL_Surface * src, SDL_Surface * dst)
 {
@@ -1003,13 +1097,18 @@ SDL_MapSurface(SDL_Surface * src, SDL_Surface * dst)
     SDL_PixelFormat *dstfmt;
     SDL_BlitMap *map;
 
-    /* Clear out any previous mapping */
+    /* Clear out any previous mapping, keeping its blit for later */
     map = src->map;
+    SDL_CacheMap(src);
     if ((src->flags & SDL_RLEACCEL) == SDL_RLEACCEL) {
         SDL_UnRLESurface(src, 1);
     }
     SDL_InvalidateMap(map);
 
+    if (SDL_MapSurfaceFromCache(src, dst)) {
+        return 0;
+    }
+
     /* Figure out what kind of mapping we're doing */
     map->identity = 0;
     srcfmt = src->format;
@@ -1087,6 +1186,7 @@ SDL_FreeBlitMap(SDL_BlitMap * map)
 {
     if (map) {
         SDL_InvalidateMap(map);
+        SDL_FlushMapCache(map);
         SDL_free(map);
     }
 }
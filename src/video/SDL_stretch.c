@@ -28,6 +28,7 @@
 
 #include "SDL_video.h"
 #include "SDL_blit.h"
+#include "SDL_cpuinfo.h"
 
 /* This isn't ready for general consumption yet - it should be folded
    into the general blitting mechanism.
@@ -196,6 +197,62 @@ copy_row3(Uint8 * src, int src_w, Uint8 * dst, int dst_w)
     }
 }
 
+typedef struct
+{
+    SDL_Surface *src;
+    const SDL_Rect *srcrect;
+    SDL_Surface *dst;
+    const SDL_Rect *dstrect;
+    int bpp;
+    int inc;
+} SDL_StretchRows;
+
+/* Stretch destination rows [first, last), stepping through the source rows
+   from the top so every band picks the rows a single pass would */
+static int
+SDL_SoftStretchRows(void *data, int first, int last)
+{
+    const SDL_StretchRows *rows = (const SDL_StretchRows *) data;
+    const SDL_Rect *srcrect = rows->srcrect;
+    const SDL_Rect *dstrect = rows->dstrect;
+    const int bpp = rows->bpp;
+    int pos = 0x10000;
+    int src_row = srcrect->y;
+    int i;
+
+    for (i = 0; i < last; ++i) {
+        while (pos >= 0x10000L) {
+            ++src_row;
+            pos -= 0x10000L;
+        }
+        pos += rows->inc;
+        if (i >= first) {
+            Uint8 *srcp = (Uint8 *) rows->src->pixels + ((src_row - 1) * rows->src->pitch)
+                + (srcrect->x * bpp);
+            Uint8 *dstp = (Uint8 *) rows->dst->pixels + ((dstrect->y + i) * rows->dst->pitch)
+                + (dstrect->x * bpp);
+
+            switch (bpp) {
+            case 1:
+                copy_row1(srcp, srcrect->w, dstp, dstrect->w);
+                break;
+            case 2:
+                copy_row2((Uint16 *) srcp, srcrect->w,
+                          (Uint16 *) dstp, dstrect->w);
+                break;
+            case 3:
+                copy_row3(srcp, srcrect->w, dstp, dstrect->w);
+                break;
+            case 4:
+                copy_row4((Uint32 *) srcp, srcrect->w,
+                          (Uint32 *) dstp, dstrect->w);
+                break;
+            }
+        }
+    }
+    return 0;
+}
+
 /* Perform a stretch blit between two surfaces of the same format.
    NOTE:  This function is not safe to call from multiple threads!
 */
@@ -205,14 +262,15 @@ SDL_SoftStretch(SDL_Surface * src, const SDL_Rect * srcrect,
 {
     int src_locked;
     int dst_locked;
-    int pos, inc;
+    int inc;
+    SDL_Rect full_src;
+    SDL_Rect full_dst;
+#ifdef USE_ASM_STRETCH
+    int pos;
     int dst_maxrow;
     int src_row, dst_row;
     Uint8 *srcp = NULL;
     Uint8 *dstp;
-    SDL_Rect full_src;
-    SDL_Rect full_dst;
-#ifdef USE_ASM_STRETCH
     SDL_bool use_asm = SDL_TRUE;
 #ifdef __GNUC__
     int u1, u2;
@@ -273,30 +331,29 @@ SDL_SoftStretch(SDL_Surface * src, const SDL_Rect * srcrect,
     }
 
     /* Set up the data... */
-    pos = 0x10000;
     inc = (srcrect->h << 16) / dstrect->h;
+
+#ifdef USE_ASM_STRETCH
+    pos = 0x10000;
     src_row = srcrect->y;
     dst_row = dstrect->y;
 
-#ifdef USE_ASM_STRETCH
     /* Write the opcodes for this stretch */
     if ((bpp == 3) || (generate_rowbytes(srcrect->w, dstrect->w, bpp) < 0)) {
         use_asm = SDL_FALSE;
     }
-#endif
 
     /* Perform the stretch blit */
-    for (dst_maxrow = dst_row + dstrect->h; dst_row < dst_maxrow; ++dst_row) {
-        dstp = (Uint8 *) dst->pixels + (dst_row * dst->pitch)
-            + (dstrect->x * bpp);
-        while (pos >= 0x10000L) {
-            srcp = (Uint8 *) src->pixels + (src_row * src->pitch)
-                + (srcrect->x * bpp);
-            ++src_row;
-            pos -= 0x10000L;
-        }
-#ifdef USE_ASM_STRETCH
-        if (use_asm) {
+    if (use_asm) {
+        for (dst_maxrow = dst_row + dstrect->h; dst_row < dst_maxrow; ++dst_row) {
+            dstp = (Uint8 *) dst->pixels + (dst_row * dst->pitch)
+                + (dstrect->x * bpp);
+            while (pos >= 0x10000L) {
+                srcp = (Uint8 *) src->pixels + (src_row * src->pitch)
+                    + (srcrect->x * bpp);
+                ++src_row;
+                pos -= 0x10000L;
+            }
 #ifdef __GNUC__
             __asm__ __volatile__("call *%4":"=&D"(u1), "=&S"(u2)
                                  :"0"(dstp), "1"(srcp), "r"(copy_row)
@@ -319,25 +376,406 @@ SDL_SoftStretch(SDL_Surface * src, const SDL_Rect * srcrect,
 #else
 #error Need inline assembly for this compiler
 #endif
-        } else
+            pos += inc;
+        }
+    } else
+#endif /* USE_ASM_STRETCH */
+    {
+        SDL_StretchRows rows;
+
+        rows.src = src;
+        rows.srcrect = srcrect;
+        rows.dst = dst;
+        rows.dstrect = dstrect;
+        rows.bpp = bpp;
+        rows.inc = inc;
+
+        /* In bands when it's large, unless the rows may overlap */
+        if (src != dst) {
+            SDL_RunBlitRows(SDL_SoftStretchRows, &rows, dstrect->h,
+                            (Sint64) dstrect->w * dstrect->h);
+        } else {
+            SDL_SoftStretchRows(&rows, 0, dstrect->h);
+        }
+    }
+
+    /* We need to unlock the surfaces if they're locked */
+    if (dst_locked) {
+        SDL_UnlockSurface(dst);
+    }
+    if (src_locked) {
+        SDL_UnlockSurface(src);
+    }
+    return (0);
+}
+
+/* Linear filtering for 32-bit pixels.
+
+   Every destination pixel samples the source at its center, mapped back
+   into the source rect, and blends the 2x2 source pixels around it with
+   8-bit weights. Rows are blended vertically first into a scratch row,
+   which the SIMD versions do 16 bytes at a time, then each destination
+   pixel blends two neighbours of the scratch row. The SIMD versions give
+   exactly the same results as the scalar one:
+
+       out = (a * (256 - f) + b * f) >> 8   per channel
+*/
+
+#ifdef __SSE2__
+#define HAVE_SSE2_INTRINSICS 1
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define HAVE_NEON_INTRINSICS 1
 #endif
-            switch (bpp) {
-            case 1:
-                copy_row1(srcp, srcrect->w, dstp, dstrect->w);
-                break;
-            case 2:
-                copy_row2((Uint16 *) srcp, srcrect->w,
-                          (Uint16 *) dstp, dstrect->w);
-                break;
-            case 3:
-                copy_row3(srcp, srcrect->w, dstp, dstrect->w);
-                break;
-            case 4:
-                copy_row4((Uint32 *) srcp, srcrect->w,
-                          (Uint32 *) dstp, dstrect->w);
-                break;
+
+#if SDL_ALTIVEC_BLITTERS && defined(__ALTIVEC__)
+#define HAVE_ALTIVEC_INTRINSICS 1
+#endif
+
+/* Two channels at a time, the weights sum to 256 so the lanes never overflow */
+#define LERP_PIXEL(a, b, f) \
+    (((((a) & 0x00FF00FF) * (256 - (f)) + ((b) & 0x00FF00FF) * (f)) >> 8) & 0x00FF00FF) | \
+    (((((a) >> 8) & 0x00FF00FF) * (256 - (f)) + (((b) >> 8) & 0x00FF00FF) * (f)) & 0xFF00FF00)
+
+static void
+lerp_rows_scalar(const Uint32 *row0, const Uint32 *row1, Uint32 *dst, int width, int f)
+{
+    int i;
+
+    for (i = 0; i < width; ++i) {
+        dst[i] = LERP_PIXEL(row0[i], row1[i], f);
+    }
+}
+
+static void
+lerp_columns_scalar(const Uint32 *src, Uint32 *dst, const int *x0, const Uint8 *fx, int width)
+{
+    int i;
+
+    for (i = 0; i < width; ++i) {
+        dst[i] = LERP_PIXEL(src[x0[i]], src[x0[i] + 1], fx[i]);
+    }
+}
+
+#if HAVE_SSE2_INTRINSICS
+static void
+lerp_rows_SSE2(const Uint32 *row0, const Uint32 *row1, Uint32 *dst, int width, int f)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i w0 = _mm_set1_epi16((short) (256 - f));
+    const __m128i w1 = _mm_set1_epi16((short) f);
+    int i;
+
+    for (i = 0; i + 4 <= width; i += 4) {
+        const __m128i a = _mm_loadu_si128((const __m128i *) &row0[i]);
+        const __m128i b = _mm_loadu_si128((const __m128i *) &row1[i]);
+        __m128i lo, hi;
+
+        lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(a, zero), w0),
+                           _mm_mullo_epi16(_mm_unpacklo_epi8(b, zero), w1));
+        hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(a, zero), w0),
+                           _mm_mullo_epi16(_mm_unpackhi_epi8(b, zero), w1));
+        _mm_storeu_si128((__m128i *) &dst[i],
+                         _mm_packus_epi16(_mm_srli_epi16(lo, 8), _mm_srli_epi16(hi, 8)));
+    }
+    lerp_rows_scalar(&row0[i], &row1[i], &dst[i], width - i, f);
+}
+
+static void
+lerp_columns_SSE2(const Uint32 *src, Uint32 *dst, const int *x0, const Uint8 *fx, int width)
+{
+    const __m128i zero = _mm_setzero_si128();
+    int i;
+
+    /* Two pixels at a time, each from the pair of source pixels it sits between */
+    for (i = 0; i + 2 <= width; i += 2) {
+        const __m128i p = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *) &src[x0[i]]), zero);
+        const __m128i q = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *) &src[x0[i + 1]]), zero);
+        const short fp = (short) fx[i], fq = (short) fx[i + 1];
+        __m128i wp, wq;
+
+        wp = _mm_set_epi16(fp, fp, fp, fp, 256 - fp, 256 - fp, 256 - fp, 256 - fp);
+        wq = _mm_set_epi16(fq, fq, fq, fq, 256 - fq, 256 - fq, 256 - fq, 256 - fq);
+        wp = _mm_mullo_epi16(p, wp);
+        wq = _mm_mullo_epi16(q, wq);
+        wp = _mm_add_epi16(wp, _mm_srli_si128(wp, 8));
+        wq = _mm_add_epi16(wq, _mm_srli_si128(wq, 8));
+        wp = _mm_srli_epi16(_mm_unpacklo_epi64(wp, wq), 8);
+        _mm_storel_epi64((__m128i *) &dst[i], _mm_packus_epi16(wp, wp));
+    }
+    lerp_columns_scalar(src, &dst[i], &x0[i], &fx[i], width - i);
+}
+#endif /* HAVE_SSE2_INTRINSICS */
+
+#if HAVE_NEON_INTRINSICS
+static void
+lerp_rows_NEON(const Uint32 *row0, const Uint32 *row1, Uint32 *dst, int width, int f)
+{
+    /* a * (256 - f) is a * (255 - f) + a, which keeps the weights in 8 bits */
+    const uint8x8_t w0 = vdup_n_u8((uint8_t) (255 - f));
+    const uint8x8_t w1 = vdup_n_u8((uint8_t) f);
+    int i;
+
+    for (i = 0; i + 4 <= width; i += 4) {
+        const uint8x16_t a = vld1q_u8((const uint8_t *) &row0[i]);
+        const uint8x16_t b = vld1q_u8((const uint8_t *) &row1[i]);
+        uint16x8_t lo, hi;
+
+        lo = vaddw_u8(vmlal_u8(vmull_u8(vget_low_u8(a), w0), vget_low_u8(b), w1), vget_low_u8(a));
+        hi = vaddw_u8(vmlal_u8(vmull_u8(vget_high_u8(a), w0), vget_high_u8(b), w1), vget_high_u8(a));
+        vst1q_u8((uint8_t *) &dst[i], vcombine_u8(vshrn_n_u16(lo, 8), vshrn_n_u16(hi, 8)));
+    }
+    lerp_rows_scalar(&row0[i], &row1[i], &dst[i], width - i, f);
+}
+#endif /* HAVE_NEON_INTRINSICS */
+
+#if HAVE_ALTIVEC_INTRINSICS
+static void
+lerp_rows_AltiVec(const Uint32 *row0, const Uint32 *row1, Uint32 *dst, int width, int f)
+{
+    const vector unsigned char zero = vec_splat_u8(0);
+    const vector unsigned short shift = vec_splat_u16(8);
+    vector unsigned short w0, w1;
+    int i;
+
+    /* vec_splat_u16() only takes 5-bit literals, build the weights in memory */
+    union {
+        vector unsigned short v;
+        unsigned short s[8];
+    } weights;
+
+    for (i = 0; i < 8; ++i) {
+        weights.s[i] = (unsigned short) (256 - f);
+    }
+    w0 = weights.v;
+    for (i = 0; i < 8; ++i) {
+        weights.s[i] = (unsigned short) f;
+    }
+    w1 = weights.v;
+
+    /* The rows aren't aligned, only the scratch row gets vector stores */
+    for (i = 0; i + 4 <= width; i += 4) {
+        vector unsigned char a, b;
+        vector unsigned short lo, hi;
+
+        a = vec_perm(vec_ld(0, (const unsigned char *) &row0[i]), vec_ld(15, (const unsigned char *) &row0[i]),
+                     vec_lvsl(0, (const unsigned char *) &row0[i]));
+        b = vec_perm(vec_ld(0, (const unsigned char *) &row1[i]), vec_ld(15, (const unsigned char *) &row1[i]),
+                     vec_lvsl(0, (const unsigned char *) &row1[i]));
+        lo = vec_mladd((vector unsigned short) vec_mergeh(zero, a), w0,
+                       vec_mladd((vector unsigned short) vec_mergeh(zero, b), w1, vec_splat_u16(0)));
+        hi = vec_mladd((vector unsigned short) vec_mergel(zero, a), w0,
+                       vec_mladd((vector unsigned short) vec_mergel(zero, b), w1, vec_splat_u16(0)));
+        vec_st(vec_packsu(vec_sr(lo, shift), vec_sr(hi, shift)), 0, (unsigned char *) &dst[i]);
+    }
+    lerp_rows_scalar(&row0[i], &row1[i], &dst[i], width - i, f);
+}
+#endif /* HAVE_ALTIVEC_INTRINSICS */
+
+/* Where destination pixel 'i' samples the source, in 16.16 fixed point */
+static void
+get_sample_position(int i, int src_len, int dst_len, int *pos, int *frac)
+{
+    Sint64 p = ((Sint64) (2 * i + 1) * src_len * 0x8000) / dst_len - 0x8000;
+
+    if (p <= 0) {
+        *pos = 0;
+        *frac = 0;
+    } else if (p >= (Sint64) (src_len - 1) << 16) {
+        *pos = src_len - 1;
+        *frac = 0;
+    } else {
+        *pos = (int) (p >> 16);
+        *frac = (int) ((p >> 8) & 0xFF);
+    }
+}
+
+typedef struct
+{
+    SDL_Surface *src;
+    const SDL_Rect *srcrect;
+    SDL_Surface *dst;
+    const SDL_Rect *dstrect;
+    const int *x0;
+    const Uint8 *fx;
+    void (*lerp_rows)(const Uint32 *, const Uint32 *, Uint32 *, int, int);
+    void (*lerp_columns)(const Uint32 *, Uint32 *, const int *, const Uint8 *, int);
+} SDL_StretchLinearRows;
+
+/* Filter destination rows [first, last), with a scratch row of their own */
+static int
+SDL_SoftStretchLinearRows(void *data, int first, int last)
+{
+    const SDL_StretchLinearRows *rows = (const SDL_StretchLinearRows *) data;
+    const SDL_Rect *srcrect = rows->srcrect;
+    const SDL_Rect *dstrect = rows->dstrect;
+    SDL_Surface *src = rows->src;
+    SDL_Surface *dst = rows->dst;
+    void *scratch;
+    Uint32 *row;
+    int last_y0 = -1, last_fy = -1;
+    int i, y0, fy;
+
+    /* A 16 byte aligned scratch row with room to read one past the end */
+    scratch = SDL_malloc(16 + ((srcrect->w + 4) & ~3) * sizeof(Uint32));
+    if (!scratch) {
+        return SDL_OutOfMemory();
+    }
+    row = (Uint32 *) (((uintptr_t) scratch + 15) & ~(uintptr_t) 15);
+
+    for (i = first; i < last; ++i) {
+        Uint32 *dstp = (Uint32 *) ((Uint8 *) dst->pixels + (dstrect->y + i) * dst->pitch) + dstrect->x;
+
+        get_sample_position(i, srcrect->h, dstrect->h, &y0, &fy);
+
+        /* Rows sampling the same spot share the scratch row */
+        if (y0 != last_y0 || fy != last_fy) {
+            const Uint32 *row0 = (const Uint32 *) ((const Uint8 *) src->pixels + (srcrect->y + y0) * src->pitch) + srcrect->x;
+
+            if (fy) {
+                const Uint32 *row1 = (const Uint32 *) ((const Uint8 *) row0 + src->pitch);
+                rows->lerp_rows(row0, row1, row, srcrect->w, fy);
+            } else {
+                SDL_memcpy(row, row0, srcrect->w * sizeof(Uint32));
             }
-        pos += inc;
+            row[srcrect->w] = row[srcrect->w - 1];
+            last_y0 = y0;
+            last_fy = fy;
+        }
+        rows->lerp_columns(row, dstp, rows->x0, rows->fx, dstrect->w);
+    }
+
+    SDL_free(scratch);
+    return 0;
+}
+
+/* Perform a bilinear filtered stretch blit between two surfaces of the same
+   32-bit format. Unlike SDL_SoftStretch() this is safe to call from multiple
+   threads.
+*/
+int
+SDL_SoftStretchLinear(SDL_Surface * src, const SDL_Rect * srcrect,
+                      SDL_Surface * dst, const SDL_Rect * dstrect)
+{
+    void (*lerp_rows)(const Uint32 *, const Uint32 *, Uint32 *, int, int) = lerp_rows_scalar;
+    void (*lerp_columns)(const Uint32 *, Uint32 *, const int *, const Uint8 *, int) = lerp_columns_scalar;
+    SDL_Rect full_src;
+    SDL_Rect full_dst;
+    SDL_StretchLinearRows rows;
+    int src_locked;
+    int dst_locked;
+    int *x0;
+    Uint8 *fx;
+    int i, retval;
+
+    if (src->format->format != dst->format->format) {
+        return SDL_SetError("Only works with same format surfaces");
+    }
+    if (src->format->BytesPerPixel != 4) {
+        return SDL_SetError("Only works with 32-bit surfaces");
+    }
+
+    /* Verify the blit rectangles */
+    if (srcrect) {
+        if ((srcrect->x < 0) || (srcrect->y < 0) ||
+            ((srcrect->x + srcrect->w) > src->w) ||
+            ((srcrect->y + srcrect->h) > src->h)) {
+            return SDL_SetError("Invalid source blit rectangle");
+        }
+    } else {
+        full_src.x = 0;
+        full_src.y = 0;
+        full_src.w = src->w;
+        full_src.h = src->h;
+        srcrect = &full_src;
+    }
+    if (dstrect) {
+        if ((dstrect->x < 0) || (dstrect->y < 0) ||
+            ((dstrect->x + dstrect->w) > dst->w) ||
+            ((dstrect->y + dstrect->h) > dst->h)) {
+            return SDL_SetError("Invalid destination blit rectangle");
+        }
+    } else {
+        full_dst.x = 0;
+        full_dst.y = 0;
+        full_dst.w = dst->w;
+        full_dst.h = dst->h;
+        dstrect = &full_dst;
+    }
+    if (srcrect->w <= 0 || srcrect->h <= 0 || dstrect->w <= 0 || dstrect->h <= 0) {
+        return 0;
+    }
+
+    /* The column positions, shared by all the rows */
+    x0 = (int *) SDL_malloc(dstrect->w * (sizeof(int) + sizeof(Uint8)));
+    if (!x0) {
+        return SDL_OutOfMemory();
+    }
+    fx = (Uint8 *) (x0 + dstrect->w);
+    for (i = 0; i < dstrect->w; ++i) {
+        int pos, frac;
+
+        get_sample_position(i, srcrect->w, dstrect->w, &pos, &frac);
+        x0[i] = pos;
+        fx[i] = (Uint8) frac;
+    }
+
+#if HAVE_SSE2_INTRINSICS
+    if (SDL_HasSSE2()) {
+        lerp_rows = lerp_rows_SSE2;
+        lerp_columns = lerp_columns_SSE2;
+    }
+#endif
+#if HAVE_NEON_INTRINSICS
+    if (SDL_HasNEON()) {
+        lerp_rows = lerp_rows_NEON;
+    }
+#endif
+#if HAVE_ALTIVEC_INTRINSICS
+    if (SDL_HasAltiVec()) {
+        lerp_rows = lerp_rows_AltiVec;
+    }
+#endif
+
+    /* Lock the destination if it's in hardware */
+    dst_locked = 0;
+    if (SDL_MUSTLOCK(dst)) {
+        if (SDL_LockSurface(dst) < 0) {
+            SDL_free(x0);
+            return SDL_SetError("Unable to lock destination surface");
+        }
+        dst_locked = 1;
+    }
+    /* Lock the source if it's in hardware */
+    src_locked = 0;
+    if (SDL_MUSTLOCK(src)) {
+        if (SDL_LockSurface(src) < 0) {
+            if (dst_locked) {
+                SDL_UnlockSurface(dst);
+            }
+            SDL_free(x0);
+            return SDL_SetError("Unable to lock source surface");
+        }
+        src_locked = 1;
+    }
+
+    rows.src = src;
+    rows.srcrect = srcrect;
+    rows.dst = dst;
+    rows.dstrect = dstrect;
+    rows.x0 = x0;
+    rows.fx = fx;
+    rows.lerp_rows = lerp_rows;
+    rows.lerp_columns = lerp_columns;
+
+    /* In bands when it's large, unless the rows may overlap */
+    if (src != dst) {
+        retval = SDL_RunBlitRows(SDL_SoftStretchLinearRows, &rows, dstrect->h,
+                                 (Sint64) dstrect->w * dstrect->h);
+    } else {
+        retval = SDL_SoftStretchLinearRows(&rows, 0, dstrect->h);
     }
 
     /* We need to unlock the surfaces if they're locked */
@@ -347,7 +785,8 @@ SDL_SoftStretch(SDL_Surface * src, const SDL_Rect * srcrect,
     if (src_locked) {
         SDL_UnlockSurface(src);
     }
-    return (0);
+    SDL_free(x0);
+    return retval;
 }
 
 /* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,1031 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2017 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../SDL_internal.h"
+
+#include "SDL_video.h"
+#include "SDL_cpuinfo.h"
+#include "SDL_blit.h"
+#include "SDL_yuv_c.h"
+
+/* YUV to RGB conversion.
+
+   Each pixel is converted with integer coefficients scaled by 2^13, so
+   with Y' and the chroma values offset to zero:
+
+     R = (y * Y' + rv * V'           + 4096) >> 13
+     G = (y * Y' + gu * U' + gv * V' + 4096) >> 13
+     B = (y * Y' + bu * U'           + 4096) >> 13
+
+   clamped to 0-255. Every product fits in 16 bits and every sum in 32 bits,
+   so the SIMD versions use multiply-add of 16-bit pairs and give exactly
+   the same results as the scalar one. The chroma of a pixel pair is used
+   as is, without interpolation.
+*/
+
+#ifdef __SSE2__
+#define HAVE_SSE2_INTRINSICS 1
+#endif
+
+#if (defined(__ARM_NEON) || defined(__ARM_NEON__)) && SDL_BYTEORDER == SDL_LIL_ENDIAN
+#include <arm_neon.h>
+#define HAVE_NEON_INTRINSICS 1
+#endif
+
+/* The resolution at which AUTOMATIC switches from BT.601 to BT.709 */
+#define SDL_YUV_SD_THRESHOLD    576
+
+#define YUV_SHIFT       13
+#define YUV_ROUND       (1 << (YUV_SHIFT - 1))
+
+static SDL_YUV_CONVERSION_MODE SDL_YUV_ConversionMode = SDL_YUV_CONVERSION_JPEG;
+
+void SDL_SetYUVConversionMode(SDL_YUV_CONVERSION_MODE mode)
+{
+    SDL_YUV_ConversionMode = mode;
+}
+
+SDL_YUV_CONVERSION_MODE SDL_GetYUVConversionMode(void)
+{
+    return SDL_YUV_ConversionMode;
+}
+
+SDL_YUV_CONVERSION_MODE SDL_GetYUVConversionModeForResolution(int width, int height)
+{
+    SDL_YUV_CONVERSION_MODE mode = SDL_GetYUVConversionMode();
+    if (mode == SDL_YUV_CONVERSION_AUTOMATIC) {
+        if (height <= SDL_YUV_SD_THRESHOLD) {
+            mode = SDL_YUV_CONVERSION_BT601;
+        } else {
+            mode = SDL_YUV_CONVERSION_BT709;
+        }
+    }
+    return mode;
+}
+
+typedef struct
+{
+    int y_offset;
+    Sint16 y, rv, gu, gv, bu;
+} SDL_YUVMatrix;
+
+/* Indexed by SDL_YUV_CONVERSION_MODE */
+static const SDL_YUVMatrix SDL_YUVMatrices[] = {
+    {  0, 8192, 11485, -2819, -5850, 14516 },   /* JPEG */
+    { 16, 9539, 13075, -3209, -6660, 16525 },   /* BT.601 */
+    { 16, 9539, 14686, -1747, -4366, 17305 }    /* BT.709 */
+};
+
+/* Where the samples of a YUV image are */
+typedef struct
+{
+    SDL_bool chroma_420;            /* one chroma row for every two rows */
+
+    /* Where the first pixel of a row is, and the bytes between pixels */
+    Uint8 *planes[3];               /* Y, U and V */
+    int pitches[3];
+    int y_step;
+    int c_step;
+} SDL_YUVLayout;
+
+typedef struct
+{
+    const SDL_YUVMatrix *matrix;
+    int width;
+    int height;
+    SDL_YUVLayout yuv;
+
+    /* The destination, an 8888 format */
+    int shifts[3];                  /* of R, G and B */
+    Uint32 alpha;
+    int order[4];                   /* R, G, B or A (3) in each byte of memory */
+    Uint8 *dst;
+    int dst_pitch;
+} SDL_YUVConverter;
+
+static SDL_INLINE Uint32
+SDL_ClampYUV(int value)
+{
+    return (Uint32) (value < 0 ? 0 : (value > 255 ? 255 : value));
+}
+
+/* Pixels 'x' to 'width' of a row */
+static void
+SDL_YUVRow_scalar(const SDL_YUVConverter * conv, const Uint8 * y, const Uint8 * u,
+                  const Uint8 * v, Uint32 * dst, int x, int width)
+{
+    const SDL_YUVMatrix *m = conv->matrix;
+    const int y_step = conv->yuv.y_step;
+    const int c_step = conv->yuv.c_step;
+
+    for (; x < width; ++x) {
+        const int Y = m->y * (y[x * y_step] - m->y_offset) + YUV_ROUND;
+        const int U = u[(x / 2) * c_step] - 128;
+        const int V = v[(x / 2) * c_step] - 128;
+
+        dst[x] = (SDL_ClampYUV((Y + m->rv * V) >> YUV_SHIFT) << conv->shifts[0]) |
+                 (SDL_ClampYUV((Y + m->gu * U + m->gv * V) >> YUV_SHIFT) << conv->shifts[1]) |
+                 (SDL_ClampYUV((Y + m->bu * U) >> YUV_SHIFT) << conv->shifts[2]) |
+                 conv->alpha;
+    }
+}
+
+#if HAVE_SSE2_INTRINSICS
+/* R, G and B of 8 pixels in 16-bit lanes, 'k' holds the coefficient pairs */
+static SDL_INLINE void
+SDL_YUVToRGB_SSE2(__m128i y, __m128i u, __m128i v, const __m128i k[4],
+                  __m128i * r, __m128i * g, __m128i * b)
+{
+    const __m128i one = _mm_set1_epi16(1);
+    const __m128i ylo = _mm_madd_epi16(_mm_unpacklo_epi16(y, one), k[0]);
+    const __m128i yhi = _mm_madd_epi16(_mm_unpackhi_epi16(y, one), k[0]);
+    const __m128i uvlo = _mm_unpacklo_epi16(u, v);
+    const __m128i uvhi = _mm_unpackhi_epi16(u, v);
+
+#define YUV_CHANNEL_SSE2(c) \
+    _mm_packs_epi32( \
+        _mm_srai_epi32(_mm_add_epi32(ylo, _mm_madd_epi16(uvlo, k[c])), YUV_SHIFT), \
+        _mm_srai_epi32(_mm_add_epi32(yhi, _mm_madd_epi16(uvhi, k[c])), YUV_SHIFT))
+    *r = YUV_CHANNEL_SSE2(1);
+    *g = YUV_CHANNEL_SSE2(2);
+    *b = YUV_CHANNEL_SSE2(3);
+#undef YUV_CHANNEL_SSE2
+}
+
+/* 16 pixels per iteration; returns how many pixels were converted */
+static int
+SDL_YUVRow_SSE2(const SDL_YUVConverter * conv, const Uint8 * y, const Uint8 * u,
+                const Uint8 * v, Uint32 * dst, int width)
+{
+    const SDL_YUVMatrix *m = conv->matrix;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i lo_bytes = _mm_set1_epi16(0x00FF);
+    const __m128i lo_words = _mm_set1_epi32(0x0000FFFF);
+    const __m128i y_offset = _mm_set1_epi16((short) m->y_offset);
+    const __m128i c_offset = _mm_set1_epi16(128);
+    const __m128i alpha = _mm_set1_epi8((char) 0xFF);
+    const int y_step = conv->yuv.y_step;
+    const int c_step = conv->yuv.c_step;
+    __m128i k[4];
+    int x;
+
+    k[0] = _mm_set_epi16(YUV_ROUND, m->y, YUV_ROUND, m->y, YUV_ROUND, m->y, YUV_ROUND, m->y);
+    k[1] = _mm_set_epi16(m->rv, 0, m->rv, 0, m->rv, 0, m->rv, 0);
+    k[2] = _mm_set_epi16(m->gv, m->gu, m->gv, m->gu, m->gv, m->gu, m->gv, m->gu);
+    k[3] = _mm_set_epi16(0, m->bu, 0, m->bu, 0, m->bu, 0, m->bu);
+
+    for (x = 0; x + 16 <= width; x += 16) {
+        __m128i Y[2], U[2], V[2], ch[4], r[2], g[2], b[2], lo, hi;
+        int i;
+
+        if (y_step == 1) {
+            const __m128i yy = _mm_loadu_si128((const __m128i *) (y + x));
+            __m128i uu, vv;
+
+            Y[0] = _mm_unpacklo_epi8(yy, zero);
+            Y[1] = _mm_unpackhi_epi8(yy, zero);
+            if (c_step == 1) {
+                uu = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *) (u + x / 2)), zero);
+                vv = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *) (v + x / 2)), zero);
+            } else {
+                /* Interleaved chroma, U and V are in alternate bytes */
+                const __m128i cc = _mm_loadu_si128((const __m128i *) (u < v ? u + x : v + x));
+                uu = (u < v) ? _mm_and_si128(cc, lo_bytes) : _mm_srli_epi16(cc, 8);
+                vv = (u < v) ? _mm_srli_epi16(cc, 8) : _mm_and_si128(cc, lo_bytes);
+            }
+            U[0] = _mm_unpacklo_epi16(uu, uu);
+            U[1] = _mm_unpackhi_epi16(uu, uu);
+            V[0] = _mm_unpacklo_epi16(vv, vv);
+            V[1] = _mm_unpackhi_epi16(vv, vv);
+        } else {
+            /* Packed, luma in every other byte and chroma pairs in between */
+            const Uint8 *p = SDL_min(y, SDL_min(u, v)) + x * 2;
+            const SDL_bool y_first = (y < u);
+
+            for (i = 0; i < 2; ++i) {
+                const __m128i pp = _mm_loadu_si128((const __m128i *) (p + i * 16));
+                const __m128i luma = y_first ? _mm_and_si128(pp, lo_bytes) : _mm_srli_epi16(pp, 8);
+                const __m128i cc = y_first ? _mm_srli_epi16(pp, 8) : _mm_and_si128(pp, lo_bytes);
+                const __m128i first = _mm_or_si128(_mm_and_si128(cc, lo_words), _mm_slli_epi32(cc, 16));
+                const __m128i second = _mm_or_si128(_mm_andnot_si128(lo_words, cc), _mm_srli_epi32(cc, 16));
+
+                Y[i] = luma;
+                U[i] = (u < v) ? first : second;
+                V[i] = (u < v) ? second : first;
+            }
+        }
+
+        for (i = 0; i < 2; ++i) {
+            SDL_YUVToRGB_SSE2(_mm_sub_epi16(Y[i], y_offset), _mm_sub_epi16(U[i], c_offset),
+                              _mm_sub_epi16(V[i], c_offset), k, &r[i], &g[i], &b[i]);
+        }
+        ch[0] = _mm_packus_epi16(r[0], r[1]);
+        ch[1] = _mm_packus_epi16(g[0], g[1]);
+        ch[2] = _mm_packus_epi16(b[0], b[1]);
+        ch[3] = conv->alpha ? alpha : zero;
+
+        /* Interleave the channels into pixels in memory order */
+        lo = _mm_unpacklo_epi8(ch[conv->order[0]], ch[conv->order[1]]);
+        hi = _mm_unpacklo_epi8(ch[conv->order[2]], ch[conv->order[3]]);
+        _mm_storeu_si128((__m128i *) (dst + x + 0), _mm_unpacklo_epi16(lo, hi));
+        _mm_storeu_si128((__m128i *) (dst + x + 4), _mm_unpackhi_epi16(lo, hi));
+        lo = _mm_unpackhi_epi8(ch[conv->order[0]], ch[conv->order[1]]);
+        hi = _mm_unpackhi_epi8(ch[conv->order[2]], ch[conv->order[3]]);
+        _mm_storeu_si128((__m128i *) (dst + x + 8), _mm_unpacklo_epi16(lo, hi));
+        _mm_storeu_si128((__m128i *) (dst + x + 12), _mm_unpackhi_epi16(lo, hi));
+    }
+    return x;
+}
+#endif /* HAVE_SSE2_INTRINSICS */
+
+#if HAVE_AVX2_INTRINSICS
+/* As SDL_YUVToRGB_SSE2(), for 16 pixels. The unpacks work within 128-bit
+   halves and the packs put the pixels back in order. */
+static SDL_INLINE SDL_TARGET_AVX2 void
+SDL_YUVToRGB_AVX2(__m256i y, __m256i u, __m256i v, const __m256i k[4],
+                  __m256i * r, __m256i * g, __m256i * b)
+{
+    const __m256i one = _mm256_set1_epi16(1);
+    const __m256i ylo = _mm256_madd_epi16(_mm256_unpacklo_epi16(y, one), k[0]);
+    const __m256i yhi = _mm256_madd_epi16(_mm256_unpackhi_epi16(y, one), k[0]);
+    const __m256i uvlo = _mm256_unpacklo_epi16(u, v);
+    const __m256i uvhi = _mm256_unpackhi_epi16(u, v);
+
+#define YUV_CHANNEL_AVX2(c) \
+    _mm256_packs_epi32( \
+        _mm256_srai_epi32(_mm256_add_epi32(ylo, _mm256_madd_epi16(uvlo, k[c])), YUV_SHIFT), \
+        _mm256_srai_epi32(_mm256_add_epi32(yhi, _mm256_madd_epi16(uvhi, k[c])), YUV_SHIFT))
+    *r = YUV_CHANNEL_AVX2(1);
+    *g = YUV_CHANNEL_AVX2(2);
+    *b = YUV_CHANNEL_AVX2(3);
+#undef YUV_CHANNEL_AVX2
+}
+
+/* 32 pixels per iteration; returns how many pixels were converted */
+static SDL_TARGET_AVX2 int
+SDL_YUVRow_AVX2(const SDL_YUVConverter * conv, const Uint8 * y, const Uint8 * u,
+                const Uint8 * v, Uint32 * dst, int width)
+{
+    const SDL_YUVMatrix *m = conv->matrix;
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i lo_bytes = _mm256_set1_epi16(0x00FF);
+    const __m256i lo_words = _mm256_set1_epi32(0x0000FFFF);
+    const __m256i y_offset = _mm256_set1_epi16((short) m->y_offset);
+    const __m256i c_offset = _mm256_set1_epi16(128);
+    const __m256i alpha = _mm256_set1_epi8((char) 0xFF);
+    const int y_step = conv->yuv.y_step;
+    const int c_step = conv->yuv.c_step;
+    __m256i k[4];
+    int x;
+
+    k[0] = _mm256_set1_epi32((YUV_ROUND << 16) | (Uint16) m->y);
+    k[1] = _mm256_set1_epi32((int) ((Uint32) (Uint16) m->rv << 16));
+    k[2] = _mm256_set1_epi32((int) (((Uint32) (Uint16) m->gv << 16) | (Uint16) m->gu));
+    k[3] = _mm256_set1_epi32((Uint16) m->bu);
+
+    for (x = 0; x + 32 <= width; x += 32) {
+        __m256i Y[2], U[2], V[2], ch[4], r[2], g[2], b[2], lo, hi, p0, p1, p2, p3;
+        int i;
+
+        if (y_step == 1) {
+            __m256i uu, vv;
+
+            Y[0] = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *) (y + x)));
+            Y[1] = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *) (y + x + 16)));
+            if (c_step == 1) {
+                uu = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *) (u + x / 2)));
+                vv = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *) (v + x / 2)));
+            } else {
+                const __m256i cc = _mm256_loadu_si256((const __m256i *) (u < v ? u + x : v + x));
+                uu = (u < v) ? _mm256_and_si256(cc, lo_bytes) : _mm256_srli_epi16(cc, 8);
+                vv = (u < v) ? _mm256_srli_epi16(cc, 8) : _mm256_and_si256(cc, lo_bytes);
+            }
+            /* Quarters 0 2 1 3, so the unpacks below double them in order */
+            uu = _mm256_permute4x64_epi64(uu, 0xD8);
+            vv = _mm256_permute4x64_epi64(vv, 0xD8);
+            U[0] = _mm256_unpacklo_epi16(uu, uu);
+            U[1] = _mm256_unpackhi_epi16(uu, uu);
+            V[0] = _mm256_unpacklo_epi16(vv, vv);
+            V[1] = _mm256_unpackhi_epi16(vv, vv);
+        } else {
+            const Uint8 *p = SDL_min(y, SDL_min(u, v)) + x * 2;
+            const SDL_bool y_first = (y < u);
+
+            for (i = 0; i < 2; ++i) {
+                const __m256i pp = _mm256_loadu_si256((const __m256i *) (p + i * 32));
+                const __m256i luma = y_first ? _mm256_and_si256(pp, lo_bytes) : _mm256_srli_epi16(pp, 8);
+                const __m256i cc = y_first ? _mm256_srli_epi16(pp, 8) : _mm256_and_si256(pp, lo_bytes);
+                const __m256i first = _mm256_or_si256(_mm256_and_si256(cc, lo_words), _mm256_slli_epi32(cc, 16));
+                const __m256i second = _mm256_or_si256(_mm256_andnot_si256(lo_words, cc), _mm256_srli_epi32(cc, 16));
+
+                Y[i] = luma;
+                U[i] = (u < v) ? first : second;
+                V[i] = (u < v) ? second : first;
+            }
+        }
+
+        for (i = 0; i < 2; ++i) {
+            SDL_YUVToRGB_AVX2(_mm256_sub_epi16(Y[i], y_offset), _mm256_sub_epi16(U[i], c_offset),
+                              _mm256_sub_epi16(V[i], c_offset), k, &r[i], &g[i], &b[i]);
+        }
+        ch[0] = _mm256_permute4x64_epi64(_mm256_packus_epi16(r[0], r[1]), 0xD8);
+        ch[1] = _mm256_permute4x64_epi64(_mm256_packus_epi16(g[0], g[1]), 0xD8);
+        ch[2] = _mm256_permute4x64_epi64(_mm256_packus_epi16(b[0], b[1]), 0xD8);
+        ch[3] = conv->alpha ? alpha : zero;
+
+        lo = _mm256_unpacklo_epi8(ch[conv->order[0]], ch[conv->order[1]]);
+        hi = _mm256_unpacklo_epi8(ch[conv->order[2]], ch[conv->order[3]]);
+        p0 = _mm256_unpacklo_epi16(lo, hi);     /* pixels 0-3 and 16-19 */
+        p1 = _mm256_unpackhi_epi16(lo, hi);     /* 4-7 and 20-23 */
+        lo = _mm256_unpackhi_epi8(ch[conv->order[0]], ch[conv->order[1]]);
+        hi = _mm256_unpackhi_epi8(ch[conv->order[2]], ch[conv->order[3]]);
+        p2 = _mm256_unpacklo_epi16(lo, hi);     /* 8-11 and 24-27 */
+        p3 = _mm256_unpackhi_epi16(lo, hi);     /* 12-15 and 28-31 */
+        _mm256_storeu_si256((__m256i *) (dst + x + 0), _mm256_permute2x128_si256(p0, p1, 0x20));
+        _mm256_storeu_si256((__m256i *) (dst + x + 8), _mm256_permute2x128_si256(p2, p3, 0x20));
+        _mm256_storeu_si256((__m256i *) (dst + x + 16), _mm256_permute2x128_si256(p0, p1, 0x31));
+        _mm256_storeu_si256((__m256i *) (dst + x + 24), _mm256_permute2x128_si256(p2, p3, 0x31));
+    }
+    return x;
+}
+#endif /* HAVE_AVX2_INTRINSICS */
+
+#if HAVE_NEON_INTRINSICS
+/* One channel of 8 pixels, with the luma part already in 'ylo' and 'yhi' */
+static SDL_INLINE uint8x8_t
+SDL_YUVChannel_NEON(int32x4_t ylo, int32x4_t yhi, int16x8_t u, int16x8_t v, Sint16 cu, Sint16 cv)
+{
+    ylo = vmlal_n_s16(vmlal_n_s16(ylo, vget_low_s16(u), cu), vget_low_s16(v), cv);
+    yhi = vmlal_n_s16(vmlal_n_s16(yhi, vget_high_s16(u), cu), vget_high_s16(v), cv);
+    return vqmovun_s16(vcombine_s16(vqshrn_n_s32(ylo, YUV_SHIFT), vqshrn_n_s32(yhi, YUV_SHIFT)));
+}
+
+/* 16 pixels per iteration, returns how many pixels were converted */
+static int
+SDL_YUVRow_NEON(const SDL_YUVConverter * conv, const Uint8 * y, const Uint8 * u,
+                const Uint8 * v, Uint32 * dst, int width)
+{
+    const SDL_YUVMatrix *m = conv->matrix;
+    const int16x8_t y_offset = vdupq_n_s16((Sint16) m->y_offset);
+    const int16x8_t c_offset = vdupq_n_s16(128);
+    const int32x4_t round = vdupq_n_s32(YUV_ROUND);
+    const int y_step = conv->yuv.y_step;
+    const int c_step = conv->yuv.c_step;
+    int x;
+
+    for (x = 0; x + 16 <= width; x += 16) {
+        uint8x16_t Y;
+        uint8x8_t U, V;
+        uint8x16x4_t pixels;
+        uint8x8_t ch[4][2];
+        int i;
+
+        if (y_step == 1) {
+            Y = vld1q_u8(y + x);
+            if (c_step == 1) {
+                U = vld1_u8(u + x / 2);
+                V = vld1_u8(v + x / 2);
+            } else {
+                const uint8x8x2_t cc = vld2_u8(u < v ? u + x : v + x);
+                U = (u < v) ? cc.val[0] : cc.val[1];
+                V = (u < v) ? cc.val[1] : cc.val[0];
+            }
+        } else {
+            /* Both luma bytes of a pair, then the chroma ones */
+            const uint8x8x4_t pp = vld4_u8(SDL_min(y, SDL_min(u, v)) + x * 2);
+            const uint8x8x2_t yy = (y < u) ? vzip_u8(pp.val[0], pp.val[2]) : vzip_u8(pp.val[1], pp.val[3]);
+            const uint8x8_t first = (y < u) ? pp.val[1] : pp.val[0];
+            const uint8x8_t second = (y < u) ? pp.val[3] : pp.val[2];
+
+            Y = vcombine_u8(yy.val[0], yy.val[1]);
+            U = (u < v) ? first : second;
+            V = (u < v) ? second : first;
+        }
+
+        for (i = 0; i < 2; ++i) {
+            /* Each chroma value for two pixels */
+            const uint8x8x2_t uu = vzip_u8(U, U);
+            const uint8x8x2_t vv = vzip_u8(V, V);
+            const int16x8_t yi = vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(i ? vget_high_u8(Y) : vget_low_u8(Y))), y_offset);
+            const int16x8_t ui = vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(uu.val[i])), c_offset);
+            const int16x8_t vi = vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(vv.val[i])), c_offset);
+            const int32x4_t ylo = vmlal_n_s16(round, vget_low_s16(yi), m->y);
+            const int32x4_t yhi = vmlal_n_s16(round, vget_high_s16(yi), m->y);
+
+            ch[0][i] = SDL_YUVChannel_NEON(ylo, yhi, ui, vi, 0, m->rv);
+            ch[1][i] = SDL_YUVChannel_NEON(ylo, yhi, ui, vi, m->gu, m->gv);
+            ch[2][i] = SDL_YUVChannel_NEON(ylo, yhi, ui, vi, m->bu, 0);
+            ch[3][i] = vdup_n_u8(conv->alpha ? 0xFF : 0x00);
+        }
+        for (i = 0; i < 4; ++i) {
+            pixels.val[i] = vcombine_u8(ch[conv->order[i]][0], ch[conv->order[i]][1]);
+        }
+        vst4q_u8((uint8_t *) (dst + x), pixels);
+    }
+    return x;
+}
+#endif /* HAVE_NEON_INTRINSICS */
+
+static void
+SDL_YUVRow(const SDL_YUVConverter * conv, int row, int chroma_row)
+{
+    const Uint8 *y = conv->yuv.planes[0] + row * conv->yuv.pitches[0];
+    const Uint8 *u = conv->yuv.planes[1] + chroma_row * conv->yuv.pitches[1];
+    const Uint8 *v = conv->yuv.planes[2] + chroma_row * conv->yuv.pitches[2];
+    Uint32 *dst = (Uint32 *) (conv->dst + row * conv->dst_pitch);
+    int x = 0;
+
+#if HAVE_AVX2_INTRINSICS
+    if (SDL_HasAVX2()) {
+        x = SDL_YUVRow_AVX2(conv, y, u, v, dst, conv->width);
+    }
+#endif
+#if HAVE_SSE2_INTRINSICS
+    if (x == 0 && SDL_HasSSE2()) {
+        x = SDL_YUVRow_SSE2(conv, y, u, v, dst, conv->width);
+    }
+#endif
+#if HAVE_NEON_INTRINSICS
+    if (SDL_HasNEON()) {
+        x = SDL_YUVRow_NEON(conv, y, u, v, dst, conv->width);
+    }
+#endif
+    SDL_YUVRow_scalar(conv, y, u, v, dst, x, conv->width);
+}
+
+/* Rows of 4:2:0 images go in pairs sharing a chroma row */
+static int
+SDL_YUVRowsFunc(void *data, int first, int last)
+{
+    const SDL_YUVConverter *conv = (const SDL_YUVConverter *) data;
+    int i;
+
+    for (i = first; i < last; ++i) {
+        if (conv->yuv.chroma_420) {
+            SDL_YUVRow(conv, 2 * i, i);
+            if (2 * i + 1 < conv->height) {
+                SDL_YUVRow(conv, 2 * i + 1, i);
+            }
+        } else {
+            SDL_YUVRow(conv, i, i);
+        }
+    }
+    return 0;
+}
+
+/* Finds the planes of a YUV image in 'pixels', laid out the way
+   SDL_ConvertPixels() copies them */
+static int
+SDL_GetYUVLayout(Uint32 format, void *pixels, int pitch, int height, SDL_YUVLayout * yuv)
+{
+    Uint8 *plane = (Uint8 *) pixels;
+
+    switch (format) {
+    case SDL_PIXELFORMAT_YV12:
+    case SDL_PIXELFORMAT_IYUV:
+        {
+            const int chroma_pitch = (pitch + 1) / 2;
+            Uint8 *first = plane + pitch * height;
+            Uint8 *second = first + chroma_pitch * ((height + 1) / 2);
+
+            yuv->chroma_420 = SDL_TRUE;
+            yuv->planes[0] = plane;
+            yuv->planes[1] = (format == SDL_PIXELFORMAT_YV12) ? second : first;
+            yuv->planes[2] = (format == SDL_PIXELFORMAT_YV12) ? first : second;
+            yuv->pitches[0] = pitch;
+            yuv->pitches[1] = chroma_pitch;
+            yuv->pitches[2] = chroma_pitch;
+            yuv->y_step = 1;
+            yuv->c_step = 1;
+        }
+        break;
+    case SDL_PIXELFORMAT_NV12:
+    case SDL_PIXELFORMAT_NV21:
+        {
+            const int chroma_pitch = 2 * ((pitch + 1) / 2);
+            Uint8 *chroma = plane + pitch * height;
+
+            yuv->chroma_420 = SDL_TRUE;
+            yuv->planes[0] = plane;
+            yuv->planes[1] = (format == SDL_PIXELFORMAT_NV12) ? chroma : chroma + 1;
+            yuv->planes[2] = (format == SDL_PIXELFORMAT_NV12) ? chroma + 1 : chroma;
+            yuv->pitches[0] = pitch;
+            yuv->pitches[1] = chroma_pitch;
+            yuv->pitches[2] = chroma_pitch;
+            yuv->y_step = 1;
+            yuv->c_step = 2;
+        }
+        break;
+    case SDL_PIXELFORMAT_YUY2:     /* Y0 U0 Y1 V0 */
+    case SDL_PIXELFORMAT_UYVY:     /* U0 Y0 V0 Y1 */
+    case SDL_PIXELFORMAT_YVYU:     /* Y0 V0 Y1 U0 */
+        yuv->chroma_420 = SDL_FALSE;
+        yuv->planes[0] = plane + (format == SDL_PIXELFORMAT_UYVY ? 1 : 0);
+        yuv->planes[1] = plane + (format == SDL_PIXELFORMAT_YUY2 ? 1 :
+                                  format == SDL_PIXELFORMAT_UYVY ? 0 : 3);
+        yuv->planes[2] = plane + (format == SDL_PIXELFORMAT_YUY2 ? 3 :
+                                  format == SDL_PIXELFORMAT_UYVY ? 2 : 1);
+        yuv->pitches[0] = yuv->pitches[1] = yuv->pitches[2] = pitch;
+        yuv->y_step = 2;
+        yuv->c_step = 4;
+        break;
+    default:
+        return SDL_SetError("Unsupported YUV format");
+    }
+    return 0;
+}
+
+/* Finds the channels of a 32-bit format with 8-bit channels: the shifts of
+   R, G and B, and which of R, G, B or A (3) is in each byte of memory.
+   Unused bytes count as alpha. */
+static SDL_bool
+SDL_GetRGB8888Layout(Uint32 format, int shifts[3], int order[4], Uint32 * alpha)
+{
+    Uint32 masks[4];
+    int bpp, i;
+
+    if (SDL_ISPIXELFORMAT_FOURCC(format) || SDL_BYTESPERPIXEL(format) != 4 ||
+        !SDL_PixelFormatEnumToMasks(format, &bpp, &masks[0], &masks[1], &masks[2], &masks[3])) {
+        return SDL_FALSE;
+    }
+
+    for (i = 0; i < 4; ++i) {
+        order[i] = 3;
+    }
+    for (i = 0; i < 4; ++i) {
+        int shift;
+
+        if (i == 3 && !masks[3]) {
+            break;
+        }
+        for (shift = 0; shift < 32 && masks[i] != (0xFFu << shift); shift += 8) {
+        }
+        if (shift == 32) {
+            return SDL_FALSE;
+        }
+        if (i < 3) {
+            shifts[i] = shift;
+        }
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+        order[shift / 8] = i;
+#else
+        order[3 - shift / 8] = i;
+#endif
+    }
+    *alpha = masks[3];
+    return SDL_TRUE;
+}
+
+/* The index of the matrix to use in SDL_YUVMatrices and SDL_RGBMatrices */
+static int
+SDL_GetYUVMatrixIndex(int width, int height)
+{
+    switch (SDL_GetYUVConversionModeForResolution(width, height)) {
+    case SDL_YUV_CONVERSION_BT601:
+        return 1;
+    case SDL_YUV_CONVERSION_BT709:
+        return 2;
+    default:
+        return 0;
+    }
+}
+
+int
+SDL_ConvertPixels_YUV_to_RGB(int width, int height,
+                             Uint32 src_format, const void *src, int src_pitch,
+                             Uint32 dst_format, void *dst, int dst_pitch)
+{
+    SDL_YUVConverter conv;
+    int rows;
+
+    /* Unused bytes are written as 0, like alpha if there's no alpha */
+    if (!SDL_GetRGB8888Layout(dst_format, conv.shifts, conv.order, &conv.alpha)) {
+        /* Go through ARGB8888 */
+        int ret;
+        void *tmp = SDL_malloc(width * height * 4);
+        if (tmp == NULL) {
+            return SDL_OutOfMemory();
+        }
+        ret = SDL_ConvertPixels_YUV_to_RGB(width, height, src_format, src, src_pitch,
+                                           SDL_PIXELFORMAT_ARGB8888, tmp, width * 4);
+        if (ret == 0) {
+            ret = SDL_ConvertPixels(width, height, SDL_PIXELFORMAT_ARGB8888, tmp, width * 4,
+                                    dst_format, dst, dst_pitch);
+        }
+        SDL_free(tmp);
+        return ret;
+    }
+    if (SDL_GetYUVLayout(src_format, (void *) src, src_pitch, height, &conv.yuv) < 0) {
+        return -1;
+    }
+
+    conv.matrix = &SDL_YUVMatrices[SDL_GetYUVMatrixIndex(width, height)];
+    conv.width = width;
+    conv.height = height;
+    conv.dst = (Uint8 *) dst;
+    conv.dst_pitch = dst_pitch;
+
+    rows = conv.yuv.chroma_420 ? (height + 1) / 2 : height;
+    return SDL_RunBlitRows(SDL_YUVRowsFunc, &conv, rows, (Sint64) width * height);
+}
+
+/* RGB to YUV conversion.
+
+   Luma is computed with coefficients scaled by 2^14, and chroma from the
+   sum of the 2x2 (or 2x1 for packed formats, counted twice) pixels that
+   share it, so the averaging adds two bits of precision:
+
+     Y = (yr * R + yg * G + yb * B + (offset << 14) + (1 << 13)) >> 14
+     U = (ur * Rsum + ug * Gsum + ub * Bsum + (128 << 16) + (1 << 15)) >> 16
+
+   The sums of each chroma row are exact, so the results are the same for
+   the scalar and the SIMD versions. Pixels past the right and bottom edges
+   are taken to be copies of the last ones.
+*/
+
+#define RGB_SHIFT       14
+#define RGB_Y_ROUND     (1 << (RGB_SHIFT - 1))
+#define RGB_C_ADD       ((128 << (RGB_SHIFT + 2)) + (1 << (RGB_SHIFT + 1)))
+
+typedef struct
+{
+    int y_offset;
+    Sint16 y[3], u[3], v[3];        /* for R, G and B */
+} SDL_RGBMatrix;
+
+/* Indexed by SDL_YUV_CONVERSION_MODE */
+static const SDL_RGBMatrix SDL_RGBMatrices[] = {
+    {  0, { 4899,  9617,  1868 }, { -2765, -5427,  8192 }, { 8192, -6860, -1332 } },  /* JPEG */
+    { 16, { 4207,  8260,  1604 }, { -2428, -4768,  7196 }, { 7196, -6026, -1170 } },  /* BT.601 */
+    { 16, { 2991, 10064,  1016 }, { -1649, -5547,  7196 }, { 7196, -6536,  -660 } }   /* BT.709 */
+};
+
+typedef struct
+{
+    int width;
+    int height;
+    const Uint8 *src;
+    int src_pitch;
+
+    /* The coefficients for each byte of a source pixel in memory */
+    Sint16 y[4], u[4], v[4];
+    int y_add;
+
+    SDL_YUVLayout yuv;
+} SDL_YUVEncoder;
+
+static SDL_INLINE Uint8
+SDL_EncodeY(const SDL_YUVEncoder * enc, const Uint8 * p)
+{
+    return (Uint8) ((enc->y[0] * p[0] + enc->y[1] * p[1] + enc->y[2] * p[2] +
+                     enc->y[3] * p[3] + enc->y_add) >> RGB_SHIFT);
+}
+
+static SDL_INLINE Uint8
+SDL_EncodeChroma(const Sint16 coef[4], const int sums[4])
+{
+    const int value = (coef[0] * sums[0] + coef[1] * sums[1] + coef[2] * sums[2] +
+                       coef[3] * sums[3] + RGB_C_ADD) >> (RGB_SHIFT + 2);
+    return (Uint8) SDL_min(value, 255);
+}
+
+/* Pixels 'x' to 'width' of one or, if 'y1' is set, two rows sharing chroma */
+static void
+SDL_EncodeRow_scalar(const SDL_YUVEncoder * enc, const Uint8 * row0, const Uint8 * row1,
+                     Uint8 * y0, Uint8 * y1, Uint8 * u, Uint8 * v, int x, int width)
+{
+    const int y_step = enc->yuv.y_step;
+    const int c_step = enc->yuv.c_step;
+
+    for (; x < width; x += 2) {
+        const Uint8 *p0 = row0 + x * 4;
+        const Uint8 *p1 = row1 + x * 4;
+        const int next = (x + 1 < width) ? 4 : 0;
+        int sums[4], i;
+
+        y0[x * y_step] = SDL_EncodeY(enc, p0);
+        if (next || y_step == 2) {
+            /* Packed formats always have a pair of luma samples */
+            y0[(x + 1) * y_step] = SDL_EncodeY(enc, p0 + next);
+        }
+        if (y1) {
+            y1[x * y_step] = SDL_EncodeY(enc, p1);
+            if (next) {
+                y1[(x + 1) * y_step] = SDL_EncodeY(enc, p1 + next);
+            }
+        }
+        for (i = 0; i < 4; ++i) {
+            sums[i] = p0[i] + p0[next + i] + p1[i] + p1[next + i];
+        }
+        u[(x / 2) * c_step] = SDL_EncodeChroma(enc->u, sums);
+        v[(x / 2) * c_step] = SDL_EncodeChroma(enc->v, sums);
+    }
+}
+
+#if HAVE_SSE2_INTRINSICS
+/* Pairs of coefficients for bytes 0 and 2, or 1 and 3, of each pixel */
+#define RGB_COEF_PAIR_SSE2(coef, i) \
+    _mm_set1_epi32((int) (((Uint32) (Uint16) (coef)[(i) + 2] << 16) | (Uint16) (coef)[i]))
+
+/* 16 pixels of one or two rows per iteration; returns how many pixels were
+   converted */
+static int
+SDL_EncodeRow_SSE2(const SDL_YUVEncoder * enc, const Uint8 * row0, const Uint8 * row1,
+                   Uint8 * y0, Uint8 * y1, Uint8 * u, Uint8 * v, int width)
+{
+    const __m128i lo_bytes = _mm_set1_epi16(0x00FF);
+    const __m128i y_even = RGB_COEF_PAIR_SSE2(enc->y, 0);
+    const __m128i y_odd = RGB_COEF_PAIR_SSE2(enc->y, 1);
+    const __m128i u_even = RGB_COEF_PAIR_SSE2(enc->u, 0);
+    const __m128i u_odd = RGB_COEF_PAIR_SSE2(enc->u, 1);
+    const __m128i v_even = RGB_COEF_PAIR_SSE2(enc->v, 0);
+    const __m128i v_odd = RGB_COEF_PAIR_SSE2(enc->v, 1);
+    const __m128i y_add = _mm_set1_epi32(enc->y_add);
+    const __m128i c_add = _mm_set1_epi32(RGB_C_ADD);
+    const int y_step = enc->yuv.y_step;
+    const int c_step = enc->yuv.c_step;
+    int x;
+
+/* Bytes 0 and 2, and 1 and 3, of 4 pixels, as 16-bit values */
+#define RGB_LOAD_SSE2(even, odd, p) { \
+        const __m128i pixels = _mm_loadu_si128((const __m128i *) (p)); \
+        even = _mm_and_si128(pixels, lo_bytes); \
+        odd = _mm_srli_epi16(pixels, 8); \
+    }
+/* 4 32-bit results */
+#define RGB_DOT_SSE2(even, odd, k_even, k_odd, add, shift) \
+    _mm_srai_epi32(_mm_add_epi32(_mm_add_epi32(_mm_madd_epi16(even, k_even), \
+                                               _mm_madd_epi16(odd, k_odd)), add), shift)
+
+    for (x = 0; x + 16 <= width; x += 16) {
+        __m128i even0[4], odd0[4], even1[4], odd1[4], Y[2], U, V, C[2];
+        int i;
+
+        for (i = 0; i < 4; ++i) {
+            RGB_LOAD_SSE2(even0[i], odd0[i], row0 + (x + i * 4) * 4);
+            RGB_LOAD_SSE2(even1[i], odd1[i], row1 + (x + i * 4) * 4);
+        }
+
+        for (i = 0; i < 2; ++i) {
+            __m128i *even = i ? even1 : even0;
+            __m128i *odd = i ? odd1 : odd0;
+            if (i == 1 && !y1) {
+                break;
+            }
+            Y[i] = _mm_packus_epi16(
+                _mm_packs_epi32(RGB_DOT_SSE2(even[0], odd[0], y_even, y_odd, y_add, RGB_SHIFT),
+                                RGB_DOT_SSE2(even[1], odd[1], y_even, y_odd, y_add, RGB_SHIFT)),
+                _mm_packs_epi32(RGB_DOT_SSE2(even[2], odd[2], y_even, y_odd, y_add, RGB_SHIFT),
+                                RGB_DOT_SSE2(even[3], odd[3], y_even, y_odd, y_add, RGB_SHIFT)));
+        }
+
+        /* Add the rows, then the neighbouring pixels of each 8 */
+        for (i = 0; i < 2; ++i) {
+            const __m128i e0 = _mm_shuffle_epi32(_mm_add_epi16(even0[2 * i], even1[2 * i]), _MM_SHUFFLE(3, 1, 2, 0));
+            const __m128i e1 = _mm_shuffle_epi32(_mm_add_epi16(even0[2 * i + 1], even1[2 * i + 1]), _MM_SHUFFLE(3, 1, 2, 0));
+            const __m128i o0 = _mm_shuffle_epi32(_mm_add_epi16(odd0[2 * i], odd1[2 * i]), _MM_SHUFFLE(3, 1, 2, 0));
+            const __m128i o1 = _mm_shuffle_epi32(_mm_add_epi16(odd0[2 * i + 1], odd1[2 * i + 1]), _MM_SHUFFLE(3, 1, 2, 0));
+            const __m128i even = _mm_add_epi16(_mm_unpacklo_epi64(e0, e1), _mm_unpackhi_epi64(e0, e1));
+            const __m128i odd = _mm_add_epi16(_mm_unpacklo_epi64(o0, o1), _mm_unpackhi_epi64(o0, o1));
+
+            C[i] = _mm_packs_epi32(RGB_DOT_SSE2(even, odd, u_even, u_odd, c_add, RGB_SHIFT + 2),
+                                   RGB_DOT_SSE2(even, odd, v_even, v_odd, c_add, RGB_SHIFT + 2));
+        }
+        /* 8 U then 8 V */
+        U = _mm_packus_epi16(_mm_unpacklo_epi64(C[0], C[1]), _mm_unpacklo_epi64(C[0], C[1]));
+        V = _mm_packus_epi16(_mm_unpackhi_epi64(C[0], C[1]), _mm_unpackhi_epi64(C[0], C[1]));
+
+        if (y_step == 1) {
+            _mm_storeu_si128((__m128i *) (y0 + x), Y[0]);
+            if (y1) {
+                _mm_storeu_si128((__m128i *) (y1 + x), Y[1]);
+            }
+            if (c_step == 1) {
+                _mm_storel_epi64((__m128i *) (u + x / 2), U);
+                _mm_storel_epi64((__m128i *) (v + x / 2), V);
+            } else {
+                _mm_storeu_si128((__m128i *) (u < v ? u + x : v + x),
+                                 u < v ? _mm_unpacklo_epi8(U, V) : _mm_unpacklo_epi8(V, U));
+            }
+        } else {
+            Uint8 *p = SDL_min(y0, SDL_min(u, v)) + x * 2;
+            const __m128i chroma = (u < v) ? _mm_unpacklo_epi8(U, V) : _mm_unpacklo_epi8(V, U);
+
+            if (y0 < u) {
+                _mm_storeu_si128((__m128i *) p, _mm_unpacklo_epi8(Y[0], chroma));
+                _mm_storeu_si128((__m128i *) (p + 16), _mm_unpackhi_epi8(Y[0], chroma));
+            } else {
+                _mm_storeu_si128((__m128i *) p, _mm_unpacklo_epi8(chroma, Y[0]));
+                _mm_storeu_si128((__m128i *) (p + 16), _mm_unpackhi_epi8(chroma, Y[0]));
+            }
+        }
+    }
+#undef RGB_LOAD_SSE2
+#undef RGB_DOT_SSE2
+    return x;
+}
+#endif /* HAVE_SSE2_INTRINSICS */
+
+#if HAVE_NEON_INTRINSICS
+/* 16 luma samples from the deinterleaved bytes of 16 pixels */
+static SDL_INLINE uint8x16_t
+SDL_EncodeY_NEON(const SDL_YUVEncoder * enc, uint8x16x4_t pixels)
+{
+    int32x4_t acc[4];
+    int i, j;
+
+    for (j = 0; j < 4; ++j) {
+        acc[j] = vdupq_n_s32(enc->y_add);
+    }
+    for (i = 0; i < 4; ++i) {
+        const int16x8_t lo = vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(pixels.val[i])));
+        const int16x8_t hi = vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(pixels.val[i])));
+        acc[0] = vmlal_n_s16(acc[0], vget_low_s16(lo), enc->y[i]);
+        acc[1] = vmlal_n_s16(acc[1], vget_high_s16(lo), enc->y[i]);
+        acc[2] = vmlal_n_s16(acc[2], vget_low_s16(hi), enc->y[i]);
+        acc[3] = vmlal_n_s16(acc[3], vget_high_s16(hi), enc->y[i]);
+    }
+    return vcombine_u8(
+        vqmovn_u16(vcombine_u16(vqshrun_n_s32(acc[0], RGB_SHIFT), vqshrun_n_s32(acc[1], RGB_SHIFT))),
+        vqmovn_u16(vcombine_u16(vqshrun_n_s32(acc[2], RGB_SHIFT), vqshrun_n_s32(acc[3], RGB_SHIFT))));
+}
+
+/* 8 chroma samples from the sums of each byte of their pixels */
+static SDL_INLINE uint8x8_t
+SDL_EncodeChroma_NEON(const Sint16 coef[4], const uint16x8_t sums[4])
+{
+    int32x4_t lo = vdupq_n_s32(RGB_C_ADD);
+    int32x4_t hi = vdupq_n_s32(RGB_C_ADD);
+    int i;
+
+    for (i = 0; i < 4; ++i) {
+        const int16x8_t s = vreinterpretq_s16_u16(sums[i]);
+        lo = vmlal_n_s16(lo, vget_low_s16(s), coef[i]);
+        hi = vmlal_n_s16(hi, vget_high_s16(s), coef[i]);
+    }
+    return vqmovn_u16(vcombine_u16(vqshrun_n_s32(lo, RGB_SHIFT + 2), vqshrun_n_s32(hi, RGB_SHIFT + 2)));
+}
+
+/* 16 pixels of one or two rows per iteration; returns how many pixels were
+   converted */
+static int
+SDL_EncodeRow_NEON(const SDL_YUVEncoder * enc, const Uint8 * row0, const Uint8 * row1,
+                   Uint8 * y0, Uint8 * y1, Uint8 * u, Uint8 * v, int width)
+{
+    const int y_step = enc->yuv.y_step;
+    const int c_step = enc->yuv.c_step;
+    int x;
+
+    for (x = 0; x + 16 <= width; x += 16) {
+        const uint8x16x4_t p0 = vld4q_u8(row0 + x * 4);
+        const uint8x16x4_t p1 = vld4q_u8(row1 + x * 4);
+        const uint8x16_t Y = SDL_EncodeY_NEON(enc, p0);
+        uint16x8_t sums[4];
+        uint8x8_t U, V, first, second;
+        int i;
+
+        for (i = 0; i < 4; ++i) {
+            sums[i] = vpadalq_u8(vpaddlq_u8(p0.val[i]), p1.val[i]);
+        }
+        U = SDL_EncodeChroma_NEON(enc->u, sums);
+        V = SDL_EncodeChroma_NEON(enc->v, sums);
+        first = (u < v) ? U : V;
+        second = (u < v) ? V : U;
+
+        if (y_step == 1) {
+            vst1q_u8(y0 + x, Y);
+            if (y1) {
+                vst1q_u8(y1 + x, SDL_EncodeY_NEON(enc, p1));
+            }
+            if (c_step == 1) {
+                vst1_u8(u + x / 2, U);
+                vst1_u8(v + x / 2, V);
+            } else {
+                uint8x8x2_t chroma;
+                chroma.val[0] = first;
+                chroma.val[1] = second;
+                vst2_u8(SDL_min(u, v) + x, chroma);
+            }
+        } else {
+            const uint8x8x2_t luma = vuzp_u8(vget_low_u8(Y), vget_high_u8(Y));
+            uint8x8x4_t packed;
+
+            if (y0 < u) {
+                packed.val[0] = luma.val[0];
+                packed.val[1] = first;
+                packed.val[2] = luma.val[1];
+                packed.val[3] = second;
+            } else {
+                packed.val[0] = first;
+                packed.val[1] = luma.val[0];
+                packed.val[2] = second;
+                packed.val[3] = luma.val[1];
+            }
+            vst4_u8(SDL_min(y0, SDL_min(u, v)) + x * 2, packed);
+        }
+    }
+    return x;
+}
+#endif /* HAVE_NEON_INTRINSICS */
+
+/* Rows of 4:2:0 images go in pairs sharing a chroma row, and the last row
+   of an odd height counts twice */
+static int
+SDL_EncodeRowsFunc(void *data, int first, int last)
+{
+    const SDL_YUVEncoder *enc = (const SDL_YUVEncoder *) data;
+    const SDL_YUVLayout *yuv = &enc->yuv;
+    int i;
+
+    for (i = first; i < last; ++i) {
+        const int row = yuv->chroma_420 ? 2 * i : i;
+        const SDL_bool pair = (yuv->chroma_420 && row + 1 < enc->height);
+        const Uint8 *row0 = enc->src + row * enc->src_pitch;
+        const Uint8 *row1 = pair ? row0 + enc->src_pitch : row0;
+        Uint8 *y0 = yuv->planes[0] + row * yuv->pitches[0];
+        Uint8 *y1 = pair ? y0 + yuv->pitches[0] : NULL;
+        Uint8 *u = yuv->planes[1] + i * yuv->pitches[1];
+        Uint8 *v = yuv->planes[2] + i * yuv->pitches[2];
+        int x = 0;
+
+#if HAVE_SSE2_INTRINSICS
+        if (SDL_HasSSE2()) {
+            x = SDL_EncodeRow_SSE2(enc, row0, row1, y0, y1, u, v, enc->width);
+        }
+#endif
+#if HAVE_NEON_INTRINSICS
+        if (SDL_HasNEON()) {
+            x = SDL_EncodeRow_NEON(enc, row0, row1, y0, y1, u, v, enc->width);
+        }
+#endif
+        SDL_EncodeRow_scalar(enc, row0, row1, y0, y1, u, v, x, enc->width);
+    }
+    return 0;
+}
+
+int
+SDL_ConvertPixels_RGB_to_YUV(int width, int height,
+                             Uint32 src_format, const void *src, int src_pitch,
+                             Uint32 dst_format, void *dst, int dst_pitch)
+{
+    SDL_YUVEncoder enc;
+    const SDL_RGBMatrix *matrix;
+    int shifts[3], order[4];
+    Uint32 alpha;
+    int i, rows;
+
+    if (!SDL_GetRGB8888Layout(src_format, shifts, order, &alpha)) {
+        /* Go through ARGB8888 */
+        int ret;
+        void *tmp = SDL_malloc(width * height * 4);
+        if (tmp == NULL) {
+            return SDL_OutOfMemory();
+        }
+        ret = SDL_ConvertPixels(width, height, src_format, src, src_pitch,
+                                SDL_PIXELFORMAT_ARGB8888, tmp, width * 4);
+        if (ret == 0) {
+            ret = SDL_ConvertPixels_RGB_to_YUV(width, height, SDL_PIXELFORMAT_ARGB8888, tmp, width * 4,
+                                               dst_format, dst, dst_pitch);
+        }
+        SDL_free(tmp);
+        return ret;
+    }
+    if (SDL_GetYUVLayout(dst_format, dst, dst_pitch, height, &enc.yuv) < 0) {
+        return -1;
+    }
+
+    matrix = &SDL_RGBMatrices[SDL_GetYUVMatrixIndex(width, height)];
+    for (i = 0; i < 4; ++i) {
+        const int channel = order[i];
+        enc.y[i] = (channel < 3) ? matrix->y[channel] : 0;
+        enc.u[i] = (channel < 3) ? matrix->u[channel] : 0;
+        enc.v[i] = (channel < 3) ? matrix->v[channel] : 0;
+    }
+    enc.y_add = (matrix->y_offset << RGB_SHIFT) + RGB_Y_ROUND;
+    enc.width = width;
+    enc.height = height;
+    enc.src = (const Uint8 *) src;
+    enc.src_pitch = src_pitch;
+
+    rows = enc.yuv.chroma_420 ? (height + 1) / 2 : height;
+    return SDL_RunBlitRows(SDL_EncodeRowsFunc, &enc, rows, (Sint64) width * height);
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -85,6 +85,22 @@ my %set_rgba_string = (
     "BGRA8888" => "_pixel = ((Uint32)_B << 24) | ((Uint32)_G << 16) | ((Uint32)_R << 8) | _A;",
 );
 
+# The channel in each byte of the pixel, lowest byte first, X is unused
+my %format_bytes = (
+    "RGB888" => [ "B", "G", "R", "X" ],
+    "BGR888" => [ "R", "G", "B", "X" ],
+    "ARGB8888" => [ "B", "G", "R", "A" ],
+    "RGBA8888" => [ "A", "B", "G", "R" ],
+    "ABGR8888" => [ "R", "G", "B", "A" ],
+    "BGRA8888" => [ "A", "R", "G", "B" ],
+);
+
+# The vectorized variants of the blitters and the CPU feature they need
+my @simd_variants = (
+    [ "SSE2", "SDL_CPU_SSE2", "HAVE_SSE2_INTRINSICS" ],
+    [ "NEON", "SDL_CPU_NEON", "HAVE_NEON_INTRINSICS" ],
+);
+
 sub open_file {
     my $name = shift;
     open(FILE, ">$name.new") || die "Cant' open $name.new: $!";
@@ -149,6 +165,7 @@ sub output_copyfuncname
     my $scale = shift;
     my $args = shift;
     my $suffix = shift;
+    my $cpu = shift;
 
     print FILE "$prefix SDL_Blit_${src}_${dst}";
     if ( $modulate ) {
@@ -160,6 +177,9 @@ sub output_copyfuncname
     if ( $scale ) {
         print FILE "_Scale";
     }
+    if ( $cpu ) {
+        print FILE "_$cpu";
+    }
     if ( $args ) {
         print FILE "(SDL_BlitInfo *info)";
     }
@@ -296,21 +316,16 @@ __EOF__
     }
 }
 
-sub output_copyfunc
+sub output_copydecls
 {
     my $src = shift;
     my $dst = shift;
     my $modulate = shift;
     my $blend = shift;
-    my $scale = shift;
 
     my $dst_has_alpha = ($dst =~ /A/) ? 1 : 0;
     my $ignore_dst_alpha = !$dst_has_alpha && !$blend;
 
-    output_copyfuncname("static void", $src, $dst, $modulate, $blend, $scale, 1, "\n");
-    print FILE <<__EOF__;
-{
-__EOF__
     if ( $modulate || $blend ) {
         print FILE <<__EOF__;
     const int flags = info->flags;
@@ -357,6 +372,21 @@ __EOF__
 __EOF__
         }
     }
+}
+
+sub output_copyfunc
+{
+    my $src = shift;
+    my $dst = shift;
+    my $modulate = shift;
+    my $blend = shift;
+    my $scale = shift;
+
+    output_copyfuncname("static void", $src, $dst, $modulate, $blend, $scale, 1, "\n");
+    print FILE <<__EOF__;
+{
+__EOF__
+    output_copydecls($src, $dst, $modulate, $blend);
     if ( $scale ) {
         print FILE <<__EOF__;
     int srcy, srcx;
@@ -426,6 +456,241 @@ __EOF__
 __EOF__
 }
 
+sub get_byte_index
+{
+    my $format = shift;
+    my $channel = shift;
+
+    my @bytes = @{$format_bytes{$format}};
+    for (my $i = 0; $i <= $#bytes; ++$i) {
+        if ( $bytes[$i] eq $channel || ($channel eq "A" && $bytes[$i] eq "X") ) {
+            return $i;
+        }
+    }
+    die "No channel $channel in $format";
+}
+
+sub output_simdsetup
+{
+    my $src = shift;
+    my $dst = shift;
+    my $modulate = shift;
+
+    my $alpha = get_byte_index($dst, "A");
+    my $color = 0;
+    foreach my $channel ("R", "G", "B") {
+        $color |= 0xFF << (8 * get_byte_index($dst, $channel));
+    }
+
+    if ( $modulate ) {
+        my $rshift = 8 * get_byte_index($dst, "R");
+        my $gshift = 8 * get_byte_index($dst, "G");
+        my $bshift = 8 * get_byte_index($dst, "B");
+        my $ashift = 8 * $alpha;
+        printf FILE <<__EOF__, $color;
+    const Uint32 modulation =
+        ((flags & SDL_COPY_MODULATE_COLOR) ?
+            (((Uint32)info->r << $rshift) | ((Uint32)info->g << $gshift) | ((Uint32)info->b << $bshift)) : 0x%08X) |
+        ((flags & SDL_COPY_MODULATE_ALPHA) ? ((Uint32)info->a << $ashift) : (0xFFu << $ashift));
+__EOF__
+    }
+}
+
+sub output_simdtail
+{
+    my $src = shift;
+    my $dst = shift;
+    my $modulate = shift;
+    my $blend = shift;
+
+    print FILE <<__EOF__;
+        while (n--) {
+__EOF__
+    output_copycore($src, $dst, $modulate, $blend);
+    print FILE <<__EOF__;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+__EOF__
+}
+
+sub output_copyfunc_SSE2
+{
+    my $src = shift;
+    my $dst = shift;
+    my $modulate = shift;
+    my $blend = shift;
+
+    my $src_has_alpha = ($src =~ /A/) ? 1 : 0;
+    my $dst_has_alpha = ($dst =~ /A/) ? 1 : 0;
+    my $alpha = get_byte_index($dst, "A");
+    my $amask = sprintf("0x%08X", 0xFF << (8 * $alpha));
+    my $cmask = sprintf("0x%08X", ~(0xFF << (8 * $alpha)) & 0xFFFFFFFF);
+    my $smask = sprintf("0x%08X", 0xFF << (8 * get_byte_index($src, "A")));
+    my @perm = map { get_byte_index($src, $_ eq "X" ? "A" : $_) } @{$format_bytes{$dst}};
+    my $shuffle = "_MM_SHUFFLE($perm[3], $perm[2], $perm[1], $perm[0])";
+    my $identity = ($perm[0] == 0 && $perm[1] == 1 && $perm[2] == 2 && $perm[3] == 3);
+
+    output_copyfuncname("static void", $src, $dst, $modulate, $blend, 0, 1, "\n", "SSE2");
+    print FILE <<__EOF__;
+{
+__EOF__
+    output_copydecls($src, $dst, $modulate, $blend);
+    output_simdsetup($src, $dst, $modulate);
+    print FILE <<__EOF__;
+    const __m128i zero = _mm_setzero_si128();
+__EOF__
+    if ( $modulate ) {
+        print FILE <<__EOF__;
+    const __m128i vmodulation = _mm_unpacklo_epi8(_mm_set1_epi32((int)modulation), zero);
+__EOF__
+    }
+    if ( $blend ) {
+        print FILE <<__EOF__;
+    const __m128i amask = SSE2_LaneMask($amask);
+__EOF__
+    }
+    print FILE <<__EOF__;
+
+    while (info->dst_h--) {
+        $format_type{$src} *src = ($format_type{$src} *)info->src;
+        $format_type{$dst} *dst = ($format_type{$dst} *)info->dst;
+        int n = info->dst_w;
+        for (; n >= 4; n -= 4) {
+__EOF__
+    if ( !$src_has_alpha ) {
+        print FILE <<__EOF__;
+            const __m128i s = _mm_or_si128(_mm_loadu_si128((const __m128i *)src), _mm_set1_epi32((int)$smask));
+__EOF__
+    } else {
+        print FILE <<__EOF__;
+            const __m128i s = _mm_loadu_si128((const __m128i *)src);
+__EOF__
+    }
+    if ( $blend ) {
+        print FILE <<__EOF__;
+            const __m128i d = _mm_loadu_si128((const __m128i *)dst);
+__EOF__
+    }
+    if ( $identity ) {
+        print FILE <<__EOF__;
+            __m128i lo = _mm_unpacklo_epi8(s, zero);
+            __m128i hi = _mm_unpackhi_epi8(s, zero);
+
+__EOF__
+    } else {
+        print FILE <<__EOF__;
+            __m128i lo = SSE2_SHUFFLE_LANES(_mm_unpacklo_epi8(s, zero), $shuffle);
+            __m128i hi = SSE2_SHUFFLE_LANES(_mm_unpackhi_epi8(s, zero), $shuffle);
+
+__EOF__
+    }
+    if ( $modulate ) {
+        print FILE <<__EOF__;
+            lo = SSE2_Mul255(lo, vmodulation);
+            hi = SSE2_Mul255(hi, vmodulation);
+__EOF__
+    }
+    if ( $blend ) {
+        print FILE <<__EOF__;
+            lo = SSE2_Blend(lo, _mm_unpacklo_epi8(d, zero), SSE2_SHUFFLE_LANES(lo, _MM_SHUFFLE($alpha, $alpha, $alpha, $alpha)), amask, flags);
+            hi = SSE2_Blend(hi, _mm_unpackhi_epi8(d, zero), SSE2_SHUFFLE_LANES(hi, _MM_SHUFFLE($alpha, $alpha, $alpha, $alpha)), amask, flags);
+__EOF__
+    }
+    if ( !$dst_has_alpha ) {
+        print FILE <<__EOF__;
+            _mm_storeu_si128((__m128i *)dst, _mm_and_si128(_mm_packus_epi16(lo, hi), _mm_set1_epi32((int)$cmask)));
+__EOF__
+    } else {
+        print FILE <<__EOF__;
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+__EOF__
+    }
+    print FILE <<__EOF__;
+            src += 4;
+            dst += 4;
+        }
+__EOF__
+    output_simdtail($src, $dst, $modulate, $blend);
+}
+
+sub output_copyfunc_NEON
+{
+    my $src = shift;
+    my $dst = shift;
+    my $modulate = shift;
+    my $blend = shift;
+
+    my $src_has_alpha = ($src =~ /A/) ? 1 : 0;
+    my $dst_has_alpha = ($dst =~ /A/) ? 1 : 0;
+    my $alpha = get_byte_index($dst, "A");
+    my @perm = map { get_byte_index($src, $_ eq "X" ? "A" : $_) } @{$format_bytes{$dst}};
+
+    output_copyfuncname("static void", $src, $dst, $modulate, $blend, 0, 1, "\n", "NEON");
+    print FILE <<__EOF__;
+{
+__EOF__
+    output_copydecls($src, $dst, $modulate, $blend);
+    output_simdsetup($src, $dst, $modulate);
+    if ( $modulate ) {
+        print FILE <<__EOF__;
+    uint8x8x4_t vmodulation;
+    int i;
+
+    for (i = 0; i < 4; ++i) {
+        vmodulation.val[i] = vdup_n_u8((Uint8)(modulation >> (i * 8)));
+    }
+__EOF__
+    }
+    print FILE <<__EOF__;
+
+    while (info->dst_h--) {
+        $format_type{$src} *src = ($format_type{$src} *)info->src;
+        $format_type{$dst} *dst = ($format_type{$dst} *)info->dst;
+        int n = info->dst_w;
+        for (; n >= 8; n -= 8) {
+            const uint8x8x4_t s = vld4_u8((const uint8_t *)src);
+            uint8x8x4_t p;
+
+            p.val[0] = s.val[$perm[0]];
+            p.val[1] = s.val[$perm[1]];
+            p.val[2] = s.val[$perm[2]];
+            p.val[3] = s.val[$perm[3]];
+__EOF__
+    if ( !$src_has_alpha && ($blend || $dst_has_alpha) ) {
+        print FILE <<__EOF__;
+            p.val[$alpha] = vdup_n_u8(0xFF);
+__EOF__
+    }
+    if ( $modulate ) {
+        print FILE <<__EOF__;
+            p = NEON_Modulate(p, vmodulation);
+__EOF__
+    }
+    if ( $blend ) {
+        print FILE <<__EOF__;
+            p = NEON_Blend(p, vld4_u8((const uint8_t *)dst), $alpha, flags);
+__EOF__
+    }
+    if ( !$dst_has_alpha ) {
+        print FILE <<__EOF__;
+            p.val[$alpha] = vdup_n_u8(0);
+__EOF__
+    }
+    print FILE <<__EOF__;
+            vst4_u8((uint8_t *)dst, p);
+            src += 8;
+            dst += 8;
+        }
+__EOF__
+    output_simdtail($src, $dst, $modulate, $blend);
+}
+
 sub output_copyfunc_h
 {
 }
@@ -437,9 +702,149 @@ sub output_copyinc
 #include "SDL_blit.h"
 #include "SDL_blit_auto.h"
 
+#ifdef __SSE2__
+#define HAVE_SSE2_INTRINSICS 1
+#endif
+
+#if (defined(__ARM_NEON) || defined(__ARM_NEON__)) && SDL_BYTEORDER == SDL_LIL_ENDIAN
+#include <arm_neon.h>
+#define HAVE_NEON_INTRINSICS 1
+#endif
+
+/* The vectorized blitters move the source channels to the bytes they have in
+   the destination, with the source alpha in the alpha or unused byte, and
+   give exactly the same results as the per pixel versions. The products are
+   divided by 255 as (x + 1 + (x >> 8)) >> 8, which is exact up to 255 * 255.
+*/
+
+#if HAVE_SSE2_INTRINSICS
+#define SSE2_SHUFFLE_LANES(v, imm) _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, imm), imm)
+
+/* Set the 16-bit lanes of the bytes in 'mask' for two unpacked pixels */
+static SDL_INLINE __m128i
+SSE2_LaneMask(Uint32 mask)
+{
+    const __m128i m = _mm_set1_epi32((int)mask);
+    return _mm_unpacklo_epi8(m, m);
+}
+
+static SDL_INLINE __m128i
+SSE2_Mul255(__m128i x, __m128i y)
+{
+    const __m128i p = _mm_mullo_epi16(x, y);
+    return _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(p, _mm_srli_epi16(p, 8)), _mm_set1_epi16(1)), 8);
+}
+
+/* Blend two unpacked pixels, 'a' has the source alpha in all lanes of a pixel */
+static SDL_INLINE __m128i
+SSE2_Blend(__m128i s, __m128i d, __m128i a, __m128i amask, int flags)
+{
+    if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+        s = _mm_or_si128(_mm_and_si128(amask, s), _mm_andnot_si128(amask, SSE2_Mul255(s, a)));
+    }
+    switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        return _mm_add_epi16(s, SSE2_Mul255(_mm_sub_epi16(_mm_set1_epi16(255), a), d));
+    case SDL_COPY_ADD:
+        /* Saturated when packing */
+        return _mm_or_si128(_mm_and_si128(amask, d), _mm_andnot_si128(amask, _mm_add_epi16(s, d)));
+    case SDL_COPY_MOD:
+        return _mm_or_si128(_mm_and_si128(amask, d), _mm_andnot_si128(amask, SSE2_Mul255(s, d)));
+    default:
+        return d;
+    }
+}
+#endif /* HAVE_SSE2_INTRINSICS */
+
+#if HAVE_NEON_INTRINSICS
+static SDL_INLINE uint8x8_t
+NEON_Mul255(uint8x8_t x, uint8x8_t y)
+{
+    const uint16x8_t p = vmull_u8(x, y);
+    return vshrn_n_u16(vaddq_u16(vaddq_u16(p, vshrq_n_u16(p, 8)), vdupq_n_u16(1)), 8);
+}
+
+static SDL_INLINE uint8x8x4_t
+NEON_Modulate(uint8x8x4_t s, uint8x8x4_t modulation)
+{
+    int i;
+
+    for (i = 0; i < 4; ++i) {
+        s.val[i] = NEON_Mul255(s.val[i], modulation.val[i]);
+    }
+    return s;
+}
+
+/* Blend eight deinterleaved pixels, 'alpha' is the index of the alpha bytes */
+static SDL_INLINE uint8x8x4_t
+NEON_Blend(uint8x8x4_t s, uint8x8x4_t d, int alpha, int flags)
+{
+    const uint8x8_t a = s.val[alpha];
+    int i;
+
+    if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+        for (i = 0; i < 4; ++i) {
+            if (i != alpha) {
+                s.val[i] = NEON_Mul255(s.val[i], a);
+            }
+        }
+    }
+    switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        for (i = 0; i < 4; ++i) {
+            d.val[i] = vadd_u8(s.val[i], NEON_Mul255(vmvn_u8(a), d.val[i]));
+        }
+        break;
+    case SDL_COPY_ADD:
+        for (i = 0; i < 4; ++i) {
+            if (i != alpha) {
+                d.val[i] = vqadd_u8(s.val[i], d.val[i]);
+            }
+        }
+        break;
+    case SDL_COPY_MOD:
+        for (i = 0; i < 4; ++i) {
+            if (i != alpha) {
+                d.val[i] = NEON_Mul255(s.val[i], d.val[i]);
+            }
+        }
+        break;
+    }
+    return d;
+}
+#endif /* HAVE_NEON_INTRINSICS */
+
 __EOF__
 }
 
+# The vectorized blitters come first so they are picked over the others
+sub output_simdentries
+{
+    my $src = shift;
+    my $dst = shift;
+
+    foreach my $variant (@simd_variants) {
+        my ($cpu, $feature, $define) = @$variant;
+        print FILE "#if $define\n";
+        for (my $modulate = 0; $modulate <= 1; ++$modulate) {
+            for (my $blend = 0; $blend <= 1; ++$blend) {
+                if ( $modulate || $blend ) {
+                    my @flags = ();
+                    if ( $modulate ) {
+                        push(@flags, "SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA");
+                    }
+                    if ( $blend ) {
+                        push(@flags, "SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD");
+                    }
+                    print FILE "    { SDL_PIXELFORMAT_$src, SDL_PIXELFORMAT_$dst, (" . join(" | ", @flags) . "), $feature,";
+                    output_copyfuncname("", $src, $dst, $modulate, $blend, 0, 0, " },\n", $cpu);
+                }
+            }
+        }
+        print FILE "#endif\n";
+    }
+}
+
 sub output_copyfunctable
 {
     print FILE <<__EOF__;
@@ -449,6 +854,7 @@ __EOF__
         my $src = $src_formats[$i];
         for (my $j = 0; $j <= $#dst_formats; ++$j) {
             my $dst = $dst_formats[$j];
+            output_simdentries($src, $dst);
             for (my $modulate = 0; $modulate <= 1; ++$modulate) {
                 for (my $blend = 0; $blend <= 1; ++$blend) {
                     for (my $scale = 0; $scale <= 1; ++$scale) {
@@ -512,6 +918,23 @@ sub output_copyfunc_c
             }
         }
     }
+
+    foreach my $variant (@simd_variants) {
+        my ($cpu, $feature, $define) = @$variant;
+        print FILE "#if $define\n";
+        for (my $modulate = 0; $modulate <= 1; ++$modulate) {
+            for (my $blend = 0; $blend <= 1; ++$blend) {
+                if ( $modulate || $blend ) {
+                    if ( $cpu eq "SSE2" ) {
+                        output_copyfunc_SSE2($src, $dst, $modulate, $blend);
+                    } else {
+                        output_copyfunc_NEON($src, $dst, $modulate, $blend);
+                    }
+                }
+            }
+        }
+        print FILE "#endif /* $define */\n\n";
+    }
 }
 
 open_file("SDL_blit_auto.h");
@@ -10,14 +10,23 @@ best with 32-bit screen mode.
 Some blend modes may not be supported for all renderers. These tests
 will give failure.
 
-TODO:
-- command line arguments for things like window size, iterations...
+Every test can be repeated to get the median and variance of its speed.
+The results can be written as JSON or CSV, and compared against a CSV
+file saved from an earlier run. The exit code is 1 when a test got
+slower than the baseline by more than the tolerance, which makes it
+usable for automated runs. --headless uses the dummy video driver with
+the software renderer, so no display is needed.
+
+Run with --help for the options. For compatibility the renderer name,
+iterations and sleep can also be given as plain arguments, in that order.
 
 */
 
+#include <stdio.h>
+
 #include "SDL2/SDL.h"
 
-#define BENCHMARK_VERSION "0.5"
+#define BENCHMARK_VERSION "0.6"
 
 #define WIDTH 800
 #define HEIGHT 600
@@ -26,13 +35,35 @@ TODO:
 
 #define ITERATIONS 100
 #define OBJECTS 100
+#define REPEAT 1
 
 #define SLEEP 0
 
+/* Allowed slowdown against the baseline, in percent */
+#define TOLERANCE 10.0
+
 #ifdef __amigaos4__
 static const char stackCookie[] __attribute__((used)) = "$STACK:60000";
 #endif
 
+typedef enum {
+    FORMAT_TEXT,
+    FORMAT_JSON,
+    FORMAT_CSV
+} OutputFormat;
+
+typedef struct {
+    const char *renderer;
+    const char *test;
+    const char *mode;
+    SDL_bool ok;
+    Uint32 samples;
+    double median;
+    double mean;
+    double variance;
+    double fps;
+} Result;
+
 typedef struct {
     SDL_Renderer *renderer;
     SDL_Window *window;
@@ -53,6 +84,20 @@ typedef struct {
     Uint32 *buffer;
     SDL_bool running;
     const char* rendname;
+    const char *currentrenderer;
+    Uint32 repeat;
+    SDL_bool fullscreen;
+    SDL_bool headless;
+    const char *imagename;
+    const char *testname;
+    const char *modename;
+    OutputFormat format;
+    const char *outputname;
+    const char *baselinename;
+    double tolerance;
+    Result *results;
+    int numresults;
+    int maxresults;
 } Context;
 
 typedef struct {
@@ -125,6 +170,7 @@ static void printInfo(Context *ctx)
     } else {
 
         SDL_Log("Starting to test renderer called [%s], flags 0x%X\n", ri.name, ri.flags);
+        ctx->currentrenderer = ri.name;
     }
 }
 
@@ -269,11 +315,10 @@ static void afterTest(Context *ctx)
     }
 }
 
-static SDL_bool runTest(Context *ctx, Test *test)
+static SDL_bool runSample(Context *ctx, Test *test, double *fps, double *ops)
 {
     Uint64 start, finish;
     double duration;
-    float fps, ops;
 
     if (!prepareTest(ctx, test)) {
         return SDL_FALSE;
@@ -296,15 +341,15 @@ static SDL_bool runTest(Context *ctx, Test *test)
         return SDL_FALSE;
     }
 
-    fps = ctx->frames / duration;
-    ops = ctx->operations / duration;
+    *fps = ctx->frames / duration;
+    *ops = ctx->operations / duration;
 
-    if (fps == ops) {
+    if (*fps == *ops) {
         SDL_Log("%s [mode: %s]...%d frames drawn in %.3f seconds => %.1f frames per second\n",
-            test->name, getModeName(ctx->mode), ctx->frames, duration, fps);
+            test->name, getModeName(ctx->mode), ctx->frames, duration, *fps);
     } else {
         SDL_Log("%s [mode: %s]...%d frames drawn in %.3f seconds => %.1f frames per second, %.1f operations per second\n",
-            test->name, getModeName(ctx->mode), ctx->frames, duration, fps, ops);
+            test->name, getModeName(ctx->mode), ctx->frames, duration, *fps, *ops);
     }
 
     afterTest(ctx);
@@ -312,6 +357,128 @@ static SDL_bool runTest(Context *ctx, Test *test)
     return SDL_TRUE;
 }
 
+static int compareDoubles(const void *a, const void *b)
+{
+    const double x = *(const double *)a;
+    const double y = *(const double *)b;
+
+    return (x > y) - (x < y);
+}
+
+/* Sorts the values */
+static double getMedian(double *values, Uint32 count)
+{
+    SDL_qsort(values, count, sizeof(double), compareDoubles);
+
+    if (count % 2) {
+        return values[count / 2];
+    }
+
+    return (values[count / 2 - 1] + values[count / 2]) / 2.0;
+}
+
+static double getMean(const double *values, Uint32 count)
+{
+    double sum = 0.0;
+    Uint32 i;
+
+    for (i = 0; i < count; i++) {
+        sum += values[i];
+    }
+
+    return sum / count;
+}
+
+/* Sample variance, zero for a single sample */
+static double getVariance(const double *values, Uint32 count, double mean)
+{
+    double sum = 0.0;
+    Uint32 i;
+
+    if (count < 2) {
+        return 0.0;
+    }
+
+    for (i = 0; i < count; i++) {
+        sum += (values[i] - mean) * (values[i] - mean);
+    }
+
+    return sum / (count - 1);
+}
+
+static Result *addResult(Context *ctx, Test *test)
+{
+    Result *result;
+
+    if (ctx->numresults == ctx->maxresults) {
+        int maxresults = ctx->maxresults ? ctx->maxresults * 2 : 64;
+        Result *results = SDL_realloc(ctx->results, maxresults * sizeof(Result));
+
+        if (!results) {
+            SDL_Log("[%s]Failed to allocate results\n", __FUNCTION__);
+            return NULL;
+        }
+
+        ctx->results = results;
+        ctx->maxresults = maxresults;
+    }
+
+    result = &ctx->results[ctx->numresults++];
+    SDL_memset(result, 0, sizeof(*result));
+    result->renderer = ctx->currentrenderer ? ctx->currentrenderer : "unknown";
+    result->test = test->name;
+    result->mode = getModeName(ctx->mode);
+
+    return result;
+}
+
+static SDL_bool runTest(Context *ctx, Test *test)
+{
+    double *fps, *ops;
+    Result *result;
+    Uint32 samples;
+
+    fps = SDL_malloc(ctx->repeat * sizeof(double));
+    ops = SDL_malloc(ctx->repeat * sizeof(double));
+
+    if (!fps || !ops) {
+        SDL_Log("[%s]Failed to allocate samples\n", __FUNCTION__);
+        SDL_free(fps);
+        SDL_free(ops);
+        return SDL_FALSE;
+    }
+
+    for (samples = 0; samples < ctx->repeat; samples++) {
+        if (!runSample(ctx, test, &fps[samples], &ops[samples])) {
+            break;
+        }
+    }
+
+    result = addResult(ctx, test);
+
+    if (result) {
+        result->ok = (samples == ctx->repeat);
+        result->samples = samples;
+
+        if (result->ok) {
+            result->mean = getMean(ops, samples);
+            result->variance = getVariance(ops, samples, result->mean);
+            result->median = getMedian(ops, samples);
+            result->fps = getMedian(fps, samples);
+
+            if (ctx->repeat > 1) {
+                SDL_Log("%s [mode: %s]...median %.1f operations per second, mean %.1f, variance %.1f over %d runs\n",
+                    test->name, result->mode, result->median, result->mean, result->variance, samples);
+            }
+        }
+    }
+
+    SDL_free(fps);
+    SDL_free(ops);
+
+    return (result && result->ok);
+}
+
 static SDL_bool setRandomColor(Context *ctx)
 {
     int result;
@@ -629,7 +796,15 @@ static void runTestSuite(Context *ctx)
     int m, t;
 
     for (t = 0; t < sizeof(tests) / sizeof(tests[0]); t++) {
+        if (ctx->testname && SDL_strcasecmp(ctx->testname, tests[t].name) != 0) {
+            continue;
+        }
+
         for (m = 0; m < sizeof(modes) / sizeof(modes[0]); m++) {
+            if (ctx->modename && SDL_strcasecmp(ctx->modename, modes[m].name) != 0) {
+                continue;
+            }
+
             ctx->mode = modes[m].mode;
             
             runTest(ctx, &tests[t]);
@@ -643,40 +818,307 @@ static void runTestSuite(Context *ctx)
     }
 }
 
-/* TODO: need proper handling */
-static void checkParameters(Context *ctx, int argc, char **argv)
+static void printUsage(const char *name)
 {
-    if (argc > 3) {
-        ctx->sleep = atoi(argv[3]);
-    }
+    SDL_Log("Usage: %s [--width N] [--height N] [--iterations N] [--objects N] [--repeat N]\n", name);
+    SDL_Log("    [--sleep MS] [--renderer NAME] [--test NAME] [--mode none|blend|add|mod]\n");
+    SDL_Log("    [--image FILE.bmp] [--windowed] [--headless] [--format text|json|csv]\n");
+    SDL_Log("    [--output FILE] [--baseline FILE.csv] [--tolerance PERCENT]\n");
+}
+
+static SDL_bool isPositive(const char *value)
+{
+    return value && SDL_atoi(value) > 0;
+}
 
-    if (argc > 2) {
-        ctx->iterations = atoi(argv[2]);
+static SDL_bool checkParameters(Context *ctx, int argc, char **argv)
+{
+    int i;
+    int positional = 0;
+
+    for (i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        const char *value = (i + 1 < argc) ? argv[i + 1] : NULL;
+        int consumed = 2;
+
+        if (SDL_strcasecmp(arg, "--width") == 0 && isPositive(value)) {
+            ctx->width = SDL_atoi(value);
+        } else if (SDL_strcasecmp(arg, "--height") == 0 && isPositive(value)) {
+            ctx->height = SDL_atoi(value);
+        } else if (SDL_strcasecmp(arg, "--iterations") == 0 && isPositive(value)) {
+            ctx->iterations = SDL_atoi(value);
+        } else if (SDL_strcasecmp(arg, "--objects") == 0 && isPositive(value)) {
+            ctx->objects = SDL_atoi(value);
+        } else if (SDL_strcasecmp(arg, "--repeat") == 0 && isPositive(value)) {
+            ctx->repeat = SDL_atoi(value);
+        } else if (SDL_strcasecmp(arg, "--sleep") == 0 && value) {
+            ctx->sleep = SDL_atoi(value);
+        } else if (SDL_strcasecmp(arg, "--renderer") == 0 && value) {
+            ctx->rendname = value;
+        } else if (SDL_strcasecmp(arg, "--test") == 0 && value) {
+            ctx->testname = value;
+        } else if (SDL_strcasecmp(arg, "--mode") == 0 && value) {
+            ctx->modename = value;
+        } else if (SDL_strcasecmp(arg, "--image") == 0 && value) {
+            ctx->imagename = value;
+        } else if (SDL_strcasecmp(arg, "--output") == 0 && value) {
+            ctx->outputname = value;
+        } else if (SDL_strcasecmp(arg, "--baseline") == 0 && value) {
+            ctx->baselinename = value;
+        } else if (SDL_strcasecmp(arg, "--tolerance") == 0 && value) {
+            ctx->tolerance = SDL_atof(value);
+        } else if (SDL_strcasecmp(arg, "--format") == 0 && value) {
+            if (SDL_strcasecmp(value, "text") == 0) {
+                ctx->format = FORMAT_TEXT;
+            } else if (SDL_strcasecmp(value, "json") == 0) {
+                ctx->format = FORMAT_JSON;
+            } else if (SDL_strcasecmp(value, "csv") == 0) {
+                ctx->format = FORMAT_CSV;
+            } else {
+                consumed = 0;
+            }
+        } else if (SDL_strcasecmp(arg, "--windowed") == 0) {
+            ctx->fullscreen = SDL_FALSE;
+            consumed = 1;
+        } else if (SDL_strcasecmp(arg, "--headless") == 0) {
+            ctx->headless = SDL_TRUE;
+            ctx->fullscreen = SDL_FALSE;
+            consumed = 1;
+        } else if (arg[0] != '-') {
+            /* Old style arguments: renderer name, iterations and sleep */
+            switch (positional++) {
+            case 0:
+                ctx->rendname = arg;
+                break;
+            case 1:
+                ctx->iterations = atoi(arg);
+                break;
+            case 2:
+                ctx->sleep = atoi(arg);
+                break;
+            default:
+                consumed = 0;
+                break;
+            }
+            if (consumed) {
+                consumed = 1;
+            }
+        } else {
+            consumed = 0;
+        }
+
+        if (consumed == 0) {
+            printUsage(argv[0]);
+            return SDL_FALSE;
+        }
+
+        i += consumed - 1;
     }
 
-    if (argc > 1) {
-        ctx->rendname = argv[1];
+    if (ctx->headless && !ctx->rendname) {
+        ctx->rendname = "software";
     }
+
+    return SDL_TRUE;
 }
 
-static void initContext(Context *ctx, int argc, char **argv)
+static SDL_bool initContext(Context *ctx, int argc, char **argv)
 {
     SDL_memset(ctx, 0, sizeof(*ctx));
 
-    ctx->frequency = SDL_GetPerformanceFrequency();
-
     ctx->width = WIDTH;
     ctx->height = HEIGHT;
     ctx->rectsize = RECTSIZE;
     ctx->iterations = ITERATIONS;
     ctx->objects = OBJECTS;
+    ctx->repeat = REPEAT;
     ctx->sleep = SLEEP;
+    ctx->tolerance = TOLERANCE;
+    ctx->fullscreen = SDL_TRUE;
+    ctx->imagename = "sample.bmp";
     ctx->running = SDL_TRUE;
 
-    checkParameters(ctx, argc, argv);
+    if (!checkParameters(ctx, argc, argv)) {
+        return SDL_FALSE;
+    }
 
-    SDL_Log("Parameters: width %d, height %d, renderer name '%s', iterations %d, objects %d, sleep %d\n",
-        ctx->width, ctx->height, ctx->rendname, ctx->iterations, ctx->objects, ctx->sleep);
+    SDL_Log("Parameters: width %d, height %d, renderer name '%s', iterations %d, objects %d, repeat %d, sleep %d\n",
+        ctx->width, ctx->height, ctx->rendname, ctx->iterations, ctx->objects, ctx->repeat, ctx->sleep);
+
+    return SDL_TRUE;
+}
+
+static void writeResults(Context *ctx, FILE *file)
+{
+    SDL_version linked;
+    int i;
+
+    SDL_GetVersion(&linked);
+
+    if (ctx->format == FORMAT_JSON) {
+        fprintf(file, "{\n");
+        fprintf(file, "  \"version\": \"%s\",\n", BENCHMARK_VERSION);
+        fprintf(file, "  \"sdl\": \"%d.%d.%d\",\n", linked.major, linked.minor, linked.patch);
+        fprintf(file, "  \"width\": %d,\n  \"height\": %d,\n", ctx->width, ctx->height);
+        fprintf(file, "  \"iterations\": %d,\n  \"objects\": %d,\n  \"repeat\": %d,\n",
+            ctx->iterations, ctx->objects, ctx->repeat);
+        fprintf(file, "  \"results\": [");
+
+        for (i = 0; i < ctx->numresults; i++) {
+            const Result *r = &ctx->results[i];
+
+            fprintf(file, "%s\n    { \"renderer\": \"%s\", \"test\": \"%s\", \"mode\": \"%s\", \"ok\": %s, \"samples\": %d, "
+                "\"ops_median\": %.3f, \"ops_mean\": %.3f, \"ops_variance\": %.3f, \"fps_median\": %.3f }",
+                i ? "," : "", r->renderer, r->test, r->mode, r->ok ? "true" : "false", r->samples,
+                r->median, r->mean, r->variance, r->fps);
+        }
+
+        fprintf(file, "\n  ]\n}\n");
+    } else if (ctx->format == FORMAT_CSV) {
+        fprintf(file, "renderer,test,mode,ok,samples,ops_median,ops_mean,ops_variance,fps_median\n");
+
+        for (i = 0; i < ctx->numresults; i++) {
+            const Result *r = &ctx->results[i];
+
+            fprintf(file, "%s,%s,%s,%d,%d,%.3f,%.3f,%.3f,%.3f\n",
+                r->renderer, r->test, r->mode, r->ok ? 1 : 0, r->samples,
+                r->median, r->mean, r->variance, r->fps);
+        }
+    }
+}
+
+static SDL_bool writeOutput(Context *ctx)
+{
+    FILE *file = stdout;
+
+    if (ctx->format == FORMAT_TEXT) {
+        return SDL_TRUE;
+    }
+
+    if (ctx->outputname) {
+        file = fopen(ctx->outputname, "w");
+
+        if (!file) {
+            SDL_Log("Failed to open '%s' for writing\n", ctx->outputname);
+            return SDL_FALSE;
+        }
+    }
+
+    writeResults(ctx, file);
+
+    if (file != stdout) {
+        fclose(file);
+    }
+
+    return SDL_TRUE;
+}
+
+static char *loadFile(const char *name)
+{
+    SDL_RWops *rw = SDL_RWFromFile(name, "rb");
+    Sint64 size;
+    char *data;
+
+    if (!rw) {
+        return NULL;
+    }
+
+    size = SDL_RWsize(rw);
+    data = (size >= 0) ? SDL_malloc((size_t)size + 1) : NULL;
+
+    if (data) {
+        if (SDL_RWread(rw, data, 1, (size_t)size) != (size_t)size) {
+            SDL_free(data);
+            data = NULL;
+        } else {
+            data[size] = '\0';
+        }
+    }
+
+    SDL_RWclose(rw);
+
+    return data;
+}
+
+/* Splits a CSV line in place, returns the number of fields */
+static int splitLine(char *line, char **fields, int maxfields)
+{
+    int count = 0;
+
+    while (count < maxfields) {
+        char *comma = SDL_strchr(line, ',');
+
+        fields[count++] = line;
+
+        if (!comma) {
+            break;
+        }
+
+        *comma = '\0';
+        line = comma + 1;
+    }
+
+    return count;
+}
+
+/* Returns the number of tests that got slower than the baseline, or -1 on error */
+static int compareBaseline(Context *ctx)
+{
+    char *data, *line, *next;
+    int regressions = 0;
+    int compared = 0;
+
+    data = loadFile(ctx->baselinename);
+
+    if (!data) {
+        SDL_Log("Failed to load baseline '%s': %s\n", ctx->baselinename, SDL_GetError());
+        return -1;
+    }
+
+    for (line = data; line && *line; line = next) {
+        char *fields[9];
+        double baseline;
+        int i;
+
+        next = SDL_strchr(line, '\n');
+
+        if (next) {
+            *next++ = '\0';
+        }
+
+        if (line[0] && line[SDL_strlen(line) - 1] == '\r') {
+            line[SDL_strlen(line) - 1] = '\0';
+        }
+
+        if (splitLine(line, fields, 9) != 9 || SDL_strcmp(fields[0], "renderer") == 0 || SDL_atoi(fields[3]) == 0) {
+            continue;
+        }
+
+        baseline = SDL_atof(fields[5]);
+
+        for (i = 0; i < ctx->numresults; i++) {
+            const Result *r = &ctx->results[i];
+
+            if (!r->ok || SDL_strcmp(r->renderer, fields[0]) || SDL_strcmp(r->test, fields[1]) || SDL_strcmp(r->mode, fields[2])) {
+                continue;
+            }
+
+            compared++;
+
+            if (r->median < baseline * (1.0 - ctx->tolerance / 100.0)) {
+                SDL_Log("REGRESSION: %s %s [mode: %s]...%.1f operations per second, baseline %.1f (%+.1f%%)\n",
+                    r->renderer, r->test, r->mode, r->median, baseline, (r->median / baseline - 1.0) * 100.0);
+                regressions++;
+            }
+        }
+    }
+
+    SDL_free(data);
+
+    SDL_Log("Compared %d results against baseline '%s' with %.1f%% tolerance: %d regressions\n",
+        compared, ctx->baselinename, ctx->tolerance, regressions);
+
+    return regressions;
 }
 
 static void checkPixelFormat(Context *ctx)
@@ -734,23 +1176,32 @@ int main(int argc, char **argv)
 {
     Context ctx;
     SDL_version linked;
+    int status = 0;
+
+    if (!initContext(&ctx, argc, argv)) {
+        return 2;
+    }
+
+    if (ctx.headless) {
+        SDL_setenv("SDL_VIDEODRIVER", "dummy", 1);
+    }
 
     if (SDL_Init(SDL_INIT_VIDEO)) {
         SDL_Log("Init failed: %s\n", SDL_GetError());
         return -1;
     }
 
+    ctx.frequency = SDL_GetPerformanceFrequency();
+
     SDL_GetVersion(&linked);
 
     SDL_Log("SDL2 renderer benchmark v. " BENCHMARK_VERSION " (SDL version %d.%d.%d)\n",
         linked.major, linked.minor, linked.patch);
 
     SDL_Log("This tool measures the speed of various 2D drawing features\n");
-    SDL_Log("Press any key to quit\n");
-
-    initContext(&ctx, argc, argv);
+    SDL_Log("Press ESC to quit\n");
 
-    ctx.surface = SDL_LoadBMP("sample.bmp");
+    ctx.surface = SDL_LoadBMP(ctx.imagename);
     
     if (ctx.surface) {
 
@@ -762,7 +1213,7 @@ int main(int argc, char **argv)
             SDL_WINDOWPOS_CENTERED,
             ctx.width,
             ctx.height,
-            SDL_WINDOW_FULLSCREEN);
+            ctx.fullscreen ? SDL_WINDOW_FULLSCREEN : 0);
 
         if (ctx.window) {
 
@@ -777,17 +1228,33 @@ int main(int argc, char **argv)
             SDL_DestroyWindow(ctx.window);
         } else {
             SDL_Log("Failed to create window: %s\n", SDL_GetError());
+            status = -1;
         }
 
         SDL_FreeSurface(ctx.surface);
 
     } else {
         SDL_Log("Failed do load image: %s\n", SDL_GetError());
+        status = -1;
     }
 
+    if (status == 0) {
+        if (!writeOutput(&ctx)) {
+            status = -1;
+        } else if (ctx.baselinename) {
+            int regressions = compareBaseline(&ctx);
+
+            if (regressions != 0) {
+                status = (regressions < 0) ? -1 : 1;
+            }
+        }
+    }
+
+    SDL_free(ctx.results);
+
     SDL_Log("Bye bye\n");
 
     SDL_Quit();
 
-    return 0;
+    return status;
 }
@@ -968,6 +968,626 @@ int audio_openCloseAudioDeviceConnected()
 }
 
 
+/**
+ * \brief Resamples a sine wave through SDL_ConvertAudio and an SDL_AudioStream and checks it against the expected wave.
+ *
+ * \sa https://wiki.libsdl.org/SDL_BuildAudioCVT
+ * \sa https://wiki.libsdl.org/SDL_NewAudioStream
+ */
+int audio_resampleSine()
+{
+  const int rates[][2] = { { 44100, 48000 }, { 48000, 44100 }, { 22050, 44100 }, { 48000, 24000 }, { 11025, 48000 } };
+  const int channels[] = { 1, 2, 6 };
+  const double frequency = 440.0;
+  const double amplitude = 0.5;
+  const double tolerance = 0.001;
+  const int edge = 64;  /* output frames near the ends are affected by the padding */
+  int i, j, frame, chan;
+
+  for (i = 0; i < SDL_arraysize(rates); i++) {
+    const int inrate = rates[i][0];
+    const int outrate = rates[i][1];
+    const int inframes = inrate / 4;
+    const int expectedframes = (int) (inframes * ((double) outrate / inrate));  /* give or take one, for rounding */
+
+    for (j = 0; j < SDL_arraysize(channels); j++) {
+      const int chans = channels[j];
+      const int inlen = inframes * chans * (int) sizeof (float);
+      SDL_AudioCVT cvt;
+      SDL_AudioStream *stream;
+      float *input;
+      float *output;
+      int outframes, len, result;
+      double maxerror;
+
+      input = (float *) SDL_malloc(inlen);
+      SDLTest_AssertCheck(input != NULL, "Validate input buffer allocation");
+      if (input == NULL) return TEST_ABORTED;
+      for (frame = 0; frame < inframes; frame++) {
+        for (chan = 0; chan < chans; chan++) {
+          /* A different frequency for each channel catches channels getting mixed up */
+          input[(frame * chans) + chan] = (float) (amplitude * SDL_sin(2.0 * M_PI * frequency * (chan + 1) * frame / inrate));
+        }
+      }
+
+      /* SDL_ConvertAudio */
+      result = SDL_BuildAudioCVT(&cvt, AUDIO_F32SYS, chans, inrate, AUDIO_F32SYS, chans, outrate);
+      SDLTest_AssertPass("Call to SDL_BuildAudioCVT(%i Hz -> %i Hz, %i channels)", inrate, outrate, chans);
+      SDLTest_AssertCheck(result == 1, "Verify result value; expected: 1, got: %i", result);
+      cvt.len = inlen;
+      cvt.buf = (Uint8 *) SDL_malloc(cvt.len * cvt.len_mult);
+      SDLTest_AssertCheck(cvt.buf != NULL, "Validate conversion buffer allocation");
+      if (cvt.buf == NULL) {
+        SDL_free(input);
+        return TEST_ABORTED;
+      }
+      SDL_memcpy(cvt.buf, input, inlen);
+      result = SDL_ConvertAudio(&cvt);
+      SDLTest_AssertPass("Call to SDL_ConvertAudio()");
+      SDLTest_AssertCheck(result == 0, "Verify result value; expected: 0, got: %i", result);
+
+      output = (float *) cvt.buf;
+      outframes = cvt.len_cvt / (chans * (int) sizeof (float));
+      SDLTest_AssertCheck(SDL_abs(outframes - expectedframes) <= 1, "Verify converted length; expected: %i frames, got: %i", expectedframes, outframes);
+      maxerror = 0.0;
+      for (frame = edge; frame < outframes - edge; frame++) {
+        for (chan = 0; chan < chans; chan++) {
+          const double expected = amplitude * SDL_sin(2.0 * M_PI * frequency * (chan + 1) * frame / outrate);
+          maxerror = SDL_max(maxerror, SDL_fabs(output[(frame * chans) + chan] - expected));
+        }
+      }
+      SDLTest_AssertCheck(maxerror < tolerance, "Verify converted samples; expected error: < %f, got: %f", tolerance, maxerror);
+      SDL_free(cvt.buf);
+
+      /* SDL_AudioStream */
+      stream = SDL_NewAudioStream(AUDIO_F32SYS, chans, inrate, AUDIO_F32SYS, chans, outrate);
+      SDLTest_AssertPass("Call to SDL_NewAudioStream(%i Hz -> %i Hz, %i channels)", inrate, outrate, chans);
+      SDLTest_AssertCheck(stream != NULL, "Verify stream is not NULL");
+      if (stream == NULL) {
+        SDL_free(input);
+        return TEST_ABORTED;
+      }
+      result = SDL_AudioStreamPut(stream, input, inlen);
+      SDLTest_AssertCheck(result == 0, "Verify SDL_AudioStreamPut result; expected: 0, got: %i", result);
+      result = SDL_AudioStreamFlush(stream);
+      SDLTest_AssertCheck(result == 0, "Verify SDL_AudioStreamFlush result; expected: 0, got: %i", result);
+
+      len = SDL_AudioStreamAvailable(stream);
+      output = (float *) SDL_malloc(SDL_max(len, 1));
+      SDLTest_AssertCheck(output != NULL, "Validate output buffer allocation");
+      if (output == NULL) {
+        SDL_FreeAudioStream(stream);
+        SDL_free(input);
+        return TEST_ABORTED;
+      }
+      result = SDL_AudioStreamGet(stream, output, len);
+      SDLTest_AssertCheck(result == len, "Verify SDL_AudioStreamGet result; expected: %i, got: %i", len, result);
+
+      outframes = len / (chans * (int) sizeof (float));
+      /* The stream keeps back the end of its input, so it can give fewer frames than SDL_ConvertAudio */
+      SDLTest_AssertCheck(outframes > edge * 2 && outframes <= expectedframes + 1, "Verify streamed length; expected: up to %i frames, got: %i", expectedframes, outframes);
+      maxerror = 0.0;
+      for (frame = edge; frame < outframes - edge; frame++) {
+        for (chan = 0; chan < chans; chan++) {
+          const double expected = amplitude * SDL_sin(2.0 * M_PI * frequency * (chan + 1) * frame / outrate);
+          maxerror = SDL_max(maxerror, SDL_fabs(output[(frame * chans) + chan] - expected));
+        }
+      }
+      SDLTest_AssertCheck(maxerror < tolerance, "Verify streamed samples; expected error: < %f, got: %f", tolerance, maxerror);
+
+      SDL_free(output);
+      SDL_FreeAudioStream(stream);
+      SDL_free(input);
+    }
+  }
+
+  return TEST_COMPLETED;
+}
+
+/* Streams a 440 Hz sine from inrate to outrate and returns the largest error away from the ends, or -1.0 on failure */
+static double _audio_streamSineError(SDL_AudioStream *stream, const int chans, const int inrate, const int outrate)
+{
+  const int inframes = inrate / 4;
+  const int inlen = inframes * chans * (int) sizeof (float);
+  const int edge = 64;
+  float *input, *output;
+  double maxerror = 0.0;
+  int frame, chan, len, outframes;
+
+  input = (float *) SDL_malloc(inlen);
+  if (input == NULL) return -1.0;
+  for (frame = 0; frame < inframes; frame++) {
+    for (chan = 0; chan < chans; chan++) {
+      input[(frame * chans) + chan] = (float) (0.5 * SDL_sin(2.0 * M_PI * 440.0 * (chan + 1) * frame / inrate));
+    }
+  }
+  if (SDL_AudioStreamPut(stream, input, inlen) < 0 || SDL_AudioStreamFlush(stream) < 0) {
+    SDL_free(input);
+    return -1.0;
+  }
+  SDL_free(input);
+
+  len = SDL_AudioStreamAvailable(stream);
+  outframes = len / (chans * (int) sizeof (float));
+  if (outframes <= edge * 2) return -1.0;
+  output = (float *) SDL_malloc(len);
+  if (output == NULL) return -1.0;
+  if (SDL_AudioStreamGet(stream, output, len) != len) {
+    SDL_free(output);
+    return -1.0;
+  }
+  for (frame = edge; frame < outframes - edge; frame++) {
+    for (chan = 0; chan < chans; chan++) {
+      const double expected = 0.5 * SDL_sin(2.0 * M_PI * 440.0 * (chan + 1) * frame / outrate);
+      maxerror = SDL_max(maxerror, SDL_fabs(output[(frame * chans) + chan] - expected));
+    }
+  }
+  SDL_free(output);
+  return maxerror;
+}
+
+/**
+ * \brief Selects the resampler of audio streams and checks the output of each one.
+ *
+ * \sa https://wiki.libsdl.org/SDL_AudioStreamSetResampleQuality
+ * \sa https://wiki.libsdl.org/SDL_AudioStreamGetResampleQuality
+ */
+int audio_resampleQuality()
+{
+  const SDL_AudioResampleQuality qualities[] = { SDL_AUDIO_RESAMPLE_LINEAR, SDL_AUDIO_RESAMPLE_CUBIC, SDL_AUDIO_RESAMPLE_SINC };
+  const char *names[] = { "linear", "cubic", "sinc" };
+  const double tolerances[] = { 0.005, 0.001, 0.001 };
+  const int rates[][2] = { { 44100, 48000 }, { 48000, 22050 } };
+  SDL_AudioStream *stream;
+  SDL_AudioResampleQuality quality;
+  double error;
+  int result, i, j, chans;
+
+  /* Default, hint and invalid parameters */
+  stream = SDL_NewAudioStream(AUDIO_F32SYS, 1, 44100, AUDIO_F32SYS, 1, 48000);
+  SDLTest_AssertCheck(stream != NULL, "Verify stream is not NULL");
+  if (stream == NULL) return TEST_ABORTED;
+  quality = SDL_AudioStreamGetResampleQuality(stream);
+  SDLTest_AssertCheck(quality == SDL_AUDIO_RESAMPLE_SINC, "Verify default quality; expected: %i, got: %i", SDL_AUDIO_RESAMPLE_SINC, quality);
+  result = SDL_AudioStreamSetResampleQuality(stream, (SDL_AudioResampleQuality) 99);
+  SDLTest_AssertCheck(result == -1, "Verify invalid quality is rejected; expected: -1, got: %i", result);
+  quality = SDL_AudioStreamGetResampleQuality(stream);
+  SDLTest_AssertCheck(quality == SDL_AUDIO_RESAMPLE_SINC, "Verify quality is unchanged; expected: %i, got: %i", SDL_AUDIO_RESAMPLE_SINC, quality);
+  SDL_FreeAudioStream(stream);
+  result = SDL_AudioStreamSetResampleQuality(NULL, SDL_AUDIO_RESAMPLE_LINEAR);
+  SDLTest_AssertCheck(result == -1, "Verify NULL stream is rejected; expected: -1, got: %i", result);
+
+  SDL_SetHint(SDL_HINT_AUDIO_RESAMPLING_MODE, "cubic");
+  stream = SDL_NewAudioStream(AUDIO_F32SYS, 2, 22050, AUDIO_F32SYS, 2, 44100);
+  SDL_SetHint(SDL_HINT_AUDIO_RESAMPLING_MODE, "default");
+  SDLTest_AssertCheck(stream != NULL, "Verify stream is not NULL");
+  if (stream == NULL) return TEST_ABORTED;
+  quality = SDL_AudioStreamGetResampleQuality(stream);
+  SDLTest_AssertCheck(quality == SDL_AUDIO_RESAMPLE_CUBIC, "Verify quality from hint; expected: %i, got: %i", SDL_AUDIO_RESAMPLE_CUBIC, quality);
+  SDL_FreeAudioStream(stream);
+
+  /* Each resampler against the expected wave */
+  for (i = 0; i < SDL_arraysize(qualities); i++) {
+    for (j = 0; j < SDL_arraysize(rates); j++) {
+      for (chans = 1; chans <= 2; chans++) {
+        stream = SDL_NewAudioStream(AUDIO_F32SYS, chans, rates[j][0], AUDIO_F32SYS, chans, rates[j][1]);
+        SDLTest_AssertCheck(stream != NULL, "Verify stream is not NULL");
+        if (stream == NULL) return TEST_ABORTED;
+        result = SDL_AudioStreamSetResampleQuality(stream, qualities[i]);
+        SDLTest_AssertPass("Call to SDL_AudioStreamSetResampleQuality(%s)", names[i]);
+        SDLTest_AssertCheck(result == 0, "Verify result value; expected: 0, got: %i", result);
+        quality = SDL_AudioStreamGetResampleQuality(stream);
+        SDLTest_AssertCheck(quality == qualities[i], "Verify quality; expected: %i, got: %i", qualities[i], quality);
+
+        error = _audio_streamSineError(stream, chans, rates[j][0], rates[j][1]);
+        SDLTest_AssertCheck(error >= 0.0 && error < tolerances[i], "Verify %s resampling %i Hz -> %i Hz, %i channels; expected error: < %f, got: %f",
+                            names[i], rates[j][0], rates[j][1], chans, tolerances[i], error);
+        SDL_FreeAudioStream(stream);
+      }
+    }
+  }
+
+  return TEST_COMPLETED;
+}
+
+/* Fills sample k of an SDL_MixAudioFormat test buffer; the extremes come first to check saturation */
+static void _audio_setMixSample(Uint8 *buf, const SDL_AudioFormat format, const int k, const int extreme)
+{
+  switch (format) {
+  case AUDIO_S8:
+    ((Sint8 *) buf)[k] = (k < 16) ? (extreme ? SDL_MIN_SINT8 : SDL_MAX_SINT8) : SDLTest_RandomSint8();
+    break;
+  case AUDIO_S16SYS:
+    ((Sint16 *) buf)[k] = (k < 16) ? (extreme ? SDL_MIN_SINT16 : SDL_MAX_SINT16) : SDLTest_RandomSint16();
+    break;
+  case AUDIO_S32SYS:
+    ((Sint32 *) buf)[k] = (k < 16) ? (extreme ? SDL_MIN_SINT32 : SDL_MAX_SINT32) : SDLTest_RandomSint32();
+    break;
+  default:
+    ((float *) buf)[k] = (k < 16) ? (extreme ? -3.0e38f : 3.0e38f) : ((SDLTest_RandomUnitFloat() * 2.0f) - 1.0f);
+    break;
+  }
+}
+
+/**
+ * \brief Mixes buffers with SDL_MixAudioFormat at several volumes and checks them against the expected samples.
+ *
+ * \sa https://wiki.libsdl.org/SDL_MixAudioFormat
+ */
+int audio_mixAudioFormat()
+{
+  const SDL_AudioFormat formats[] = { AUDIO_S8, AUDIO_S16SYS, AUDIO_S32SYS, AUDIO_F32SYS };
+  const char *formatNames[] = { "AUDIO_S8", "AUDIO_S16SYS", "AUDIO_S32SYS", "AUDIO_F32SYS" };
+  const int volumes[] = { SDL_MIX_MAXVOLUME, 100, 37, 1 };
+  const int samples = 1003;  /* not a multiple of any vector size */
+  Uint8 *srcbuf, *dstbuf, *expected;
+  int i, j, k, mismatch;
+
+  /* One extra sample, so the mixed samples start unaligned */
+  srcbuf = (Uint8 *) SDL_malloc((samples + 1) * 4);
+  dstbuf = (Uint8 *) SDL_malloc((samples + 1) * 4);
+  expected = (Uint8 *) SDL_malloc(samples * 4);
+  SDLTest_AssertCheck(srcbuf != NULL && dstbuf != NULL && expected != NULL, "Validate buffer allocation");
+  if (srcbuf == NULL || dstbuf == NULL || expected == NULL) {
+    SDL_free(srcbuf);
+    SDL_free(dstbuf);
+    SDL_free(expected);
+    return TEST_ABORTED;
+  }
+
+  for (i = 0; i < SDL_arraysize(formats); i++) {
+    const SDL_AudioFormat format = formats[i];
+    const int size = SDL_AUDIO_BITSIZE(format) / 8;
+    Uint8 *src = srcbuf + size;
+    Uint8 *dst = dstbuf + size;
+
+    for (j = 0; j < SDL_arraysize(volumes); j++) {
+      const int volume = volumes[j];
+
+      for (k = 0; k < samples; k++) {
+        _audio_setMixSample(src, format, k, k & 1);
+        _audio_setMixSample(dst, format, k, k & 2);
+      }
+      SDL_memcpy(expected, dst, samples * size);
+
+      /* Mix by hand, the way the scalar code does */
+      for (k = 0; k < samples; k++) {
+        if (format == AUDIO_F32SYS) {
+          const float s = (((float *) src)[k] * (float) volume) * (1.0f / ((float) SDL_MIX_MAXVOLUME));
+          const double d = ((double) ((float *) expected)[k]) + s;
+          ((float *) expected)[k] = (float) SDL_max(SDL_min(d, 3.402823466e+38F), -3.402823466e+38F);
+        } else {
+          const Sint64 maxval = (((Sint64) 1) << ((size * 8) - 1)) - 1;
+          const Sint64 minval = -maxval - 1;
+          Sint64 d;
+          if (size == 1) {
+            d = ((Sint8 *) expected)[k] + ((((Sint8 *) src)[k] * volume) / SDL_MIX_MAXVOLUME);
+          } else if (size == 2) {
+            d = ((Sint16 *) expected)[k] + ((((Sint16 *) src)[k] * volume) / SDL_MIX_MAXVOLUME);
+          } else {
+            d = ((Sint32 *) expected)[k] + ((((Sint64) ((Sint32 *) src)[k]) * volume) / SDL_MIX_MAXVOLUME);
+          }
+          d = SDL_max(SDL_min(d, maxval), minval);
+          if (size == 1) {
+            ((Sint8 *) expected)[k] = (Sint8) d;
+          } else if (size == 2) {
+            ((Sint16 *) expected)[k] = (Sint16) d;
+          } else {
+            ((Sint32 *) expected)[k] = (Sint32) d;
+          }
+        }
+      }
+
+      SDL_MixAudioFormat(dst, src, format, samples * size, volume);
+      SDLTest_AssertPass("Call to SDL_MixAudioFormat(%s, volume %i)", formatNames[i], volume);
+
+      mismatch = -1;
+      for (k = 0; k < samples && mismatch < 0; k++) {
+        if (SDL_memcmp(dst + (k * size), expected + (k * size), size) != 0) {
+          mismatch = k;
+        }
+      }
+      SDLTest_AssertCheck(mismatch < 0, "Verify mixed samples; expected: all matching, got: first mismatch at %i", mismatch);
+    }
+  }
+
+  SDL_free(srcbuf);
+  SDL_free(dstbuf);
+  SDL_free(expected);
+  return TEST_COMPLETED;
+}
+
+
+/**
+ * \brief Binds audio streams to a device of the disk driver and checks the mix it writes.
+ *
+ * \sa https://wiki.libsdl.org/SDL_BindAudioStream
+ * \sa https://wiki.libsdl.org/SDL_UnbindAudioStream
+ */
+int audio_bindAudioStream()
+{
+  const int frames = 4096;
+  SDL_AudioSpec desired, obtained;
+  SDL_AudioDeviceID dev;
+  SDL_AudioStream *mono, *stereo, *wrong;
+  Sint16 monobuf[1024], queuebuf[1024 * 2];
+  float stereobuf[2048 * 2];
+  Sint16 *output = NULL;
+  SDL_RWops *rw;
+  Sint64 size, startsize;
+  char *driver;
+  int i, result, start, count, mismatch;
+
+  /* Restart the audio subsystem with the disk writer, so the output can be read back */
+  driver = SDL_getenv("SDL_AUDIODRIVER") ? SDL_strdup(SDL_getenv("SDL_AUDIODRIVER")) : NULL;
+  SDL_QuitSubSystem( SDL_INIT_AUDIO );
+  SDLTest_AssertPass("Call to SDL_QuitSubSystem(SDL_INIT_AUDIO)");
+  SDL_setenv("SDL_AUDIODRIVER", "disk", 1);
+  result = SDL_InitSubSystem( SDL_INIT_AUDIO );
+  SDLTest_AssertPass("Call to SDL_InitSubSystem(SDL_INIT_AUDIO) with the disk driver");
+  SDL_setenv("SDL_AUDIODRIVER", driver ? driver : "", 1);
+  SDL_free(driver);
+  if (result != 0) {
+    SDLTest_Log("Disk audio driver not available, skipping test");
+    _audioSetUp(NULL);
+    return TEST_SKIPPED;
+  }
+
+  SDL_zero(desired);
+  desired.freq = 22050;
+  desired.format = AUDIO_S16SYS;
+  desired.channels = 2;
+  desired.samples = 512;
+  desired.callback = NULL;
+  dev = SDL_OpenAudioDevice(NULL, 0, &desired, &obtained, 0);
+  SDLTest_AssertPass("Call to SDL_OpenAudioDevice(NULL, 0, ...)");
+  SDLTest_AssertCheck(dev > 0, "Validate device id; expected: >0, got: %d", dev);
+  if (dev == 0) {
+    SDLTest_LogError("%s", SDL_GetError());
+    SDL_QuitSubSystem( SDL_INIT_AUDIO );
+    _audioSetUp(NULL);
+    return TEST_ABORTED;
+  }
+
+  mono = SDL_NewAudioStream(AUDIO_S16SYS, 1, 22050, AUDIO_F32SYS, 2, 22050);
+  stereo = SDL_NewAudioStream(AUDIO_F32SYS, 2, 22050, AUDIO_F32SYS, 2, 22050);
+  wrong = SDL_NewAudioStream(AUDIO_F32SYS, 2, 22050, AUDIO_S16SYS, 2, 22050);
+  SDLTest_AssertCheck(mono != NULL && stereo != NULL && wrong != NULL, "Validate stream creation");
+
+  /* Negative cases */
+  result = SDL_BindAudioStream(dev, NULL);
+  SDLTest_AssertCheck(result == -1, "Verify binding a NULL stream fails; expected: -1, got: %i", result);
+  result = SDL_BindAudioStream(dev, wrong);
+  SDLTest_AssertCheck(result == -1, "Verify binding a stream with the wrong output format fails; expected: -1, got: %i", result);
+  result = SDL_AudioStreamSetGain(stereo, -1.0f);
+  SDLTest_AssertCheck(result == -1, "Verify negative gain is rejected; expected: -1, got: %i", result);
+
+  result = SDL_BindAudioStream(dev, mono);
+  SDLTest_AssertCheck(result == 0, "Verify SDL_BindAudioStream(mono); expected: 0, got: %i", result);
+  result = SDL_BindAudioStream(dev, mono);
+  SDLTest_AssertCheck(result == -1, "Verify binding a stream twice fails; expected: -1, got: %i", result);
+  result = SDL_BindAudioStream(dev, stereo);
+  SDLTest_AssertCheck(result == 0, "Verify SDL_BindAudioStream(stereo); expected: 0, got: %i", result);
+  result = SDL_AudioStreamSetGain(stereo, 0.5f);
+  SDLTest_AssertCheck(result == 0 && SDL_AudioStreamGetGain(stereo) == 0.5f, "Verify SDL_AudioStreamSetGain(stereo, 0.5)");
+  result = SDL_AudioStreamGet(mono, stereobuf, sizeof (stereobuf));
+  SDLTest_AssertCheck(result == -1, "Verify getting data from a bound stream fails; expected: -1, got: %i", result);
+
+  /* mono: 0.25 for 4096 frames, put in pieces; stereo: 0.5 at half gain for 2048 frames; queued: 1000 for 1024 frames */
+  for (i = 0; i < SDL_arraysize(monobuf); i++) {
+    monobuf[i] = 8192;
+  }
+  for (i = 0; i < SDL_arraysize(stereobuf); i++) {
+    stereobuf[i] = 0.5f;
+  }
+  for (i = 0; i < SDL_arraysize(queuebuf); i++) {
+    queuebuf[i] = 1000;
+  }
+  for (i = 0; i < frames / SDL_arraysize(monobuf); i++) {
+    result = SDL_AudioStreamPut(mono, monobuf, sizeof (monobuf));
+    SDLTest_AssertCheck(result == 0, "Verify SDL_AudioStreamPut(mono) on a bound stream; expected: 0, got: %i", result);
+  }
+  result = SDL_AudioStreamFlush(mono);
+  SDLTest_AssertCheck(result == 0, "Verify SDL_AudioStreamFlush(mono) on a bound stream; expected: 0, got: %i", result);
+  result = SDL_AudioStreamPut(stereo, stereobuf, sizeof (stereobuf));
+  SDLTest_AssertCheck(result == 0, "Verify SDL_AudioStreamPut(stereo) on a bound stream; expected: 0, got: %i", result);
+  result = SDL_QueueAudio(dev, queuebuf, sizeof (queuebuf));
+  SDLTest_AssertCheck(result == 0, "Verify SDL_QueueAudio(); expected: 0, got: %i", result);
+
+  /* Play until well past the end of the streams */
+  rw = SDL_RWFromFile("sdlaudio.raw", "rb");
+  startsize = rw ? SDL_RWsize(rw) : 0;
+  SDL_PauseAudioDevice(dev, 0);
+  for (i = 0; i < 100 && rw; i++) {
+    SDL_Delay(50);
+    size = SDL_RWsize(rw);
+    if (size >= startsize + (frames * 2 * 4)) {
+      break;
+    }
+  }
+  if (rw) {
+    SDL_RWclose(rw);
+  }
+  SDL_CloseAudioDevice(dev);
+  SDLTest_AssertPass("Call to SDL_CloseAudioDevice()");
+
+  result = SDL_AudioStreamAvailable(mono);
+  SDLTest_AssertCheck(result == 0, "Verify closing the device unbound and drained the stream; expected: 0, got: %i", result);
+  SDL_UnbindAudioStream(mono);
+  SDLTest_AssertPass("Call to SDL_UnbindAudioStream() on an unbound stream");
+
+  /* Skip the silence played while paused, then check each section of the mix */
+  rw = SDL_RWFromFile("sdlaudio.raw", "rb");
+  SDLTest_AssertCheck(rw != NULL, "Verify the disk driver wrote its output");
+  if (rw) {
+    size = SDL_RWsize(rw);
+    output = (Sint16 *) SDL_malloc((size_t) size);
+    if (output) {
+      SDL_RWread(rw, output, 1, (size_t) size);
+    }
+    SDL_RWclose(rw);
+  }
+  count = output ? (int) (size / sizeof (Sint16)) : 0;
+  for (start = 0; start < count && output[start] == 0; start++) {
+  }
+  start &= ~1;
+  SDLTest_AssertCheck(count - start >= (frames + 512) * 2, "Verify output length; expected: >= %i samples, got: %i", (frames + 512) * 2, count - start);
+
+  mismatch = -1;
+  for (i = 0; i < (frames + 512) * 2 && start + i < count && mismatch < 0; i++) {
+    const int frame = i / 2;
+    const int expected = (frame < 1024) ? (1000 + 16383) : (frame < 2048) ? 16383 : (frame < frames) ? 8191 : 0;
+    if (SDL_abs(output[start + i] - expected) > 1) {
+      mismatch = i;
+      SDLTest_LogError("Sample %i of the mix: expected %i, got %i", i, expected, output[start + i]);
+    }
+  }
+  SDLTest_AssertCheck(mismatch < 0, "Verify the mixed samples; expected: all within 1 of the reference, got: first mismatch at %i", mismatch);
+
+  SDL_free(output);
+  SDL_FreeAudioStream(mono);
+  SDL_FreeAudioStream(stereo);
+  SDL_FreeAudioStream(wrong);
+
+  SDL_QuitSubSystem( SDL_INIT_AUDIO );
+  SDLTest_AssertPass("Call to SDL_QuitSubSystem(SDL_INIT_AUDIO)");
+
+  /* Restart audio again */
+  _audioSetUp(NULL);
+
+  return TEST_COMPLETED;
+}
+
+
+/**
+ * \brief Queues, clears and drains audio on a device of the disk driver.
+ *
+ * \sa https://wiki.libsdl.org/SDL_QueueAudio
+ * \sa https://wiki.libsdl.org/SDL_GetQueuedAudioSize
+ * \sa https://wiki.libsdl.org/SDL_ClearQueuedAudio
+ */
+int audio_queueAudio()
+{
+  SDL_AudioSpec desired, obtained;
+  SDL_AudioDeviceID dev;
+  Sint16 dropped[4096], kept[1000];
+  Sint16 *output = NULL;
+  SDL_RWops *rw;
+  Sint64 size = 0;
+  char *driver;
+  int i, result, count, numdropped, numkept, firstkept, lastkept;
+  Uint32 queued;
+
+  /* Restart the audio subsystem with the disk writer, so the output can be read back */
+  driver = SDL_getenv("SDL_AUDIODRIVER") ? SDL_strdup(SDL_getenv("SDL_AUDIODRIVER")) : NULL;
+  SDL_QuitSubSystem( SDL_INIT_AUDIO );
+  SDLTest_AssertPass("Call to SDL_QuitSubSystem(SDL_INIT_AUDIO)");
+  SDL_setenv("SDL_AUDIODRIVER", "disk", 1);
+  result = SDL_InitSubSystem( SDL_INIT_AUDIO );
+  SDLTest_AssertPass("Call to SDL_InitSubSystem(SDL_INIT_AUDIO) with the disk driver");
+  SDL_setenv("SDL_AUDIODRIVER", driver ? driver : "", 1);
+  SDL_free(driver);
+  if (result != 0) {
+    SDLTest_Log("Disk audio driver not available, skipping test");
+    _audioSetUp(NULL);
+    return TEST_SKIPPED;
+  }
+
+  SDL_zero(desired);
+  desired.freq = 22050;
+  desired.format = AUDIO_S16SYS;
+  desired.channels = 1;
+  desired.samples = 512;
+  desired.callback = NULL;
+  dev = SDL_OpenAudioDevice(NULL, 0, &desired, &obtained, 0);
+  SDLTest_AssertPass("Call to SDL_OpenAudioDevice(NULL, 0, ...)");
+  SDLTest_AssertCheck(dev > 0, "Validate device id; expected: >0, got: %d", dev);
+  if (dev == 0) {
+    SDLTest_LogError("%s", SDL_GetError());
+    SDL_QuitSubSystem( SDL_INIT_AUDIO );
+    _audioSetUp(NULL);
+    return TEST_ABORTED;
+  }
+
+  for (i = 0; i < SDL_arraysize(dropped); i++) {
+    dropped[i] = 1111;
+  }
+  for (i = 0; i < SDL_arraysize(kept); i++) {
+    kept[i] = 2222;
+  }
+
+  /* The device starts paused, so nothing drains until we say so */
+  result = SDL_QueueAudio(dev, dropped, sizeof (dropped));
+  SDLTest_AssertCheck(result == 0, "Verify SDL_QueueAudio(); expected: 0, got: %i", result);
+  result = SDL_QueueAudio(dev, dropped, 0);
+  SDLTest_AssertCheck(result == 0, "Verify SDL_QueueAudio() with zero length; expected: 0, got: %i", result);
+  queued = SDL_GetQueuedAudioSize(dev);
+  SDLTest_AssertCheck(queued == sizeof (dropped), "Verify SDL_GetQueuedAudioSize(); expected: %i, got: %i", (int) sizeof (dropped), (int) queued);
+  result = (int) SDL_DequeueAudio(dev, kept, sizeof (kept));
+  SDLTest_AssertCheck(result == 0, "Verify SDL_DequeueAudio() on a playback device; expected: 0, got: %i", result);
+
+  SDL_ClearQueuedAudio(dev);
+  SDLTest_AssertPass("Call to SDL_ClearQueuedAudio()");
+  queued = SDL_GetQueuedAudioSize(dev);
+  SDLTest_AssertCheck(queued == 0, "Verify SDL_GetQueuedAudioSize() after clearing; expected: 0, got: %i", (int) queued);
+
+  for (i = 0; i < 3; i++) {
+    result = SDL_QueueAudio(dev, kept, sizeof (kept));
+    SDLTest_AssertCheck(result == 0, "Verify SDL_QueueAudio() after clearing; expected: 0, got: %i", result);
+  }
+  queued = SDL_GetQueuedAudioSize(dev);
+  SDLTest_AssertCheck(queued == 3 * sizeof (kept), "Verify SDL_GetQueuedAudioSize(); expected: %i, got: %i", (int) (3 * sizeof (kept)), (int) queued);
+
+  /* Play until the queue drains */
+  SDL_PauseAudioDevice(dev, 0);
+  for (i = 0; i < 100 && SDL_GetQueuedAudioSize(dev) > 0; i++) {
+    SDL_Delay(50);
+  }
+  queued = SDL_GetQueuedAudioSize(dev);
+  SDLTest_AssertCheck(queued == 0, "Verify the queue drained; expected: 0, got: %i", (int) queued);
+  SDL_Delay(100);
+  SDL_CloseAudioDevice(dev);
+  SDLTest_AssertPass("Call to SDL_CloseAudioDevice()");
+
+  /* Only the audio queued after clearing may reach the device, and all of it in order */
+  rw = SDL_RWFromFile("sdlaudio.raw", "rb");
+  SDLTest_AssertCheck(rw != NULL, "Verify the disk driver wrote its output");
+  if (rw) {
+    size = SDL_RWsize(rw);
+    output = (Sint16 *) SDL_malloc((size_t) size);
+    if (output) {
+      SDL_RWread(rw, output, 1, (size_t) size);
+    }
+    SDL_RWclose(rw);
+  }
+  count = output ? (int) (size / sizeof (Sint16)) : 0;
+  numdropped = numkept = 0;
+  firstkept = lastkept = -1;
+  for (i = 0; i < count; i++) {
+    if (output[i] == 1111) {
+      numdropped++;
+    } else if (output[i] == 2222) {
+      numkept++;
+      if (firstkept < 0) {
+        firstkept = i;
+      }
+      lastkept = i;
+    }
+  }
+  SDLTest_AssertCheck(numdropped == 0, "Verify cleared audio was not played; expected: 0 samples, got: %i", numdropped);
+  SDLTest_AssertCheck(numkept == 3 * SDL_arraysize(kept), "Verify queued audio was played; expected: %i samples, got: %i", (int) (3 * SDL_arraysize(kept)), numkept);
+  SDLTest_AssertCheck(lastkept - firstkept + 1 == numkept, "Verify queued audio was played without gaps; expected: %i samples, got: %i", numkept, lastkept - firstkept + 1);
+
+  SDL_free(output);
+
+  SDL_QuitSubSystem( SDL_INIT_AUDIO );
+  SDLTest_AssertPass("Call to SDL_QuitSubSystem(SDL_INIT_AUDIO)");
+
+  /* Restart audio again */
+  _audioSetUp(NULL);
+
+  return TEST_COMPLETED;
+}
 
 /* ================= Test Case References ================== */
 
@@ -1022,11 +1642,27 @@ static const SDLTest_TestCaseReference audioTest14 =
 static const SDLTest_TestCaseReference audioTest15 =
         { (SDLTest_TestCaseFp)audio_pauseUnpauseAudio, "audio_pauseUnpauseAudio", "Pause and Unpause audio for various audio specs while testing callback.", TEST_ENABLED };
 
+static const SDLTest_TestCaseReference audioTest16 =
+        { (SDLTest_TestCaseFp)audio_resampleSine, "audio_resampleSine", "Resample a sine wave at common rates and channel counts.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest17 =
+        { (SDLTest_TestCaseFp)audio_resampleQuality, "audio_resampleQuality", "Select the resampler of audio streams and check each one.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest18 =
+        { (SDLTest_TestCaseFp)audio_mixAudioFormat, "audio_mixAudioFormat", "Mix audio in various formats and volumes.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest19 =
+        { (SDLTest_TestCaseFp)audio_bindAudioStream, "audio_bindAudioStream", "Mix audio streams bound to a device.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest20 =
+        { (SDLTest_TestCaseFp)audio_queueAudio, "audio_queueAudio", "Queue, clear and drain audio on a device.", TEST_ENABLED };
+
 /* Sequence of Audio test cases */
 static const SDLTest_TestCaseReference *audioTests[] =  {
     &audioTest1, &audioTest2, &audioTest3, &audioTest4, &audioTest5, &audioTest6,
     &audioTest7, &audioTest8, &audioTest9, &audioTest10, &audioTest11,
-    &audioTest12, &audioTest13, &audioTest14, &audioTest15, NULL
+    &audioTest12, &audioTest13, &audioTest14, &audioTest15, &audioTest16,
+    &audioTest17, &audioTest18, &audioTest19, &audioTest20, NULL
 };
 
 /* Audio test suite (global) */
@@ -419,6 +419,898 @@ render_testBlit(void *arg)
    return TEST_COMPLETED;
 }
 
+/* Scalar per pixel version of the software renderer's rotozoomer, used as
+   the reference for rotated copies of opaque ARGB8888 pixels. */
+static void
+_rotateReference(const Uint32 *src, int sw, int sh, double angle, int smooth, int flipx, int flipy,
+                 Uint32 *dst, int dw, int dh, double cangle, double sangle)
+{
+   int x, y, c, angle90 = (int)(angle / 90);
+
+   if (angle90 == angle / 90) {
+      /* Exact multiples of 90 degrees map every pixel, without sampling. */
+      angle90 %= 4;
+      if (angle90 < 0) angle90 += 4;
+      for (y = 0; y < dh; y++) {
+         for (x = 0; x < dw; x++) {
+            int sx, sy;
+            switch (angle90) {
+            case 0: sx = x; sy = y; break;
+            case 1: sx = y; sy = sh - 1 - x; break;
+            case 2: sx = sw - 1 - x; sy = sh - 1 - y; break;
+            default: sx = sw - 1 - y; sy = x; break;
+            }
+            if (flipx) sx = sw - 1 - sx;
+            if (flipy) sy = sh - 1 - sy;
+            dst[y * dw + x] = src[sy * sw + sx];
+         }
+      }
+   } else {
+      const int cx = dw / 2, cy = dh / 2;
+      const int isin = (int)(sangle * 65536.0), icos = (int)(cangle * 65536.0);
+      const int xd = (sw - dw) << 15, yd = (sh - dh) << 15;
+      const int ax = (cx << 16) - (icos * cx), ay = (cy << 16) - (isin * cx);
+
+      for (y = 0; y < dh; y++) {
+         int sdx = ax + isin * (cy - y) + xd;
+         int sdy = ay - icos * (cy - y) + yd;
+         for (x = 0; x < dw; x++, sdx += icos, sdy += isin) {
+            int dx = sdx >> 16, dy = sdy >> 16;
+            if (!smooth) {
+               if ((unsigned)dx < (unsigned)sw && (unsigned)dy < (unsigned)sh) {
+                  if (flipx) dx = sw - 1 - dx;
+                  if (flipy) dy = sh - 1 - dy;
+                  dst[y * dw + x] = src[dy * sw + dx];
+               }
+            } else {
+               Uint32 c00, c01, c10, c11, t, pixel = 0;
+               int ex = sdx & 0xffff, ey = sdy & 0xffff;
+               if (flipx) dx = sw - 1 - dx;
+               if (flipy) dy = sh - 1 - dy;
+               if (dx < 0 || dy < 0 || dx >= sw - 1 || dy >= sh - 1) {
+                  continue;
+               }
+               c00 = src[dy * sw + dx];
+               c01 = src[dy * sw + dx + 1];
+               c10 = src[(dy + 1) * sw + dx];
+               c11 = src[(dy + 1) * sw + dx + 1];
+               if (flipx) {
+                  t = c00; c00 = c01; c01 = t;
+                  t = c10; c10 = c11; c11 = t;
+               }
+               if (flipy) {
+                  t = c00; c00 = c10; c10 = t;
+                  t = c01; c01 = c11; c11 = t;
+               }
+               for (c = 0; c < 32; c += 8) {
+                  int p00 = (c00 >> c) & 0xff, p01 = (c01 >> c) & 0xff;
+                  int p10 = (c10 >> c) & 0xff, p11 = (c11 >> c) & 0xff;
+                  int t1 = ((((p01 - p00) * ex) >> 16) + p00) & 0xff;
+                  int t2 = ((((p11 - p10) * ex) >> 16) + p10) & 0xff;
+                  pixel |= (Uint32)(((((t2 - t1) * ey) >> 16) + t1) & 0xff) << c;
+               }
+               dst[y * dw + x] = pixel;
+            }
+         }
+      }
+   }
+}
+
+/* Draws the reference for an opaque texture copied with SDL_RenderCopyEx() to 'rect', rotated around its center. */
+static void
+_drawRotateReference(SDL_Surface *target, const Uint32 *src, const SDL_Rect *rect,
+                     double angle, int smooth, SDL_RendererFlip flip)
+{
+   int dw, dh, x, y, left, top, i;
+   double cangle, sangle, px[4], py[4];
+   Uint32 *rotated;
+   const int angle90 = (int)(angle / 90);
+   const int cx = rect->x + rect->w / 2, cy = rect->y + rect->h / 2;
+
+   /* Size of the rotated surface */
+   if (angle90 == angle / 90) {
+      int quarter = ((angle90 % 4) + 4) % 4;
+      dw = (quarter & 1) ? rect->h : rect->w;
+      dh = (quarter & 1) ? rect->w : rect->h;
+      cangle = (quarter & 1) ? 0 : (quarter == 0 ? 1 : -1);
+      sangle = (quarter & 1) ? (quarter == 1 ? -1 : 1) : 0;
+   } else {
+      double radangle = angle * (M_PI / -180.0);
+      double hx = (double)(rect->w / 2), hy = (double)(rect->h / 2);
+      double cxx, cyy, sxx, syy;
+      sangle = SDL_sin(radangle);
+      cangle = SDL_cos(radangle);
+      cxx = cangle * hx; cyy = cangle * hy;
+      sxx = sangle * hx; syy = sangle * hy;
+      dw = 2 * SDL_max((int)SDL_ceil(SDL_max(SDL_max(SDL_fabs(cxx + syy), SDL_fabs(cxx - syy)),
+                                             SDL_max(SDL_fabs(-cxx + syy), SDL_fabs(-cxx - syy)))), 1);
+      dh = 2 * SDL_max((int)SDL_ceil(SDL_max(SDL_max(SDL_fabs(sxx + cyy), SDL_fabs(sxx - cyy)),
+                                             SDL_max(SDL_fabs(-sxx + cyy), SDL_fabs(-sxx - cyy)))), 1);
+   }
+
+   rotated = (Uint32 *) SDL_calloc(dw * dh, sizeof(Uint32));
+   if (rotated == NULL) {
+      return;
+   }
+   _rotateReference(src, rect->w, rect->h, angle, smooth, flip & SDL_FLIP_HORIZONTAL, flip & SDL_FLIP_VERTICAL,
+                    rotated, dw, dh, cangle, sangle);
+
+   /* The top left of the rotated surface is the smallest rotated corner of the rectangle. */
+   for (i = 0; i < 4; i++) {
+      double ox = ((i & 1) ? rect->x + rect->w : rect->x) - cx;
+      double oy = ((i & 2) ? rect->y + rect->h : rect->y) - cy;
+      px[i] = ox * cangle + oy * sangle + cx;
+      py[i] = -ox * sangle + oy * cangle + cy;
+   }
+   left = (int)SDL_min(SDL_min(px[0], px[1]), SDL_min(px[2], px[3]));
+   top = (int)SDL_min(SDL_min(py[0], py[1]), SDL_min(py[2], py[3]));
+
+   /* Only the sampled pixels are opaque, the rest leave the target alone. */
+   for (y = 0; y < dh; y++) {
+      for (x = 0; x < dw; x++) {
+         const Uint32 pixel = rotated[y * dw + x];
+         if ((pixel >> 24) && left + x >= 0 && top + y >= 0 && left + x < target->w && top + y < target->h) {
+            *((Uint32 *)((Uint8 *)target->pixels + (top + y) * target->pitch) + left + x) = pixel;
+         }
+      }
+   }
+   SDL_free(rotated);
+}
+
+/**
+ * @brief Tests rotated and flipped copies against a scalar reference.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_RenderCopyEx
+ * http://wiki.libsdl.org/moin.cgi/SDL_HINT_RENDER_SCALE_QUALITY
+ */
+int
+render_testRotate(void *arg)
+{
+   const double angles[] = { 0.0, 90.0, 180.0, 270.0, 33.0, -141.5 };
+   const SDL_RendererFlip flips[] = { SDL_FLIP_NONE, SDL_FLIP_HORIZONTAL, SDL_FLIP_VERTICAL,
+                                      (SDL_RendererFlip)(SDL_FLIP_HORIZONTAL | SDL_FLIP_VERTICAL) };
+   const char *qualities[] = { "nearest", "linear" };
+   const SDL_Rect rect = { 21, 25, 23, 14 };
+   Uint32 pixels[23 * 14];
+   SDL_Surface *target, *reference, *source, *converted;
+   SDL_Renderer *sw;
+   SDL_Texture *texture;
+   int bits, q, a, f, i, ret, checkFailCount1;
+
+   target = SDL_CreateRGBSurface(0, TESTRENDER_SCREEN_W, TESTRENDER_SCREEN_H, 32,
+       RENDER_COMPARE_RMASK, RENDER_COMPARE_GMASK, RENDER_COMPARE_BMASK, RENDER_COMPARE_AMASK);
+   reference = SDL_CreateRGBSurface(0, TESTRENDER_SCREEN_W, TESTRENDER_SCREEN_H, 32,
+       RENDER_COMPARE_RMASK, RENDER_COMPARE_GMASK, RENDER_COMPARE_BMASK, RENDER_COMPARE_AMASK);
+   sw = target ? SDL_CreateSoftwareRenderer(target) : NULL;
+   SDLTest_AssertCheck(sw != NULL && reference != NULL, "Verify SDL_CreateSoftwareRenderer() result");
+   if (sw == NULL || reference == NULL) {
+      SDL_FreeSurface(reference);
+      SDL_FreeSurface(target);
+      return TEST_ABORTED;
+   }
+   SDL_SetRenderDrawColor(sw, 32, 64, 96, SDL_ALPHA_OPAQUE);
+
+   for (bits = 32; bits >= 8; bits -= 24) {
+      /* An opaque pattern, either as 32-bit pixels or through a palette */
+      if (bits == 32) {
+         source = SDL_CreateRGBSurfaceWithFormat(0, rect.w, rect.h, 32, SDL_PIXELFORMAT_RGB888);
+      } else {
+         source = SDL_CreateRGBSurfaceWithFormat(0, rect.w, rect.h, 8, SDL_PIXELFORMAT_INDEX8);
+      }
+      SDLTest_AssertCheck(source != NULL, "Verify %i-bit source surface", bits);
+      if (source == NULL) {
+         continue;
+      }
+      if (bits == 8) {
+         for (i = 0; i < 256; i++) {
+            SDL_Color color;
+            color.r = (Uint8)(i * 5);
+            color.g = (Uint8)(255 - i);
+            color.b = (Uint8)(i * 3 + 40);
+            color.a = SDL_ALPHA_OPAQUE;
+            SDL_SetPaletteColors(source->format->palette, &color, i, 1);
+         }
+      }
+      for (i = 0; i < rect.w * rect.h; i++) {
+         Uint8 *row = (Uint8 *)source->pixels + (i / rect.w) * source->pitch;
+         const Uint32 value = (Uint32)(i * 2654435761u) >> 8;
+         if (bits == 32) {
+            ((Uint32 *)row)[i % rect.w] = value;
+         } else {
+            row[i % rect.w] = (Uint8)value;
+         }
+      }
+      converted = SDL_ConvertSurfaceFormat(source, SDL_PIXELFORMAT_ARGB8888, 0);
+      SDLTest_AssertCheck(converted != NULL, "Verify SDL_ConvertSurfaceFormat() result");
+      if (converted != NULL) {
+         for (i = 0; i < rect.h; i++) {
+            SDL_memcpy(&pixels[i * rect.w], (Uint8 *)converted->pixels + i * converted->pitch, rect.w * sizeof(Uint32));
+         }
+         SDL_FreeSurface(converted);
+      }
+      texture = SDL_CreateTextureFromSurface(sw, source);
+      SDLTest_AssertCheck(texture != NULL, "Verify SDL_CreateTextureFromSurface() result");
+      SDL_FreeSurface(source);
+      if (texture == NULL) {
+         continue;
+      }
+      SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_NONE);
+
+      for (q = 0; q < SDL_arraysize(qualities); q++) {
+         SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, qualities[q]);
+         checkFailCount1 = 0;
+         for (a = 0; a < SDL_arraysize(angles); a++) {
+            for (f = 0; f < SDL_arraysize(flips); f++) {
+               SDL_RenderClear(sw);
+               ret = SDL_RenderCopyEx(sw, texture, NULL, &rect, angles[a], NULL, flips[f]);
+               SDL_RenderFlush(sw);
+               if (ret != 0) {
+                  checkFailCount1++;
+                  continue;
+               }
+
+               SDL_FillRect(reference, NULL, SDL_MapRGB(reference->format, 32, 64, 96));
+               _drawRotateReference(reference, pixels, &rect, angles[a], q, flips[f]);
+               if (SDLTest_CompareSurfaces(target, reference, 0) != 0) {
+                  SDLTest_LogError("Rotated copy differs at %i degrees with flip %i", (int)angles[a], (int)flips[f]);
+                  checkFailCount1++;
+               }
+            }
+         }
+         SDLTest_AssertCheck(checkFailCount1 == 0, "Validate %i-bit copies with %s sampling, expected: 0 failures, got: %i",
+                             bits, qualities[q], checkFailCount1);
+      }
+      SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, NULL);
+      SDL_DestroyTexture(texture);
+   }
+
+   SDL_DestroyRenderer(sw);
+   SDL_FreeSurface(reference);
+   SDL_FreeSurface(target);
+
+   return TEST_COMPLETED;
+}
+
+#define PARTIAL_FRAMES 6
+
+/* Draws one frame of a scene that only touches parts of the output after the first clear */
+static void
+_drawPartialUpdate(SDL_Renderer *target, SDL_Texture *tface, int frame)
+{
+   SDL_Rect rect, clip;
+   int i;
+
+   switch (frame) {
+   case 0:
+      SDL_SetRenderDrawColor(target, 40, 40, 40, SDL_ALPHA_OPAQUE);
+      SDL_RenderClear(target);
+      break;
+   case 1:
+      /* Overlapping fills and copies */
+      SDL_SetRenderDrawBlendMode(target, SDL_BLENDMODE_NONE);
+      SDL_SetRenderDrawColor(target, 255, 0, 0, SDL_ALPHA_OPAQUE);
+      rect.x = 20; rect.y = 20; rect.w = 60; rect.h = 40;
+      SDL_RenderFillRect(target, &rect);
+      SDL_SetRenderDrawBlendMode(target, SDL_BLENDMODE_BLEND);
+      SDL_SetRenderDrawColor(target, 0, 255, 0, 128);
+      rect.x = 50; rect.y = 40;
+      SDL_RenderFillRect(target, &rect);
+      rect.x = 100; rect.y = 30; rect.w = 42; rect.h = 42;
+      SDL_RenderCopy(target, tface, NULL, &rect);
+      rect.x = 120; rect.y = 50;
+      SDL_RenderCopy(target, tface, NULL, &rect);
+      break;
+   case 2:
+      /* Adjacent fills and copies */
+      SDL_SetRenderDrawBlendMode(target, SDL_BLENDMODE_NONE);
+      for (i = 0; i < 8; i++) {
+         SDL_SetRenderDrawColor(target, i * 30, 255 - i * 30, 128, SDL_ALPHA_OPAQUE);
+         rect.x = i * 16; rect.y = 150; rect.w = 16; rect.h = 16;
+         SDL_RenderFillRect(target, &rect);
+         rect.x = 140; rect.y = 100 + i * 16;
+         SDL_RenderFillRect(target, &rect);
+      }
+      rect.x = 200; rect.y = 100; rect.w = 42; rect.h = 42;
+      SDL_RenderCopy(target, tface, NULL, &rect);
+      rect.x += rect.w;
+      SDL_RenderCopy(target, tface, NULL, &rect);
+      rect.y += rect.h;
+      SDL_RenderCopy(target, tface, NULL, &rect);
+      break;
+   case 3:
+      /* More separate areas than the renderer keeps track of */
+      SDL_SetRenderDrawBlendMode(target, SDL_BLENDMODE_ADD);
+      for (i = 0; i < 40; i++) {
+         SDL_SetRenderDrawColor(target, (i * 5) & 0xFF, (i * 9) & 0xFF, (i * 13) & 0xFF, SDL_ALPHA_OPAQUE);
+         rect.x = (i * 37) % 300; rect.y = (i * 53) % 220; rect.w = 4 + i % 5; rect.h = 3 + i % 7;
+         SDL_RenderFillRect(target, &rect);
+      }
+      SDL_SetRenderDrawColor(target, 255, 255, 255, SDL_ALPHA_OPAQUE);
+      SDL_RenderDrawLine(target, 10, 230, 300, 200);
+      SDL_RenderDrawPoint(target, 315, 5);
+      SDL_RenderDrawPoint(target, 2, 237);
+      break;
+   case 4:
+      /* Clipped and rotated */
+      clip.x = 150; clip.y = 10; clip.w = 100; clip.h = 80;
+      SDL_RenderSetClipRect(target, &clip);
+      SDL_SetRenderDrawBlendMode(target, SDL_BLENDMODE_BLEND);
+      SDL_SetRenderDrawColor(target, 0, 0, 255, 160);
+      rect.x = 130; rect.y = 0; rect.w = 150; rect.h = 120;
+      SDL_RenderFillRect(target, &rect);
+      SDL_RenderSetClipRect(target, NULL);
+      rect.x = 230; rect.y = 170; rect.w = 50; rect.h = 40;
+      SDL_RenderCopyEx(target, tface, NULL, &rect, 30.0, NULL, SDL_FLIP_NONE);
+      break;
+   default:
+      /* Redraw over areas changed by earlier frames */
+      SDL_SetRenderDrawBlendMode(target, SDL_BLENDMODE_NONE);
+      SDL_SetRenderDrawColor(target, 0, 0, 255, SDL_ALPHA_OPAQUE);
+      rect.x = 30; rect.y = 30; rect.w = 40; rect.h = 40;
+      SDL_RenderFillRect(target, &rect);
+      rect.x = 110; rect.y = 40; rect.w = 42; rect.h = 42;
+      SDL_RenderCopy(target, tface, NULL, &rect);
+      break;
+   }
+}
+
+/**
+ * @brief Tests that presenting partial updates to a window matches a full redraw.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_RenderPresent
+ * http://wiki.libsdl.org/moin.cgi/SDL_HINT_RENDER_SW_THREADS
+ */
+int
+render_testPartialUpdates(void *arg)
+{
+   SDL_Surface *face, *reference = NULL, *presented = NULL;
+   SDL_Renderer *sw = NULL, *windowed;
+   SDL_Texture *tface = NULL, *twindowed;
+   SDL_Window *win;
+   const char *threads[2] = { "1", "4" };
+   int ret, i, t;
+
+   face = SDLTest_ImageFace();
+   SDLTest_AssertCheck(face != NULL, "Verify SDLTest_ImageFace() result");
+   if (face == NULL) {
+       return TEST_ABORTED;
+   }
+
+   /* The reference draws the whole scene in one frame */
+   reference = SDL_CreateRGBSurfaceWithFormat(0, 320, 240, 32, SDL_PIXELFORMAT_RGB888);
+   presented = SDL_CreateRGBSurfaceWithFormat(0, 320, 240, 32, SDL_PIXELFORMAT_RGB888);
+   sw = reference ? SDL_CreateSoftwareRenderer(reference) : NULL;
+   tface = sw ? SDL_CreateTextureFromSurface(sw, face) : NULL;
+   SDLTest_AssertCheck(tface != NULL && presented != NULL, "Verify reference renderer");
+   if (tface == NULL || presented == NULL) {
+      goto done;
+   }
+   SDL_SetTextureBlendMode(tface, SDL_BLENDMODE_BLEND);
+   for (i = 0; i < PARTIAL_FRAMES; i++) {
+      _drawPartialUpdate(sw, tface, i);
+   }
+   SDL_RenderPresent(sw);
+
+   /* The window presents each frame, single threaded and in tiles */
+   for (t = 0; t < 2; t++) {
+      win = SDL_CreateWindow("render_testPartialUpdates", 100, 100, 320, 240, 0);
+      SDLTest_AssertCheck(win != NULL, "Verify SDL_CreateWindow() result");
+      if (win == NULL) {
+         break;
+      }
+      SDL_SetHint(SDL_HINT_RENDER_SW_THREADS, threads[t]);
+      windowed = SDL_CreateRenderer(win, -1, SDL_RENDERER_SOFTWARE);
+      SDL_SetHint(SDL_HINT_RENDER_SW_THREADS, NULL);
+      SDLTest_AssertCheck(windowed != NULL, "Verify SDL_CreateRenderer() with %s thread(s)", threads[t]);
+      if (windowed == NULL) {
+         SDL_DestroyWindow(win);
+         break;
+      }
+      twindowed = SDL_CreateTextureFromSurface(windowed, face);
+      SDLTest_AssertCheck(twindowed != NULL, "Verify SDL_CreateTextureFromSurface() result");
+      if (twindowed != NULL) {
+         SDL_SetTextureBlendMode(twindowed, SDL_BLENDMODE_BLEND);
+         for (i = 0; i < PARTIAL_FRAMES; i++) {
+            _drawPartialUpdate(windowed, twindowed, i);
+            SDL_RenderPresent(windowed);
+         }
+
+         ret = SDL_RenderReadPixels(windowed, NULL, presented->format->format, presented->pixels, presented->pitch);
+         SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderReadPixels, expected: 0, got: %i", ret);
+         ret = SDLTest_CompareSurfaces(presented, reference, 0);
+         SDLTest_AssertCheck(ret == 0, "Validate presented frames with %s thread(s), expected: 0, got: %i", threads[t], ret);
+         SDL_DestroyTexture(twindowed);
+      }
+      SDL_DestroyRenderer(windowed);
+      SDL_DestroyWindow(win);
+   }
+
+done:
+   if (tface) {
+      SDL_DestroyTexture(tface);
+   }
+   if (sw) {
+      SDL_DestroyRenderer(sw);
+   }
+   SDL_FreeSurface(presented);
+   SDL_FreeSurface(reference);
+   SDL_FreeSurface(face);
+
+   return TEST_COMPLETED;
+}
+
+
+/**
+ * @brief Tests that queued (batched) rendering matches immediate rendering.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_CreateSoftwareRenderer
+ * http://wiki.libsdl.org/moin.cgi/SDL_RenderCopy
+ */
+int
+render_testBatching(void *arg)
+{
+   int ret;
+   SDL_Rect rect;
+   SDL_Surface *face;
+   SDL_Surface *target;
+   SDL_Surface *referenceSurface = NULL;
+   SDL_Renderer *batched;
+   SDL_Texture *tface;
+   int i, j, ni, nj;
+   int checkFailCount1;
+
+   face = SDLTest_ImageFace();
+   SDLTest_AssertCheck(face != NULL, "Verify SDLTest_ImageFace() result");
+   if (face == NULL) {
+       return TEST_ABORTED;
+   }
+
+   target = SDL_CreateRGBSurface(0, TESTRENDER_SCREEN_W, TESTRENDER_SCREEN_H, 32,
+       RENDER_COMPARE_RMASK, RENDER_COMPARE_GMASK, RENDER_COMPARE_BMASK, RENDER_COMPARE_AMASK);
+   SDLTest_AssertCheck(target != NULL, "Verify SDL_CreateRGBSurface() result");
+   if (target == NULL) {
+       SDL_FreeSurface(face);
+       return TEST_ABORTED;
+   }
+
+   SDL_SetHint(SDL_HINT_RENDER_BATCHING, "1");
+   batched = SDL_CreateSoftwareRenderer(target);
+   SDL_SetHint(SDL_HINT_RENDER_BATCHING, NULL);
+   SDLTest_AssertCheck(batched != NULL, "Verify SDL_CreateSoftwareRenderer() result");
+   if (batched == NULL) {
+       SDL_FreeSurface(target);
+       SDL_FreeSurface(face);
+       return TEST_ABORTED;
+   }
+
+   tface = SDL_CreateTextureFromSurface(batched, face);
+   SDLTest_AssertCheck(tface != NULL, "Verify SDL_CreateTextureFromSurface() result");
+   rect.w = face->w;
+   rect.h = face->h;
+   SDL_FreeSurface(face);
+   if (tface == NULL) {
+       SDL_DestroyRenderer(batched);
+       SDL_FreeSurface(target);
+       return TEST_ABORTED;
+   }
+
+   SDL_SetRenderDrawColor(batched, 0, 0, 0, SDL_ALPHA_OPAQUE);
+   SDL_RenderClear(batched);
+
+   /* Same pattern as render_testBlit, but nothing is drawn until the flush. */
+   ni     = TESTRENDER_SCREEN_W - rect.w;
+   nj     = TESTRENDER_SCREEN_H - rect.h;
+   checkFailCount1 = 0;
+   for (j=0; j <= nj; j+=4) {
+      for (i=0; i <= ni; i+=4) {
+         rect.x = i;
+         rect.y = j;
+         ret = SDL_RenderCopy(batched, tface, NULL, &rect);
+         if (ret != 0) checkFailCount1++;
+      }
+   }
+   SDLTest_AssertCheck(checkFailCount1 == 0, "Validate results from calls to SDL_RenderCopy, expected: 0, got: %i", checkFailCount1);
+
+   ret = SDL_RenderFlush(batched);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderFlush, expected: 0, got: %i", ret);
+
+   referenceSurface = SDLTest_ImageBlit();
+   if (referenceSurface != NULL) {
+      SDL_Surface *converted = SDL_ConvertSurfaceFormat(referenceSurface, RENDER_COMPARE_FORMAT, 0);
+      ret = SDLTest_CompareSurfaces(target, converted, ALLOWABLE_ERROR_OPAQUE);
+      SDLTest_AssertCheck(ret == 0, "Validate result from SDLTest_CompareSurfaces, expected: 0, got: %i", ret);
+      SDL_FreeSurface(converted);
+      SDL_FreeSurface(referenceSurface);
+   }
+
+   /* Clean up. */
+   SDL_DestroyTexture(tface);
+   SDL_DestroyRenderer(batched);
+   SDL_FreeSurface(target);
+
+   return TEST_COMPLETED;
+}
+
+
+/**
+ * @brief Tests that textured quads drawn as triangles match plain blits.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_RenderGeometry
+ */
+int
+render_testGeometry(void *arg)
+{
+   int ret;
+   SDL_Texture *tface;
+   SDL_Surface *referenceSurface = NULL;
+   SDL_Vertex verts[4];
+   const int indices[6] = { 0, 1, 2, 2, 1, 3 };
+   Uint32 tformat;
+   int taccess, tw, th;
+   int i, j, k, ni, nj;
+   int checkFailCount1;
+
+   /* Clear surface. */
+   _clearScreen();
+
+   /* Create face surface. */
+   tface = _loadTestFace();
+   SDLTest_AssertCheck(tface != NULL,  "Verify _loadTestFace() result");
+   if (tface == NULL) {
+       return TEST_ABORTED;
+   }
+
+   ret = SDL_QueryTexture(tface, &tformat, &taccess, &tw, &th);
+   SDLTest_AssertCheck(ret == 0, "Verify result from SDL_QueryTexture, expected 0, got %i", ret);
+   ni     = TESTRENDER_SCREEN_W - tw;
+   nj     = TESTRENDER_SCREEN_H - th;
+
+   for (k = 0; k < 4; k++) {
+      verts[k].color.r = verts[k].color.g = verts[k].color.b = verts[k].color.a = 255;
+      verts[k].tex_coord.x = (float)(k & 1);
+      verts[k].tex_coord.y = (float)(k >> 1);
+   }
+
+   /* Same pattern as render_testBlit, each face drawn as two triangles. */
+   checkFailCount1 = 0;
+   for (j=0; j <= nj; j+=4) {
+      for (i=0; i <= ni; i+=4) {
+         for (k = 0; k < 4; k++) {
+            verts[k].position.x = (float)(i + (k & 1) * tw);
+            verts[k].position.y = (float)(j + (k >> 1) * th);
+         }
+         ret = SDL_RenderGeometry(renderer, tface, verts, 4, indices, 6);
+         if (ret != 0) checkFailCount1++;
+      }
+   }
+   if (checkFailCount1 > 0 && SDL_strcmp(SDL_GetError(), "Renderer does not support RenderGeometry") == 0) {
+      SDL_DestroyTexture(tface);
+      return TEST_SKIPPED;
+   }
+   SDLTest_AssertCheck(checkFailCount1 == 0, "Validate results from calls to SDL_RenderGeometry, expected: 0, got: %i", checkFailCount1);
+
+   /* Make current */
+   SDL_RenderPresent(renderer);
+
+   /* See if it's the same */
+   referenceSurface = SDLTest_ImageBlit();
+   _compare(referenceSurface, ALLOWABLE_ERROR_OPAQUE );
+
+   /* Clean up. */
+   SDL_DestroyTexture( tface );
+   SDL_FreeSurface(referenceSurface);
+   referenceSurface = NULL;
+
+   return TEST_COMPLETED;
+}
+
+
+static void
+_drawTilesPattern(SDL_Renderer *target, SDL_Texture *tface)
+{
+   SDL_Rect rect, rects[2];
+   SDL_Vertex verts[3];
+   int i;
+
+   SDL_SetRenderDrawColor(target, 0, 0, 0, SDL_ALPHA_OPAQUE);
+   SDL_RenderClear(target);
+   for (i = 0; i < 200; i++) {
+      rect.x = (i * 37) % TESTRENDER_SCREEN_W - 20;
+      rect.y = (i * 53) % TESTRENDER_SCREEN_H - 20;
+      rect.w = 10 + (i * 7) % 60;
+      rect.h = 10 + (i * 11) % 60;
+      SDL_SetRenderDrawColor(target, (i * 5) & 0xFF, (i * 9) & 0xFF, (i * 13) & 0xFF, (i * 17) & 0xFF);
+      SDL_SetRenderDrawBlendMode(target, (i & 1) ? SDL_BLENDMODE_BLEND : SDL_BLENDMODE_ADD);
+      switch (i % 5) {
+      case 0:
+         SDL_RenderFillRect(target, &rect);
+         break;
+      case 1:
+         if (i & 2) {
+            rects[0] = rect;
+            rects[0].w = rects[0].h = 32;
+            rects[1] = rects[0];
+            rects[1].x += 40;
+            SDL_RenderCopyBatch(target, tface, NULL, rects, NULL, 2);
+         } else {
+            SDL_RenderCopy(target, tface, NULL, &rect);
+         }
+         break;
+      case 2:
+         rect.w = rect.h = 42;
+         SDL_RenderCopy(target, tface, NULL, &rect);
+         break;
+      case 3:
+         SDL_RenderDrawLine(target, rect.x, rect.y, rect.x + rect.w, rect.y + rect.h);
+         break;
+      default:
+         verts[0].position.x = (float)rect.x;
+         verts[0].position.y = (float)rect.y;
+         verts[1].position.x = (float)(rect.x + rect.w);
+         verts[1].position.y = rect.y + 0.5f;
+         verts[2].position.x = rect.x + 3.25f;
+         verts[2].position.y = (float)(rect.y + rect.h);
+         verts[0].color.r = 255; verts[0].color.g = 0; verts[0].color.b = 0; verts[0].color.a = 255;
+         verts[1].color.r = 0; verts[1].color.g = 255; verts[1].color.b = 0; verts[1].color.a = 128;
+         verts[2].color.r = 0; verts[2].color.g = 0; verts[2].color.b = 255; verts[2].color.a = 64;
+         verts[0].tex_coord.x = 0.0f; verts[0].tex_coord.y = 0.0f;
+         verts[1].tex_coord.x = 1.0f; verts[1].tex_coord.y = 0.0f;
+         verts[2].tex_coord.x = 0.0f; verts[2].tex_coord.y = 1.0f;
+         SDL_RenderGeometry(target, (i & 2) ? tface : NULL, verts, 3, NULL, 0);
+         break;
+      }
+   }
+   SDL_RenderFlush(target);
+}
+
+/**
+ * @brief Tests that the threaded software renderer matches the single threaded one.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_CreateSoftwareRenderer
+ */
+int
+render_testThreadedTiles(void *arg)
+{
+   SDL_Surface *face;
+   SDL_Surface *targets[2] = { NULL, NULL };
+   SDL_Renderer *renderers[2] = { NULL, NULL };
+   SDL_Texture *textures[2] = { NULL, NULL };
+   const char *threads[2] = { "1", "4" };
+   int ret, i;
+
+   face = SDLTest_ImageFace();
+   SDLTest_AssertCheck(face != NULL, "Verify SDLTest_ImageFace() result");
+   if (face == NULL) {
+       return TEST_ABORTED;
+   }
+
+   for (i = 0; i < 2; i++) {
+      targets[i] = SDL_CreateRGBSurface(0, TESTRENDER_SCREEN_W, TESTRENDER_SCREEN_H, 32,
+          RENDER_COMPARE_RMASK, RENDER_COMPARE_GMASK, RENDER_COMPARE_BMASK, RENDER_COMPARE_AMASK);
+      SDLTest_AssertCheck(targets[i] != NULL, "Verify SDL_CreateRGBSurface() result");
+      if (targets[i] == NULL) {
+         break;
+      }
+      SDL_SetHint(SDL_HINT_RENDER_SW_THREADS, threads[i]);
+      renderers[i] = SDL_CreateSoftwareRenderer(targets[i]);
+      SDL_SetHint(SDL_HINT_RENDER_SW_THREADS, NULL);
+      SDLTest_AssertCheck(renderers[i] != NULL, "Verify SDL_CreateSoftwareRenderer() with %s thread(s)", threads[i]);
+      if (renderers[i] == NULL) {
+         break;
+      }
+      textures[i] = SDL_CreateTextureFromSurface(renderers[i], face);
+      SDLTest_AssertCheck(textures[i] != NULL, "Verify SDL_CreateTextureFromSurface() result");
+      if (textures[i] == NULL) {
+         break;
+      }
+      SDL_SetTextureBlendMode(textures[i], SDL_BLENDMODE_BLEND);
+      _drawTilesPattern(renderers[i], textures[i]);
+   }
+
+   if (i == 2) {
+      ret = SDLTest_CompareSurfaces(targets[1], targets[0], 0);
+      SDLTest_AssertCheck(ret == 0, "Validate result from SDLTest_CompareSurfaces, expected: 0, got: %i", ret);
+   }
+
+   /* Clean up. */
+   for (i = 0; i < 2; i++) {
+      if (textures[i]) {
+         SDL_DestroyTexture(textures[i]);
+      }
+      if (renderers[i]) {
+         SDL_DestroyRenderer(renderers[i]);
+      }
+      if (targets[i]) {
+         SDL_FreeSurface(targets[i]);
+      }
+   }
+   SDL_FreeSurface(face);
+
+   return TEST_COMPLETED;
+}
+
+
+/**
+ * @brief Tests that batched copies match single copies, with and without colors.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_RenderCopyBatch
+ */
+int
+render_testCopyBatch(void *arg)
+{
+   int ret;
+   SDL_Texture *tface;
+   SDL_Surface *referenceSurface = NULL;
+   SDL_Rect *rects;
+   SDL_Color *colors;
+   Uint32 tformat;
+   int taccess, tw, th;
+   int i, j, ni, nj, n;
+
+   /* Clear surface. */
+   _clearScreen();
+
+   /* Create face surface. */
+   tface = _loadTestFace();
+   SDLTest_AssertCheck(tface != NULL, "Verify _loadTestFace() result");
+   if (tface == NULL) {
+       return TEST_ABORTED;
+   }
+
+   ret = SDL_QueryTexture(tface, &tformat, &taccess, &tw, &th);
+   SDLTest_AssertCheck(ret == 0, "Verify result from SDL_QueryTexture, expected 0, got %i", ret);
+   ni     = TESTRENDER_SCREEN_W - tw;
+   nj     = TESTRENDER_SCREEN_H - th;
+
+   /* Same pattern as render_testBlit and render_testBlitColor. */
+   rects = (SDL_Rect *) SDL_malloc((ni/4 + 1) * (nj/4 + 1) * sizeof(SDL_Rect));
+   colors = (SDL_Color *) SDL_malloc((ni/4 + 1) * (nj/4 + 1) * sizeof(SDL_Color));
+   if (rects == NULL || colors == NULL) {
+       SDL_free(rects);
+       SDL_free(colors);
+       SDL_DestroyTexture(tface);
+       return TEST_ABORTED;
+   }
+   n = 0;
+   for (j=0; j <= nj; j+=4) {
+      for (i=0; i <= ni; i+=4) {
+         rects[n].x = i;
+         rects[n].y = j;
+         rects[n].w = tw;
+         rects[n].h = th;
+         colors[n].r = (255/nj)*j;
+         colors[n].g = (255/ni)*i;
+         colors[n].b = (255/nj)*j;
+         colors[n].a = 255;
+         n++;
+      }
+   }
+
+   ret = SDL_RenderCopyBatch(renderer, tface, NULL, rects, NULL, n);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderCopyBatch, expected: 0, got: %i", ret);
+
+   /* Make current */
+   SDL_RenderPresent(renderer);
+
+   /* See if it's the same */
+   referenceSurface = SDLTest_ImageBlit();
+   _compare(referenceSurface, ALLOWABLE_ERROR_OPAQUE );
+   SDL_FreeSurface(referenceSurface);
+
+   /* Again with a color per copy. */
+   _clearScreen();
+   ret = SDL_RenderCopyBatch(renderer, tface, NULL, rects, colors, n);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderCopyBatch with colors, expected: 0, got: %i", ret);
+
+   /* Make current */
+   SDL_RenderPresent(renderer);
+
+   /* See if it's the same */
+   referenceSurface = SDLTest_ImageBlitColor();
+   _compare(referenceSurface, ALLOWABLE_ERROR_OPAQUE );
+
+   /* Clean up. */
+   SDL_free(rects);
+   SDL_free(colors);
+   SDL_DestroyTexture( tface );
+   SDL_FreeSurface(referenceSurface);
+   referenceSurface = NULL;
+
+   return TEST_COMPLETED;
+}
+
+
+/**
+ * @brief Tests the frame statistics of the renderer.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_RenderGetStats
+ * http://wiki.libsdl.org/moin.cgi/SDL_RenderPresent
+ */
+int
+render_testRenderStats(void *arg)
+{
+   int ret;
+   SDL_Texture *texture;
+   SDL_RenderStats stats;
+   SDL_Rect rect;
+   Uint32 pixels[16 * 16];
+   int w, h;
+
+   /* Start a new frame. */
+   SDL_RenderPresent(renderer);
+   ret = SDL_GetRendererOutputSize(renderer, &w, &h);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_GetRendererOutputSize, expected: 0, got: %i", ret);
+
+   texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING, 16, 16);
+   SDLTest_AssertCheck(texture != NULL, "Verify SDL_CreateTexture() result");
+   if (texture == NULL) {
+       return TEST_ABORTED;
+   }
+   SDL_memset(pixels, 0xff, sizeof(pixels));
+   ret = SDL_UpdateTexture(texture, NULL, pixels, 16 * sizeof(Uint32));
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_UpdateTexture, expected: 0, got: %i", ret);
+
+   /* One clear, an opaque and a blended fill and an opaque copy of the whole target. */
+   ret = SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_SetRenderDrawBlendMode, expected: 0, got: %i", ret);
+   ret = SDL_RenderClear(renderer);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderClear, expected: 0, got: %i", ret);
+   rect.x = 10;
+   rect.y = 10;
+   rect.w = 10;
+   rect.h = 20;
+   ret = SDL_RenderFillRect(renderer, &rect);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderFillRect, expected: 0, got: %i", ret);
+   ret = SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_SetRenderDrawBlendMode, expected: 0, got: %i", ret);
+   rect.w = 5;
+   rect.h = 5;
+   ret = SDL_RenderFillRect(renderer, &rect);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderFillRect, expected: 0, got: %i", ret);
+   ret = SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_NONE);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_SetTextureBlendMode, expected: 0, got: %i", ret);
+   ret = SDL_RenderCopy(renderer, texture, NULL, NULL);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderCopy, expected: 0, got: %i", ret);
+
+   /* Nothing is reported before the frame is presented. */
+   ret = SDL_RenderGetStats(renderer, &stats);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderGetStats, expected: 0, got: %i", ret);
+   SDLTest_AssertCheck(stats.draw_calls == 0, "Validate draw calls before presenting, expected: 0, got: %u", stats.draw_calls);
+
+   SDL_RenderPresent(renderer);
+   ret = SDL_RenderGetStats(renderer, &stats);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderGetStats, expected: 0, got: %i", ret);
+   SDLTest_AssertCheck(stats.draw_calls == 4, "Validate draw calls, expected: 4, got: %u", stats.draw_calls);
+   SDLTest_AssertCheck(stats.texture_uploads == 1, "Validate texture uploads, expected: 1, got: %u", stats.texture_uploads);
+   SDLTest_AssertCheck(stats.upload_bytes == sizeof(pixels), "Validate upload bytes, expected: %u, got: %u",
+                       (unsigned) sizeof(pixels), (unsigned) stats.upload_bytes);
+   SDLTest_AssertCheck(stats.pixels_filled == (Uint64) (w * h * 2 + 200),
+                       "Validate filled pixels, expected: %i, got: %u", w * h * 2 + 200, (unsigned) stats.pixels_filled);
+   SDLTest_AssertCheck(stats.pixels_blended == 25, "Validate blended pixels, expected: 25, got: %u", (unsigned) stats.pixels_blended);
+
+   /* The next frame starts from zero. */
+   SDL_RenderPresent(renderer);
+   ret = SDL_RenderGetStats(renderer, &stats);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderGetStats, expected: 0, got: %i", ret);
+   SDLTest_AssertCheck(stats.draw_calls == 0, "Validate draw calls of an empty frame, expected: 0, got: %u", stats.draw_calls);
+   SDLTest_AssertCheck(stats.texture_uploads == 0, "Validate texture uploads of an empty frame, expected: 0, got: %u", stats.texture_uploads);
+
+   ret = SDL_RenderGetStats(renderer, NULL);
+   SDLTest_AssertCheck(ret == -1, "Validate result from SDL_RenderGetStats with NULL stats, expected: -1, got: %i", ret);
+
+   SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+   SDL_DestroyTexture(texture);
+
+   return TEST_COMPLETED;
+}
+
 
 /**
  * @brief Blits doing color tests.
@@ -1090,9 +1982,30 @@ static const SDLTest_TestCaseReference renderTest6 =
 static const SDLTest_TestCaseReference renderTest7 =
         {  (SDLTest_TestCaseFp)render_testBlitBlend, "render_testBlitBlend", "Tests blitting with blending", TEST_DISABLED };
 
+static const SDLTest_TestCaseReference renderTest8 =
+        { (SDLTest_TestCaseFp)render_testBatching, "render_testBatching", "Tests queued rendering with SDL_HINT_RENDER_BATCHING", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference renderTest9 =
+        { (SDLTest_TestCaseFp)render_testGeometry, "render_testGeometry", "Tests drawing textured triangles", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference renderTest10 =
+        { (SDLTest_TestCaseFp)render_testThreadedTiles, "render_testThreadedTiles", "Tests drawing with SDL_HINT_RENDER_SW_THREADS", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference renderTest11 =
+        { (SDLTest_TestCaseFp)render_testCopyBatch, "render_testCopyBatch", "Tests drawing many copies of a texture at once", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference renderTest12 =
+        { (SDLTest_TestCaseFp)render_testRenderStats, "render_testRenderStats", "Tests the renderer frame statistics", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference renderTest13 =
+        { (SDLTest_TestCaseFp)render_testRotate, "render_testRotate", "Tests rotated and flipped copies", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference renderTest14 =
+        { (SDLTest_TestCaseFp)render_testPartialUpdates, "render_testPartialUpdates", "Tests presenting partial updates to a window", TEST_ENABLED };
+
 /* Sequence of Render test cases */
 static const SDLTest_TestCaseReference *renderTests[] =  {
-    &renderTest1, &renderTest2, &renderTest3, &renderTest4, &renderTest5, &renderTest6, &renderTest7, NULL
+    &renderTest1, &renderTest2, &renderTest3, &renderTest4, &renderTest5, &renderTest6, &renderTest7, &renderTest8, &renderTest9, &renderTest10, &renderTest11, &renderTest12, &renderTest13, &renderTest14, NULL
 };
 
 /* Render test suite (global) */
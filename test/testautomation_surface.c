@@ -593,6 +593,1189 @@ surface_testBlitBlendLoop(void *arg) {
 
 }
 
+/* Where a linear stretch samples the source for destination pixel i, in 16.16 fixed point */
+static int
+_stretchSamplePosition(int i, int src_len, int dst_len)
+{
+    Sint64 p = ((Sint64) (2 * i + 1) * src_len * 0x8000) / dst_len - 0x8000;
+
+    if (p < 0) {
+        return 0;
+    }
+    if (p > (Sint64) (src_len - 1) << 16) {
+        return (src_len - 1) << 16;
+    }
+    return (int) p;
+}
+
+static Uint8
+_lerpChannel(Uint8 a, Uint8 b, int f)
+{
+    return (Uint8) ((a * (256 - f) + b * f) >> 8);
+}
+
+/**
+ * @brief Tests SDL_SoftStretchLinear against a plain per channel implementation.
+ */
+int
+surface_testSoftStretchLinear(void *arg)
+{
+    const int sizes[][2] = { { 37, 5 }, { 83, 11 }, { 17, 3 }, { 1, 1 } };
+    SDL_Surface *src, *dst;
+    Uint32 *pixels;
+    int ret, i, x, y, c, errors;
+
+    src = SDL_CreateRGBSurfaceWithFormat(0, 37, 5, 32, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(src != NULL, "Verify source surface is not NULL");
+    if (src == NULL) {
+        return TEST_ABORTED;
+    }
+    pixels = (Uint32 *) src->pixels;
+    for (y = 0; y < src->h; y++) {
+        for (x = 0; x < src->w; x++) {
+            pixels[y * src->pitch / 4 + x] = (Uint32) (x * 2654435761u + y * 40503u);
+        }
+    }
+
+    for (i = 0; i < SDL_arraysize(sizes); i++) {
+        dst = SDL_CreateRGBSurfaceWithFormat(0, sizes[i][0], sizes[i][1], 32, SDL_PIXELFORMAT_ARGB8888);
+        SDLTest_AssertCheck(dst != NULL, "Verify destination surface is not NULL");
+        if (dst == NULL) {
+            break;
+        }
+        ret = SDL_SoftStretchLinear(src, NULL, dst, NULL);
+        SDLTest_AssertCheck(ret == 0, "Validate result from SDL_SoftStretchLinear to %dx%d, expected: 0, got: %i", dst->w, dst->h, ret);
+
+        errors = 0;
+        for (y = 0; y < dst->h; y++) {
+            const int py = _stretchSamplePosition(y, src->h, dst->h);
+            const int y0 = py >> 16, y1 = SDL_min(y0 + 1, src->h - 1), fy = (py >> 8) & 0xFF;
+
+            for (x = 0; x < dst->w; x++) {
+                const int px = _stretchSamplePosition(x, src->w, dst->w);
+                const int x0 = px >> 16, x1 = SDL_min(x0 + 1, src->w - 1), fx = (px >> 8) & 0xFF;
+                Uint32 expected = 0;
+
+                for (c = 0; c < 32; c += 8) {
+                    const Uint8 p00 = (Uint8) (pixels[y0 * src->pitch / 4 + x0] >> c);
+                    const Uint8 p01 = (Uint8) (pixels[y0 * src->pitch / 4 + x1] >> c);
+                    const Uint8 p10 = (Uint8) (pixels[y1 * src->pitch / 4 + x0] >> c);
+                    const Uint8 p11 = (Uint8) (pixels[y1 * src->pitch / 4 + x1] >> c);
+
+                    expected |= (Uint32) _lerpChannel(_lerpChannel(p00, p10, fy), _lerpChannel(p01, p11, fy), fx) << c;
+                }
+                if (((Uint32 *) dst->pixels)[y * dst->pitch / 4 + x] != expected) {
+                    errors++;
+                }
+            }
+        }
+        SDLTest_AssertCheck(errors == 0, "Validate filtered pixels at %dx%d, expected: 0 errors, got: %i", dst->w, dst->h, errors);
+        SDL_FreeSurface(dst);
+    }
+
+    SDL_FreeSurface(src);
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests unblended color and alpha modulated blits between 32-bit formats.
+ */
+int
+surface_testModulatedBlit(void *arg)
+{
+    const Uint32 formats[][2] = {
+        { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888 },
+        { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888 },
+        { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ABGR8888 },
+        { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888 }
+    };
+    const int widths[] = { 1, 3, 4, 7, 29 };
+    SDL_Surface *src, *dst;
+    SDL_Rect srcrect, dstrect;
+    Uint8 r, g, b, a;
+    int ret, i, j, x, y, errors;
+
+    for (i = 0; i < SDL_arraysize(formats); i++) {
+        src = SDL_CreateRGBSurfaceWithFormat(0, 33, 9, 32, formats[i][0]);
+        dst = SDL_CreateRGBSurfaceWithFormat(0, 33, 9, 32, formats[i][1]);
+        SDLTest_AssertCheck(src != NULL && dst != NULL, "Verify surfaces are not NULL");
+        if (src == NULL || dst == NULL) {
+            SDL_FreeSurface(src);
+            SDL_FreeSurface(dst);
+            return TEST_ABORTED;
+        }
+        for (y = 0; y < src->h; y++) {
+            for (x = 0; x < src->w; x++) {
+                ((Uint32 *) src->pixels)[y * src->pitch / 4 + x] = (Uint32) SDLTest_RandomUint32();
+            }
+        }
+        r = SDLTest_RandomUint8();
+        g = SDLTest_RandomUint8();
+        b = SDLTest_RandomUint8();
+        a = SDLTest_RandomUint8();
+        SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_NONE);
+        SDL_SetSurfaceColorMod(src, r, g, b);
+        SDL_SetSurfaceAlphaMod(src, a);
+
+        for (j = 0; j < SDL_arraysize(widths); j++) {
+            srcrect.x = j;
+            srcrect.y = 1;
+            srcrect.w = widths[j];
+            srcrect.h = 7;
+            dstrect.x = 3 - j % 3;
+            dstrect.y = j % 2;
+            SDL_FillRect(dst, NULL, 0);
+            ret = SDL_BlitSurface(src, &srcrect, dst, &dstrect);
+            SDLTest_AssertCheck(ret == 0, "Validate result from SDL_BlitSurface, expected: 0, got: %i", ret);
+
+            errors = 0;
+            for (y = 0; y < srcrect.h; y++) {
+                for (x = 0; x < srcrect.w; x++) {
+                    const Uint32 spixel = ((Uint32 *) src->pixels)[(srcrect.y + y) * src->pitch / 4 + srcrect.x + x];
+                    const Uint32 dpixel = ((Uint32 *) dst->pixels)[(dstrect.y + y) * dst->pitch / 4 + dstrect.x + x];
+                    Uint8 sr, sg, sb, sa, dr, dg, db, da;
+
+                    SDL_GetRGBA(spixel, src->format, &sr, &sg, &sb, &sa);
+                    SDL_GetRGBA(dpixel, dst->format, &dr, &dg, &db, &da);
+                    if (dr != sr * r / 255 || dg != sg * g / 255 || db != sb * b / 255 ||
+                        (dst->format->Amask && da != sa * a / 255) ||
+                        (!dst->format->Amask && (dpixel & 0xFF000000))) {
+                        errors++;
+                    }
+                }
+            }
+            SDLTest_AssertCheck(errors == 0, "Validate modulated pixels from %s to %s, %d pixels wide, expected: 0 errors, got: %i",
+                                SDL_GetPixelFormatName(formats[i][0]), SDL_GetPixelFormatName(formats[i][1]), srcrect.w, errors);
+        }
+
+        SDL_FreeSurface(src);
+        SDL_FreeSurface(dst);
+    }
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests alpha blended blits between 8888 surfaces against the reference blending math.
+ */
+int
+surface_testAlphaBlendedBlit(void *arg)
+{
+    const int widths[] = { 1, 3, 8, 13, 31 };
+    SDL_Surface *src, *dst;
+    SDL_Rect rect;
+    Uint32 *expected;
+    Uint8 alphamod;
+    int ret, i, j, x, y, c, errors;
+
+    expected = (Uint32 *) SDL_malloc(31 * 5 * sizeof(Uint32));
+    SDLTest_AssertCheck(expected != NULL, "Verify allocation");
+    if (expected == NULL) {
+        return TEST_ABORTED;
+    }
+
+    /* Pixel alpha with ARGB8888 source, then surface alpha with RGB888 source */
+    for (i = 0; i < 2; i++) {
+        src = SDL_CreateRGBSurfaceWithFormat(0, 31, 5, 32, i == 0 ? SDL_PIXELFORMAT_ARGB8888 : SDL_PIXELFORMAT_RGB888);
+        dst = SDL_CreateRGBSurfaceWithFormat(0, 31, 5, 32, SDL_PIXELFORMAT_ARGB8888);
+        SDLTest_AssertCheck(src != NULL && dst != NULL, "Verify surfaces are not NULL");
+        if (src == NULL || dst == NULL) {
+            SDL_FreeSurface(src);
+            SDL_FreeSurface(dst);
+            break;
+        }
+        SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_BLEND);
+        alphamod = SDLTest_RandomUint8();
+        if (i == 1) {
+            SDL_SetSurfaceAlphaMod(src, alphamod);
+        }
+
+        for (j = 0; j < SDL_arraysize(widths); j++) {
+            for (y = 0; y < 5; y++) {
+                for (x = 0; x < 31; x++) {
+                    Uint32 pixel = (Uint32) SDLTest_RandomUint32();
+
+                    /* Runs of transparent and opaque pixels take shortcuts */
+                    if ((x / 8) % 3 == 1) {
+                        pixel &= 0x00FFFFFF;
+                    } else if ((x / 8) % 3 == 2) {
+                        pixel |= 0xFF000000;
+                    }
+                    ((Uint32 *) src->pixels)[y * src->pitch / 4 + x] = pixel;
+                    ((Uint32 *) dst->pixels)[y * dst->pitch / 4 + x] = (Uint32) SDLTest_RandomUint32();
+                }
+            }
+            for (y = 0; y < 5; y++) {
+                for (x = 0; x < widths[j]; x++) {
+                    const Uint32 s = ((Uint32 *) src->pixels)[y * src->pitch / 4 + x];
+                    const Uint32 d = ((Uint32 *) dst->pixels)[y * dst->pitch / 4 + x];
+                    const Uint32 alpha = (i == 0) ? (s >> 24) : alphamod;
+                    Uint32 e = 0;
+
+                    if (i == 0 && alpha == 0) {
+                        e = d;
+                    } else if (i == 0 && alpha == 255) {
+                        e = s;
+                    } else {
+                        for (c = 0; c < 24; c += 8) {
+                            e |= (((((d >> c) & 0xFF) * (256 - alpha)) + (((s >> c) & 0xFF) * alpha)) >> 8) << c;
+                        }
+                        if (i == 0) {
+                            e |= (alpha + (((d >> 24) * (255 - alpha)) >> 8)) << 24;
+                        } else {
+                            e |= 0xFF000000;
+                        }
+                    }
+                    expected[y * 31 + x] = e;
+                }
+            }
+
+            rect.x = 0;
+            rect.y = 0;
+            rect.w = widths[j];
+            rect.h = 5;
+            ret = SDL_BlitSurface(src, &rect, dst, NULL);
+            SDLTest_AssertCheck(ret == 0, "Validate result from SDL_BlitSurface, expected: 0, got: %i", ret);
+
+            errors = 0;
+            for (y = 0; y < 5; y++) {
+                for (x = 0; x < widths[j]; x++) {
+                    if (((Uint32 *) dst->pixels)[y * dst->pitch / 4 + x] != expected[y * 31 + x]) {
+                        errors++;
+                    }
+                }
+            }
+            SDLTest_AssertCheck(errors == 0, "Validate %s alpha blended pixels, %d pixels wide, expected: 0 errors, got: %i",
+                                i == 0 ? "pixel" : "surface", widths[j], errors);
+        }
+
+        SDL_FreeSurface(src);
+        SDL_FreeSurface(dst);
+    }
+
+    SDL_free(expected);
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests modulated and blended blits between 8888 formats against the per pixel blitter math.
+ *
+ * Blending without modulation is taken by the SDL_blit_A.c blitters, so the
+ * blended cases modulate color, or color and alpha, to reach the generated ones.
+ */
+int
+surface_testGeneratedBlit(void *arg)
+{
+    const Uint32 srcformats[] = {
+        SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888,
+        SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGRA8888
+    };
+    const Uint32 dstformats[] = { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888 };
+    const char *kinds[] = { "modulate", "blend", "modulate+blend" };
+    SDL_Surface *src, *dst, *orig;
+    Uint8 r, g, b, a;
+    int ret, i, j, k, x, y, errors;
+
+    for (i = 0; i < SDL_arraysize(srcformats); i++) {
+        for (j = 0; j < SDL_arraysize(dstformats); j++) {
+            src = SDL_CreateRGBSurfaceWithFormat(0, 37, 3, 32, srcformats[i]);
+            dst = SDL_CreateRGBSurfaceWithFormat(0, 37, 3, 32, dstformats[j]);
+            orig = SDL_CreateRGBSurfaceWithFormat(0, 37, 3, 32, dstformats[j]);
+            SDLTest_AssertCheck(src != NULL && dst != NULL && orig != NULL, "Verify surfaces are not NULL");
+            if (src == NULL || dst == NULL || orig == NULL) {
+                SDL_FreeSurface(src);
+                SDL_FreeSurface(dst);
+                SDL_FreeSurface(orig);
+                return TEST_ABORTED;
+            }
+
+            for (k = 0; k < SDL_arraysize(kinds); k++) {
+                for (y = 0; y < src->h; y++) {
+                    for (x = 0; x < src->w; x++) {
+                        Uint32 pixel = (Uint32) SDLTest_RandomUint32();
+
+                        /* Runs of transparent and opaque pixels */
+                        if ((x / 8) % 3 == 1) {
+                            pixel &= ~src->format->Amask;
+                        } else if ((x / 8) % 3 == 2) {
+                            pixel |= src->format->Amask;
+                        }
+                        ((Uint32 *) src->pixels)[y * src->pitch / 4 + x] = pixel;
+                        ((Uint32 *) orig->pixels)[y * orig->pitch / 4 + x] = (Uint32) SDLTest_RandomUint32();
+                    }
+                }
+                SDL_SetSurfaceBlendMode(orig, SDL_BLENDMODE_NONE);
+                SDL_BlitSurface(orig, NULL, dst, NULL);
+
+                r = SDLTest_RandomUint8();
+                g = SDLTest_RandomUint8();
+                b = SDLTest_RandomUint8();
+                a = (k == 1) ? 255 : SDLTest_RandomUint8();
+                SDL_SetSurfaceBlendMode(src, (k == 0) ? SDL_BLENDMODE_NONE : SDL_BLENDMODE_BLEND);
+                SDL_SetSurfaceColorMod(src, r, g, b);
+                SDL_SetSurfaceAlphaMod(src, a);
+                ret = SDL_BlitSurface(src, NULL, dst, NULL);
+                SDLTest_AssertCheck(ret == 0, "Validate result from SDL_BlitSurface, expected: 0, got: %i", ret);
+
+                errors = 0;
+                for (y = 0; y < src->h; y++) {
+                    for (x = 0; x < src->w; x++) {
+                        Uint32 sr, sg, sb, sa, er, eg, eb, ea;
+                        Uint8 pr, pg, pb, pa, dr, dg, db, da;
+
+                        SDL_GetRGBA(((Uint32 *) src->pixels)[y * src->pitch / 4 + x], src->format, &pr, &pg, &pb, &pa);
+                        sr = pr * r / 255;
+                        sg = pg * g / 255;
+                        sb = pb * b / 255;
+                        sa = pa * a / 255;
+                        SDL_GetRGBA(((Uint32 *) orig->pixels)[y * orig->pitch / 4 + x], orig->format, &pr, &pg, &pb, &pa);
+                        if (k == 0) {
+                            er = sr;
+                            eg = sg;
+                            eb = sb;
+                            ea = sa;
+                        } else {
+                            if (sa < 255) {
+                                sr = sr * sa / 255;
+                                sg = sg * sa / 255;
+                                sb = sb * sa / 255;
+                            }
+                            er = sr + (255 - sa) * pr / 255;
+                            eg = sg + (255 - sa) * pg / 255;
+                            eb = sb + (255 - sa) * pb / 255;
+                            ea = sa + (255 - sa) * pa / 255;
+                        }
+
+                        SDL_GetRGBA(((Uint32 *) dst->pixels)[y * dst->pitch / 4 + x], dst->format, &dr, &dg, &db, &da);
+                        if (dr != er || dg != eg || db != eb || (dst->format->Amask && da != ea)) {
+                            errors++;
+                        }
+                    }
+                }
+                SDLTest_AssertCheck(errors == 0, "Validate %s pixels from %s to %s, expected: 0 errors, got: %i", kinds[k],
+                                    SDL_GetPixelFormatName(srcformats[i]), SDL_GetPixelFormatName(dstformats[j]), errors);
+            }
+
+            SDL_FreeSurface(src);
+            SDL_FreeSurface(dst);
+            SDL_FreeSurface(orig);
+        }
+    }
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests that large blits split into bands give the single threaded results.
+ */
+int
+surface_testThreadedBlit(void *arg)
+{
+    const char *kinds[] = { "conversion", "blend", "stretch", "linear stretch" };
+    SDL_Surface *src, *dst[2];
+    char *hint;
+    int ret, i, j, y, errors;
+
+    hint = SDL_GetHint(SDL_HINT_BLIT_THREADS) ? SDL_strdup(SDL_GetHint(SDL_HINT_BLIT_THREADS)) : NULL;
+
+    for (i = 0; i < SDL_arraysize(kinds); i++) {
+        /* Stretches double a quarter size source */
+        const int scale = (i >= 2) ? 2 : 1;
+        const Uint32 dst_format = (i == 0) ? SDL_PIXELFORMAT_RGB565 : SDL_PIXELFORMAT_ARGB8888;
+
+        src = SDL_CreateRGBSurfaceWithFormat(0, 640 / scale, 483 / scale, 32, SDL_PIXELFORMAT_ARGB8888);
+        dst[0] = SDL_CreateRGBSurfaceWithFormat(0, 640, 483, 32, dst_format);
+        dst[1] = SDL_CreateRGBSurfaceWithFormat(0, 640, 483, 32, dst_format);
+        SDLTest_AssertCheck(src != NULL && dst[0] != NULL && dst[1] != NULL, "Verify surfaces are not NULL");
+        if (src == NULL || dst[0] == NULL || dst[1] == NULL) {
+            SDL_FreeSurface(src);
+            SDL_FreeSurface(dst[0]);
+            SDL_FreeSurface(dst[1]);
+            break;
+        }
+        for (y = 0; y < src->h * src->pitch / 4; y++) {
+            ((Uint32 *) src->pixels)[y] = (Uint32) SDLTest_RandomUint32();
+        }
+        for (y = 0; y < dst[0]->h * dst[0]->pitch / 4; y++) {
+            ((Uint32 *) dst[0]->pixels)[y] = ((Uint32 *) dst[1]->pixels)[y] = (Uint32) SDLTest_RandomUint32();
+        }
+        SDL_SetSurfaceBlendMode(src, (i == 1) ? SDL_BLENDMODE_BLEND : SDL_BLENDMODE_NONE);
+
+        /* Once on the calling thread, once in bands */
+        for (j = 0; j < 2; j++) {
+            SDL_SetHint(SDL_HINT_BLIT_THREADS, j ? "4" : "1");
+            if (i == 2) {
+                ret = SDL_SoftStretch(src, NULL, dst[j], NULL);
+            } else if (i == 3) {
+                ret = SDL_SoftStretchLinear(src, NULL, dst[j], NULL);
+            } else {
+                ret = SDL_BlitSurface(src, NULL, dst[j], NULL);
+            }
+            SDLTest_AssertCheck(ret == 0, "Validate result from %s blit, expected: 0, got: %i", kinds[i], ret);
+        }
+
+        errors = 0;
+        for (y = 0; y < dst[0]->h; y++) {
+            if (SDL_memcmp((Uint8 *) dst[0]->pixels + y * dst[0]->pitch,
+                           (Uint8 *) dst[1]->pixels + y * dst[1]->pitch,
+                           dst[0]->w * dst[0]->format->BytesPerPixel) != 0) {
+                errors++;
+            }
+        }
+        SDLTest_AssertCheck(errors == 0, "Validate %s blit rows match the single threaded ones, expected: 0, got: %i", kinds[i], errors);
+
+        SDL_FreeSurface(src);
+        SDL_FreeSurface(dst[0]);
+        SDL_FreeSurface(dst[1]);
+    }
+
+    SDL_SetHint(SDL_HINT_BLIT_THREADS, hint);
+    SDL_free(hint);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests blitting one surface alternately into destinations of different formats.
+ */
+int
+surface_testAlternatingBlit(void *arg)
+{
+    const Uint32 formats[] = { SDL_PIXELFORMAT_RGB565, SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888 };
+    SDL_Surface *src, *ref, *dst[SDL_arraysize(formats)], *expected;
+    int ret, i, j, y, errors;
+
+    src = SDL_CreateRGBSurfaceWithFormat(0, 16, 16, 32, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(src != NULL, "Verify source surface is not NULL");
+    if (src == NULL) {
+        return TEST_ABORTED;
+    }
+    for (y = 0; y < 16 * src->pitch / 4; y++) {
+        ((Uint32 *) src->pixels)[y] = (Uint32) SDLTest_RandomUint32();
+    }
+    for (j = 0; j < SDL_arraysize(formats); j++) {
+        dst[j] = SDL_CreateRGBSurfaceWithFormat(0, 16, 16, 32, formats[j]);
+        SDLTest_AssertCheck(dst[j] != NULL, "Verify destination surface is not NULL");
+    }
+
+    /* Switch destinations every blit, and the blend mode halfway */
+    for (i = 0; i < 4 * SDL_arraysize(formats); i++) {
+        const SDL_BlendMode mode = (i < 2 * SDL_arraysize(formats)) ? SDL_BLENDMODE_NONE : SDL_BLENDMODE_BLEND;
+
+        j = i % SDL_arraysize(formats);
+        if (dst[j] == NULL) {
+            continue;
+        }
+        for (y = 0; y < 16 * dst[j]->pitch / 4; y++) {
+            ((Uint32 *) dst[j]->pixels)[y] = (Uint32) SDLTest_RandomUint32();
+        }
+
+        /* The same blit with surfaces that were never mapped before */
+        ref = SDL_CreateRGBSurfaceWithFormatFrom(src->pixels, 16, 16, 32, src->pitch, src->format->format);
+        expected = SDL_ConvertSurface(dst[j], dst[j]->format, 0);
+        SDLTest_AssertCheck(ref != NULL && expected != NULL, "Verify reference surfaces are not NULL");
+        if (ref == NULL || expected == NULL) {
+            SDL_FreeSurface(ref);
+            SDL_FreeSurface(expected);
+            break;
+        }
+        SDL_SetSurfaceBlendMode(ref, mode);
+        SDL_SetSurfaceBlendMode(expected, SDL_BLENDMODE_NONE);
+        SDL_BlitSurface(ref, NULL, expected, NULL);
+
+        SDL_SetSurfaceBlendMode(src, mode);
+        ret = SDL_BlitSurface(src, NULL, dst[j], NULL);
+        SDLTest_AssertCheck(ret == 0, "Validate result from SDL_BlitSurface, expected: 0, got: %i", ret);
+
+        errors = 0;
+        for (y = 0; y < 16; y++) {
+            if (SDL_memcmp((Uint8 *) dst[j]->pixels + y * dst[j]->pitch,
+                           (Uint8 *) expected->pixels + y * expected->pitch,
+                           16 * dst[j]->format->BytesPerPixel) != 0) {
+                errors++;
+            }
+        }
+        SDLTest_AssertCheck(errors == 0, "Validate blit %d into %s, expected: 0 wrong rows, got: %i", i, SDL_GetPixelFormatName(formats[j]), errors);
+
+        SDL_FreeSurface(ref);
+        SDL_FreeSurface(expected);
+    }
+
+    for (j = 0; j < SDL_arraysize(formats); j++) {
+        SDL_FreeSurface(dst[j]);
+    }
+    SDL_FreeSurface(src);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests a blended, color modulated blit between formats without a dedicated blitter.
+ */
+int
+surface_testGenericBlit(void *arg)
+{
+    SDL_Surface *src, *dst, *expected;
+    Uint8 sr, sg, sb, sa, dr, dg, db, da;
+    Uint8 mr, mg, mb;
+    int ret, x, y, errors;
+
+    /* Wider than the chunks the generic blitter works in */
+    src = SDL_CreateRGBSurfaceWithFormat(0, 300, 4, 16, SDL_PIXELFORMAT_ARGB4444);
+    dst = SDL_CreateRGBSurfaceWithFormat(0, 300, 4, 16, SDL_PIXELFORMAT_ABGR1555);
+    expected = SDL_CreateRGBSurfaceWithFormat(0, 300, 4, 16, SDL_PIXELFORMAT_ABGR1555);
+    SDLTest_AssertCheck(src != NULL && dst != NULL && expected != NULL, "Verify surfaces are not NULL");
+    if (src == NULL || dst == NULL || expected == NULL) {
+        SDL_FreeSurface(src);
+        SDL_FreeSurface(dst);
+        SDL_FreeSurface(expected);
+        return TEST_ABORTED;
+    }
+
+    mr = SDLTest_RandomUint8();
+    mg = SDLTest_RandomUint8();
+    mb = SDLTest_RandomUint8();
+    SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_BLEND);
+    SDL_SetSurfaceColorMod(src, mr, mg, mb);
+
+    for (y = 0; y < 4; y++) {
+        for (x = 0; x < 300; x++) {
+            Uint16 *s = (Uint16 *) ((Uint8 *) src->pixels + y * src->pitch) + x;
+            Uint16 *d = (Uint16 *) ((Uint8 *) dst->pixels + y * dst->pitch) + x;
+            Uint16 *e = (Uint16 *) ((Uint8 *) expected->pixels + y * expected->pitch) + x;
+
+            *s = (Uint16) SDLTest_RandomUint16();
+            *d = (Uint16) SDLTest_RandomUint16();
+
+            /* Modulate, premultiply and blend, as documented for SDL_BLENDMODE_BLEND */
+            SDL_GetRGBA(*s, src->format, &sr, &sg, &sb, &sa);
+            SDL_GetRGBA(*d, dst->format, &dr, &dg, &db, &da);
+            sr = sr * mr / 255;
+            sg = sg * mg / 255;
+            sb = sb * mb / 255;
+            if (sa < 255) {
+                sr = sr * sa / 255;
+                sg = sg * sa / 255;
+                sb = sb * sa / 255;
+            }
+            dr = sr + (255 - sa) * dr / 255;
+            dg = sg + (255 - sa) * dg / 255;
+            db = sb + (255 - sa) * db / 255;
+            da = sa + (255 - sa) * da / 255;
+            *e = (Uint16) SDL_MapRGBA(expected->format, dr, dg, db, da);
+        }
+    }
+
+    ret = SDL_BlitSurface(src, NULL, dst, NULL);
+    SDLTest_AssertCheck(ret == 0, "Validate result from SDL_BlitSurface, expected: 0, got: %i", ret);
+
+    errors = 0;
+    for (y = 0; y < 4; y++) {
+        if (SDL_memcmp((Uint8 *) dst->pixels + y * dst->pitch,
+                       (Uint8 *) expected->pixels + y * expected->pitch, 300 * 2) != 0) {
+            errors++;
+        }
+    }
+    SDLTest_AssertCheck(errors == 0, "Validate blended rows, expected: 0 wrong rows, got: %i", errors);
+
+    SDL_FreeSurface(src);
+    SDL_FreeSurface(dst);
+    SDL_FreeSurface(expected);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests modulated and scaled blits of an RLE accelerated, colorkeyed surface.
+ */
+int
+surface_testRLEModulatedBlit(void *arg)
+{
+    SDL_Surface *rle, *plain, *dst, *expected;
+    SDL_Rect srcrect, dstrect;
+    Uint32 key;
+    int ret, x, y, i, errors;
+
+    rle = SDL_CreateRGBSurfaceWithFormat(0, 61, 43, 32, SDL_PIXELFORMAT_ARGB8888);
+    dst = SDL_CreateRGBSurfaceWithFormat(0, 100, 80, 32, SDL_PIXELFORMAT_RGB565);
+    expected = SDL_CreateRGBSurfaceWithFormat(0, 100, 80, 32, SDL_PIXELFORMAT_RGB565);
+    SDLTest_AssertCheck(rle != NULL && dst != NULL && expected != NULL, "Verify surfaces are not NULL");
+    if (rle == NULL || dst == NULL || expected == NULL) {
+        SDL_FreeSurface(rle);
+        SDL_FreeSurface(dst);
+        SDL_FreeSurface(expected);
+        return TEST_ABORTED;
+    }
+
+    /* A mostly transparent sprite */
+    key = SDL_MapRGB(rle->format, 255, 0, 255);
+    for (y = 0; y < rle->h; y++) {
+        Uint32 *row = (Uint32 *) ((Uint8 *) rle->pixels + y * rle->pitch);
+        for (x = 0; x < rle->w; x++) {
+            row[x] = (SDLTest_RandomIntegerInRange(0, 9) < 7) ? key : SDLTest_RandomUint32();
+        }
+    }
+    plain = SDL_ConvertSurface(rle, rle->format, 0);
+    SDLTest_AssertCheck(plain != NULL, "Verify copied surface is not NULL");
+    if (plain == NULL) {
+        SDL_FreeSurface(rle);
+        SDL_FreeSurface(dst);
+        SDL_FreeSurface(expected);
+        return TEST_ABORTED;
+    }
+    SDL_SetSurfaceRLE(rle, 1);
+
+    for (i = 0; i < 4; i++) {
+        SDL_Surface *surface = (i % 2) ? rle : plain;
+        SDL_Surface *target = (i % 2) ? dst : expected;
+        SDL_SetColorKey(surface, SDL_TRUE, key);
+        SDL_SetSurfaceBlendMode(surface, SDL_BLENDMODE_BLEND);
+        SDL_SetSurfaceColorMod(surface, 200, 100, 50);
+        SDL_SetSurfaceAlphaMod(surface, 128 * (i / 2) + 64);
+        SDL_FillRect(target, NULL, SDL_MapRGB(target->format, 30, 60, 90));
+
+        /* Clipped by the destination */
+        dstrect.x = -5;
+        dstrect.y = 50;
+        ret = SDL_BlitSurface(surface, NULL, target, &dstrect);
+        SDLTest_AssertCheck(ret == 0, "Validate result from SDL_BlitSurface, expected: 0, got: %i", ret);
+
+        /* Scaled from part of the sprite */
+        srcrect.x = 3;
+        srcrect.y = 5;
+        srcrect.w = 50;
+        srcrect.h = 30;
+        dstrect.x = 20;
+        dstrect.y = -10;
+        dstrect.w = 77;
+        dstrect.h = 58;
+        ret = SDL_BlitScaled(surface, &srcrect, target, &dstrect);
+        SDLTest_AssertCheck(ret == 0, "Validate result from SDL_BlitScaled, expected: 0, got: %i", ret);
+
+        if (i % 2) {
+            SDLTest_AssertCheck((rle->flags & SDL_RLEACCEL) != 0, "Verify surface is still RLE accelerated");
+
+            errors = 0;
+            for (y = 0; y < dst->h; y++) {
+                if (SDL_memcmp((Uint8 *) dst->pixels + y * dst->pitch,
+                               (Uint8 *) expected->pixels + y * expected->pitch, dst->w * 2) != 0) {
+                    errors++;
+                }
+            }
+            SDLTest_AssertCheck(errors == 0, "Validate blitted rows, expected: 0 wrong rows, got: %i", errors);
+        }
+    }
+
+    /* Locking gives back the original pixels */
+    SDL_LockSurface(rle);
+    errors = 0;
+    for (y = 0; y < rle->h; y++) {
+        if (SDL_memcmp((Uint8 *) rle->pixels + y * rle->pitch,
+                       (Uint8 *) plain->pixels + y * plain->pitch, rle->w * 4) != 0) {
+            errors++;
+        }
+    }
+    SDL_UnlockSurface(rle);
+    SDLTest_AssertCheck(errors == 0, "Validate decoded rows, expected: 0 wrong rows, got: %i", errors);
+
+    SDL_FreeSurface(rle);
+    SDL_FreeSurface(plain);
+    SDL_FreeSurface(dst);
+    SDL_FreeSurface(expected);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests that RLE accelerated blits to more than 8 bits per channel fail like plain ones.
+ */
+int
+surface_testRLEWideBlit(void *arg)
+{
+    SDL_Surface *rle, *plain, *dst;
+    SDL_Rect dstrect;
+    Uint32 key;
+    int ret, expected = 0, i, x, y;
+
+    rle = SDL_CreateRGBSurfaceWithFormat(0, 31, 17, 32, SDL_PIXELFORMAT_ARGB8888);
+    plain = SDL_CreateRGBSurfaceWithFormat(0, 31, 17, 32, SDL_PIXELFORMAT_ARGB8888);
+    dst = SDL_CreateRGBSurfaceWithFormat(0, 64, 48, 32, SDL_PIXELFORMAT_ARGB2101010);
+    SDLTest_AssertCheck(rle != NULL && plain != NULL && dst != NULL, "Verify surfaces are not NULL");
+    if (rle == NULL || plain == NULL || dst == NULL) {
+        SDL_FreeSurface(rle);
+        SDL_FreeSurface(plain);
+        SDL_FreeSurface(dst);
+        return TEST_ABORTED;
+    }
+
+    key = SDL_MapRGB(rle->format, 255, 0, 255);
+    for (y = 0; y < rle->h; y++) {
+        for (x = 0; x < rle->w; x++) {
+            const Uint32 pixel = (x % 3) ? key : SDLTest_RandomUint32();
+            ((Uint32 *) ((Uint8 *) rle->pixels + y * rle->pitch))[x] = pixel;
+            ((Uint32 *) ((Uint8 *) plain->pixels + y * plain->pitch))[x] = pixel;
+        }
+    }
+    SDL_SetSurfaceRLE(rle, 1);
+
+    /* Scaled blending, then modulated colorkey blits */
+    for (i = 0; i < 2; i++) {
+        SDL_Surface *surface;
+        int k;
+
+        for (k = 0; k < 2; k++) {
+            surface = k ? rle : plain;
+            SDL_SetSurfaceBlendMode(surface, SDL_BLENDMODE_BLEND);
+            if (i == 1) {
+                SDL_SetColorKey(surface, SDL_TRUE, key);
+                SDL_SetSurfaceColorMod(surface, 200, 100, 50);
+                SDL_SetSurfaceAlphaMod(surface, 128);
+            }
+            dstrect.x = 3;
+            dstrect.y = 5;
+            dstrect.w = 50;
+            dstrect.h = 40;
+            if (i == 0) {
+                ret = SDL_BlitScaled(surface, NULL, dst, &dstrect);
+            } else {
+                ret = SDL_BlitSurface(surface, NULL, dst, &dstrect);
+            }
+            if (k == 0) {
+                expected = ret;
+            } else {
+                SDLTest_AssertCheck(ret == expected, "Validate %s blit result with RLE, expected: %i, got: %i",
+                                    i ? "modulated" : "scaled", expected, ret);
+            }
+        }
+    }
+
+    SDL_FreeSurface(rle);
+    SDL_FreeSurface(plain);
+    SDL_FreeSurface(dst);
+
+    return TEST_COMPLETED;
+}
+
+/* Helper to read a 16, 24 or 32-bit pixel */
+static Uint32
+_readPixel(const Uint8 *p, int bpp)
+{
+    switch (bpp) {
+    case 2:
+        return *(const Uint16 *) p;
+    case 3:
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+        return p[0] | (p[1] << 8) | (p[2] << 16);
+#else
+        return (p[0] << 16) | (p[1] << 8) | p[2];
+#endif
+    default:
+        return *(const Uint32 *) p;
+    }
+}
+
+/**
+ * @brief Tests SDL_ConvertPixels between common RGB formats against SDL_GetRGBA and SDL_MapRGBA, and in place.
+ */
+int
+surface_testConvertPixels(void *arg)
+{
+    static const Uint32 formats[][2] = {
+        { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888 },
+        { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGRX8888 },
+        { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB565 },
+        { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB24 },
+        { SDL_PIXELFORMAT_BGR24, SDL_PIXELFORMAT_ARGB8888 },
+        { SDL_PIXELFORMAT_ARGB4444, SDL_PIXELFORMAT_RGBA8888 },
+        { SDL_PIXELFORMAT_ARGB1555, SDL_PIXELFORMAT_ABGR8888 },
+        { SDL_PIXELFORMAT_BGR565, SDL_PIXELFORMAT_BGR24 }
+    };
+    static const Uint32 inplace[][2] = {
+        { SDL_PIXELFORMAT_RGB24, SDL_PIXELFORMAT_BGR24 },
+        { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888 },
+        { SDL_PIXELFORMAT_RGB565, SDL_PIXELFORMAT_BGR565 }
+    };
+    /* An odd width and padded rows, the padding must be left alone */
+    const int w = 37, h = 5, padding = 8;
+    Uint8 src[(4 * 37 + 8) * 5], dst[(4 * 37 + 8) * 5];
+    SDL_PixelFormat *src_format, *dst_format;
+    Uint8 r, g, b, a;
+    int i, x, y, ret, errors;
+
+    for (i = 0; i < SDL_arraysize(formats); i++) {
+        const int src_bpp = SDL_BYTESPERPIXEL(formats[i][0]);
+        const int dst_bpp = SDL_BYTESPERPIXEL(formats[i][1]);
+        const int src_pitch = w * src_bpp + padding;
+        const int dst_pitch = w * dst_bpp + padding;
+
+        src_format = SDL_AllocFormat(formats[i][0]);
+        dst_format = SDL_AllocFormat(formats[i][1]);
+        SDLTest_AssertCheck(src_format != NULL && dst_format != NULL, "Verify formats are not NULL");
+        if (src_format == NULL || dst_format == NULL) {
+            SDL_FreeFormat(src_format);
+            SDL_FreeFormat(dst_format);
+            return TEST_ABORTED;
+        }
+
+        for (x = 0; x < src_pitch * h; x++) {
+            src[x] = SDLTest_RandomUint8();
+        }
+        SDL_memset(dst, 0xAB, dst_pitch * h);
+
+        ret = SDL_ConvertPixels(w, h, formats[i][0], src, src_pitch, formats[i][1], dst, dst_pitch);
+        SDLTest_AssertCheck(ret == 0, "Validate result from SDL_ConvertPixels, expected: 0, got: %i", ret);
+
+        errors = 0;
+        for (y = 0; y < h; y++) {
+            for (x = 0; x < w; x++) {
+                const Uint32 mask = dst_format->Rmask | dst_format->Gmask | dst_format->Bmask | dst_format->Amask;
+                Uint32 expected, actual;
+
+                /* Nothing is promised for unused bits */
+                SDL_GetRGBA(_readPixel(src + y * src_pitch + x * src_bpp, src_bpp), src_format, &r, &g, &b, &a);
+                expected = SDL_MapRGBA(dst_format, r, g, b, a) & mask;
+                actual = _readPixel(dst + y * dst_pitch + x * dst_bpp, dst_bpp) & mask;
+                if (actual != expected) {
+                    errors++;
+                }
+            }
+            for (x = w * dst_bpp; x < dst_pitch; x++) {
+                if (dst[y * dst_pitch + x] != 0xAB) {
+                    errors++;
+                }
+            }
+        }
+        SDLTest_AssertCheck(errors == 0, "Validate %s to %s conversion, expected: 0 errors, got: %i",
+                            SDL_GetPixelFormatName(formats[i][0]), SDL_GetPixelFormatName(formats[i][1]), errors);
+
+        SDL_FreeFormat(src_format);
+        SDL_FreeFormat(dst_format);
+    }
+
+    /* In place, between formats of the same size */
+    for (i = 0; i < SDL_arraysize(inplace); i++) {
+        const int pitch = w * SDL_BYTESPERPIXEL(inplace[i][0]) + padding;
+
+        for (x = 0; x < pitch * h; x++) {
+            src[x] = SDLTest_RandomUint8();
+        }
+        ret = SDL_ConvertPixels(w, h, inplace[i][0], src, pitch, inplace[i][1], dst, pitch);
+        SDLTest_AssertCheck(ret == 0, "Validate result from SDL_ConvertPixels, expected: 0, got: %i", ret);
+        ret = SDL_ConvertPixels(w, h, inplace[i][0], src, pitch, inplace[i][1], src, pitch);
+        SDLTest_AssertCheck(ret == 0, "Validate result from SDL_ConvertPixels in place, expected: 0, got: %i", ret);
+
+        errors = 0;
+        for (y = 0; y < h; y++) {
+            if (SDL_memcmp(src + y * pitch, dst + y * pitch, pitch - padding) != 0) {
+                errors++;
+            }
+        }
+        SDLTest_AssertCheck(errors == 0, "Validate %s to %s conversion in place, expected: 0 wrong rows, got: %i",
+                            SDL_GetPixelFormatName(inplace[i][0]), SDL_GetPixelFormatName(inplace[i][1]), errors);
+    }
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests SDL_FillRects with overlapping, unsorted and clipped rectangles against SDL_FillRect.
+ */
+int
+surface_testFillRects(void *arg)
+{
+    static const Uint32 formats[] = {
+        SDL_PIXELFORMAT_INDEX8, SDL_PIXELFORMAT_RGB565, SDL_PIXELFORMAT_RGB24, SDL_PIXELFORMAT_ARGB8888
+    };
+    SDL_Rect rects[100], clip;
+    SDL_Surface *surface, *expected;
+    int i, f, y, ret, errors;
+
+    for (f = 0; f < SDL_arraysize(formats); f++) {
+        /* More rectangles than fit on the stack, some wide and some off the surface */
+        for (i = 0; i < SDL_arraysize(rects); i++) {
+            const SDL_bool wide = (i % 5 == 0);
+            rects[i].x = SDLTest_RandomIntegerInRange(-20, 300);
+            rects[i].y = SDLTest_RandomIntegerInRange(-20, 100);
+            rects[i].w = wide ? SDLTest_RandomIntegerInRange(0, 300) : SDLTest_RandomIntegerInRange(0, 20);
+            rects[i].h = wide ? SDLTest_RandomIntegerInRange(0, 60) : SDLTest_RandomIntegerInRange(0, 20);
+        }
+
+        surface = SDL_CreateRGBSurfaceWithFormat(0, 290, 90, 0, formats[f]);
+        expected = SDL_CreateRGBSurfaceWithFormat(0, 290, 90, 0, formats[f]);
+        SDLTest_AssertCheck(surface != NULL && expected != NULL, "Verify surfaces are not NULL");
+        if (surface == NULL || expected == NULL) {
+            SDL_FreeSurface(surface);
+            SDL_FreeSurface(expected);
+            return TEST_ABORTED;
+        }
+        clip.x = 3;
+        clip.y = 2;
+        clip.w = 280;
+        clip.h = 85;
+        SDL_SetClipRect(surface, &clip);
+        SDL_SetClipRect(expected, &clip);
+
+        for (i = 0; i < SDL_arraysize(rects); i++) {
+            SDL_FillRect(expected, &rects[i], 0x5A);
+        }
+        ret = SDL_FillRects(surface, rects, SDL_arraysize(rects), 0x5A);
+        SDLTest_AssertCheck(ret == 0, "Validate result from SDL_FillRects, expected: 0, got: %i", ret);
+
+        errors = 0;
+        for (y = 0; y < surface->h; y++) {
+            if (SDL_memcmp((Uint8 *) surface->pixels + y * surface->pitch,
+                           (Uint8 *) expected->pixels + y * expected->pitch,
+                           surface->w * surface->format->BytesPerPixel) != 0) {
+                errors++;
+            }
+        }
+        SDLTest_AssertCheck(errors == 0, "Validate %s fill, expected: 0 rows differing, got: %i",
+                            SDL_GetPixelFormatName(formats[f]), errors);
+
+        SDL_FreeSurface(surface);
+        SDL_FreeSurface(expected);
+    }
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests SDL_ConvertPixels from every YUV format and the YUV conversion modes.
+ */
+int
+surface_testConvertYUV(void *arg)
+{
+    static const Uint32 formats[] = {
+        SDL_PIXELFORMAT_YV12, SDL_PIXELFORMAT_IYUV, SDL_PIXELFORMAT_NV12, SDL_PIXELFORMAT_NV21,
+        SDL_PIXELFORMAT_YUY2, SDL_PIXELFORMAT_UYVY, SDL_PIXELFORMAT_YVYU
+    };
+    /* Wider than the vectorized loops with an odd width, in padded rows */
+    const int w = 37, h = 5, pitch = 40, cw = (37 + 1) / 2, cpitch = (40 + 1) / 2;
+    Uint8 Y[5][37], U[3][19], V[3][19];
+    Uint8 src[2 * 40 * 5], chroma[5][4 * 19];
+    Uint32 expected[37 * 5], actual[37 * 5], swizzled[37 * 5];
+    SDL_YUV_CONVERSION_MODE mode;
+    int i, x, y, ret;
+
+    SDL_SetYUVConversionMode(SDL_YUV_CONVERSION_AUTOMATIC);
+    mode = SDL_GetYUVConversionMode();
+    SDLTest_AssertCheck(mode == SDL_YUV_CONVERSION_AUTOMATIC, "Validate SDL_GetYUVConversionMode, got: %i", mode);
+    mode = SDL_GetYUVConversionModeForResolution(640, 480);
+    SDLTest_AssertCheck(mode == SDL_YUV_CONVERSION_BT601, "Validate standard definition mode, expected: BT601, got: %i", mode);
+    mode = SDL_GetYUVConversionModeForResolution(1920, 1080);
+    SDLTest_AssertCheck(mode == SDL_YUV_CONVERSION_BT709, "Validate high definition mode, expected: BT709, got: %i", mode);
+
+    /* Grey levels: full range in JPEG mode, 16-235 in the video modes */
+    for (y = 0; y < h; y++) {
+        for (x = 0; x < w; x++) {
+            Y[y][x] = (Uint8) (x * 7 + y);
+        }
+    }
+    SDL_memset(U, 128, sizeof(U));
+    SDL_memset(V, 128, sizeof(V));
+    for (i = 0; i < 2; i++) {
+        const SDL_YUV_CONVERSION_MODE grey_mode = i ? SDL_YUV_CONVERSION_BT601 : SDL_YUV_CONVERSION_JPEG;
+        int errors = 0;
+
+        SDL_SetYUVConversionMode(grey_mode);
+        SDL_memset(src, 128, sizeof(src));
+        for (y = 0; y < h; y++) {
+            SDL_memcpy(&src[y * w], Y[y], w);
+        }
+        ret = SDL_ConvertPixels(w, h, SDL_PIXELFORMAT_IYUV, src, w, SDL_PIXELFORMAT_ARGB8888, actual, w * 4);
+        SDLTest_AssertCheck(ret == 0, "Validate result from SDL_ConvertPixels, expected: 0, got: %i", ret);
+        for (y = 0; y < h; y++) {
+            for (x = 0; x < w; x++) {
+                int level = Y[y][x];
+                if (grey_mode == SDL_YUV_CONVERSION_BT601) {
+                    level = ((level - 16) * 255 + 219 / 2) / 219;
+                    level = SDL_max(0, SDL_min(level, 255));
+                }
+                if (actual[y * w + x] != (0xFF000000 | (level << 16) | (level << 8) | level)) {
+                    errors++;
+                }
+            }
+        }
+        SDLTest_AssertCheck(errors == 0, "Validate grey levels in mode %i, expected: 0 errors, got: %i", grey_mode, errors);
+    }
+
+    /* Random colors must convert to the same pixels from every layout */
+    for (y = 0; y < h; y++) {
+        for (x = 0; x < w; x++) {
+            Y[y][x] = SDLTest_RandomUint8();
+        }
+    }
+    for (y = 0; y < (h + 1) / 2; y++) {
+        for (x = 0; x < cw; x++) {
+            U[y][x] = SDLTest_RandomUint8();
+            V[y][x] = SDLTest_RandomUint8();
+        }
+    }
+    for (y = 0; y < h; y++) {
+        for (x = 0; x < cw; x++) {
+            chroma[y][4 * x + 0] = Y[y][2 * x];
+            chroma[y][4 * x + 1] = U[y / 2][x];
+            chroma[y][4 * x + 2] = (2 * x + 1 < w) ? Y[y][2 * x + 1] : 0;
+            chroma[y][4 * x + 3] = V[y / 2][x];
+        }
+    }
+    for (mode = SDL_YUV_CONVERSION_JPEG; mode <= SDL_YUV_CONVERSION_BT709; mode++) {
+        SDL_SetYUVConversionMode(mode);
+        for (i = 0; i < SDL_arraysize(formats); i++) {
+            const Uint32 format = formats[i];
+            Uint8 *planes = &src[pitch * h];
+            int src_pitch = pitch;
+            int errors = 0;
+
+            SDL_memset(src, 0, sizeof(src));
+            switch (format) {
+            case SDL_PIXELFORMAT_YUY2:
+            case SDL_PIXELFORMAT_UYVY:
+            case SDL_PIXELFORMAT_YVYU:
+                src_pitch = 4 * cw + 4;
+                for (y = 0; y < h; y++) {
+                    for (x = 0; x < 4 * cw; x += 4) {
+                        const Uint8 *in = &chroma[y][x];
+                        Uint8 *out = &src[y * src_pitch + x];
+                        if (format == SDL_PIXELFORMAT_YUY2) {
+                            out[0] = in[0]; out[1] = in[1]; out[2] = in[2]; out[3] = in[3];
+                        } else if (format == SDL_PIXELFORMAT_UYVY) {
+                            out[0] = in[1]; out[1] = in[0]; out[2] = in[3]; out[3] = in[2];
+                        } else {
+                            out[0] = in[0]; out[1] = in[3]; out[2] = in[2]; out[3] = in[1];
+                        }
+                    }
+                }
+                break;
+            default:
+                for (y = 0; y < h; y++) {
+                    SDL_memcpy(&src[y * pitch], Y[y], w);
+                }
+                for (y = 0; y < (h + 1) / 2; y++) {
+                    for (x = 0; x < cw; x++) {
+                        if (format == SDL_PIXELFORMAT_YV12 || format == SDL_PIXELFORMAT_IYUV) {
+                            Uint8 *first = &planes[y * cpitch + x];
+                            Uint8 *second = &planes[cpitch * ((h + 1) / 2) + y * cpitch + x];
+                            *first = (format == SDL_PIXELFORMAT_IYUV) ? U[y][x] : V[y][x];
+                            *second = (format == SDL_PIXELFORMAT_IYUV) ? V[y][x] : U[y][x];
+                        } else {
+                            Uint8 *uv = &planes[y * 2 * cpitch + 2 * x];
+                            uv[0] = (format == SDL_PIXELFORMAT_NV12) ? U[y][x] : V[y][x];
+                            uv[1] = (format == SDL_PIXELFORMAT_NV12) ? V[y][x] : U[y][x];
+                        }
+                    }
+                }
+                break;
+            }
+
+            ret = SDL_ConvertPixels(w, h, format, src, src_pitch, SDL_PIXELFORMAT_ARGB8888, actual, w * 4);
+            SDLTest_AssertCheck(ret == 0, "Validate result from SDL_ConvertPixels, expected: 0, got: %i", ret);
+            if (i == 0) {
+                SDL_memcpy(expected, actual, sizeof(expected));
+            }
+            ret = SDL_ConvertPixels(w, h, format, src, src_pitch, SDL_PIXELFORMAT_ABGR8888, swizzled, w * 4);
+            SDLTest_AssertCheck(ret == 0, "Validate result from SDL_ConvertPixels, expected: 0, got: %i", ret);
+            for (x = 0; x < w * h; x++) {
+                const Uint32 abgr = (expected[x] & 0xFF00FF00) | ((expected[x] >> 16) & 0xFF) | ((expected[x] & 0xFF) << 16);
+                if (actual[x] != expected[x] || swizzled[x] != abgr) {
+                    errors++;
+                }
+            }
+            SDLTest_AssertCheck(errors == 0, "Validate %s conversion in mode %i, expected: 0 errors, got: %i",
+                                SDL_GetPixelFormatName(format), mode, errors);
+        }
+    }
+
+    SDL_SetYUVConversionMode(SDL_YUV_CONVERSION_JPEG);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests SDL_ConvertPixels to every YUV format from 32-bit RGB formats.
+ */
+int
+surface_testConvertToYUV(void *arg)
+{
+    static const Uint32 formats[] = {
+        SDL_PIXELFORMAT_YV12, SDL_PIXELFORMAT_IYUV, SDL_PIXELFORMAT_NV12, SDL_PIXELFORMAT_NV21,
+        SDL_PIXELFORMAT_YUY2, SDL_PIXELFORMAT_UYVY, SDL_PIXELFORMAT_YVYU
+    };
+    /* Wider than the vectorized loops with an odd size, in padded rows */
+    const int w = 37, h = 5, pitch = 40;
+    Uint32 argb[37 * 5], abgr[37 * 5], result[37 * 5];
+    Uint8 yuv[2 * 40 * 5], grey[2 * 40 * 5];
+    SDL_YUV_CONVERSION_MODE mode;
+    int i, x, y, ret;
+
+    /* Colors that are the same in each 2x2 block, so they survive subsampling */
+    for (y = 0; y < h; y++) {
+        for (x = 0; x < w; x++) {
+            if (x % 2 == 0 && y % 2 == 0) {
+                argb[y * w + x] = 0xFF000000 | (SDLTest_RandomUint32() & 0x00FFFFFF);
+            } else {
+                argb[y * w + x] = argb[(y & ~1) * w + (x & ~1)];
+            }
+            abgr[y * w + x] = (argb[y * w + x] & 0xFF00FF00) |
+                              ((argb[y * w + x] >> 16) & 0xFF) | ((argb[y * w + x] & 0xFF) << 16);
+        }
+    }
+
+    for (mode = SDL_YUV_CONVERSION_JPEG; mode <= SDL_YUV_CONVERSION_BT709; mode++) {
+        SDL_SetYUVConversionMode(mode);
+        for (i = 0; i < SDL_arraysize(formats); i++) {
+            const Uint32 format = formats[i];
+            const int yuv_pitch = (format == SDL_PIXELFORMAT_YUY2 || format == SDL_PIXELFORMAT_UYVY ||
+                                   format == SDL_PIXELFORMAT_YVYU) ? 4 * ((w + 1) / 2) + 4 : pitch;
+            int errors = 0;
+
+            /* Any byte order gives the same result */
+            ret = SDL_ConvertPixels(w, h, SDL_PIXELFORMAT_ARGB8888, argb, w * 4, format, yuv, yuv_pitch);
+            SDLTest_AssertCheck(ret == 0, "Validate result from SDL_ConvertPixels, expected: 0, got: %i", ret);
+            ret = SDL_ConvertPixels(w, h, SDL_PIXELFORMAT_ABGR8888, abgr, w * 4, format, grey, yuv_pitch);
+            SDLTest_AssertCheck(ret == 0, "Validate result from SDL_ConvertPixels, expected: 0, got: %i", ret);
+            if (SDL_memcmp(yuv, grey, sizeof(yuv)) != 0) {
+                errors++;
+            }
+
+            /* Converting back is within rounding of the original */
+            ret = SDL_ConvertPixels(w, h, format, yuv, yuv_pitch, SDL_PIXELFORMAT_ARGB8888, result, w * 4);
+            SDLTest_AssertCheck(ret == 0, "Validate result from SDL_ConvertPixels, expected: 0, got: %i", ret);
+            for (x = 0; x < w * h; x++) {
+                int shift;
+                for (shift = 0; shift < 24; shift += 8) {
+                    const int delta = (int) ((argb[x] >> shift) & 0xFF) - (int) ((result[x] >> shift) & 0xFF);
+                    if (delta < -3 || delta > 3) {
+                        errors++;
+                    }
+                }
+            }
+            SDLTest_AssertCheck(errors == 0, "Validate conversion to %s in mode %i, expected: 0 errors, got: %i",
+                                SDL_GetPixelFormatName(format), mode, errors);
+        }
+    }
+
+    /* Greys have neutral chroma, and full range luma in JPEG mode */
+    SDL_SetYUVConversionMode(SDL_YUV_CONVERSION_JPEG);
+    for (x = 0; x < w * h; x++) {
+        const Uint32 level = (Uint32) ((x * 7) & 0xFF);
+        argb[x] = 0xFF000000 | (level << 16) | (level << 8) | level;
+    }
+    ret = SDL_ConvertPixels(w, h, SDL_PIXELFORMAT_ARGB8888, argb, w * 4, SDL_PIXELFORMAT_YUY2, yuv, 4 * ((w + 1) / 2));
+    SDLTest_AssertCheck(ret == 0, "Validate result from SDL_ConvertPixels, expected: 0, got: %i", ret);
+    for (i = 0, y = 0; y < h; y++) {
+        for (x = 0; x < w; x++) {
+            const Uint8 *pair = &yuv[y * 4 * ((w + 1) / 2) + (x / 2) * 4];
+            if (pair[(x & 1) * 2] != ((x + y * w) * 7 & 0xFF) || pair[1] != 128 || pair[3] != 128) {
+                i++;
+            }
+        }
+    }
+    SDLTest_AssertCheck(i == 0, "Validate grey levels, expected: 0 errors, got: %i", i);
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Surface test cases */
@@ -635,11 +1818,52 @@ static const SDLTest_TestCaseReference surfaceTest11 =
 static const SDLTest_TestCaseReference surfaceTest12 =
         { (SDLTest_TestCaseFp)surface_testBlitBlendMod, "surface_testBlitBlendMod", "Tests blitting routines with mod blending mode.", TEST_ENABLED};
 
+static const SDLTest_TestCaseReference surfaceTest13 =
+        { (SDLTest_TestCaseFp)surface_testSoftStretchLinear, "surface_testSoftStretchLinear", "Tests bilinear filtered stretching.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest14 =
+        { (SDLTest_TestCaseFp)surface_testModulatedBlit, "surface_testModulatedBlit", "Tests color and alpha modulated blits without blending.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest15 =
+        { (SDLTest_TestCaseFp)surface_testAlphaBlendedBlit, "surface_testAlphaBlendedBlit", "Tests pixel and surface alpha blending of 8888 surfaces.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest16 =
+        { (SDLTest_TestCaseFp)surface_testThreadedBlit, "surface_testThreadedBlit", "Tests large blits split into bands across threads.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest17 =
+        { (SDLTest_TestCaseFp)surface_testAlternatingBlit, "surface_testAlternatingBlit", "Tests blitting one surface into destinations of alternating formats.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest18 =
+        { (SDLTest_TestCaseFp)surface_testGenericBlit, "surface_testGenericBlit", "Tests a blended blit between formats without a dedicated blitter.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest19 =
+        { (SDLTest_TestCaseFp)surface_testRLEModulatedBlit, "surface_testRLEModulatedBlit", "Tests modulated and scaled blits of an RLE accelerated surface.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest20 =
+        { (SDLTest_TestCaseFp)surface_testConvertPixels, "surface_testConvertPixels", "Tests SDL_ConvertPixels between common RGB formats.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest21 =
+        { (SDLTest_TestCaseFp)surface_testFillRects, "surface_testFillRects", "Tests filling many overlapping and clipped rectangles at once.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest22 =
+        { (SDLTest_TestCaseFp)surface_testConvertYUV, "surface_testConvertYUV", "Tests SDL_ConvertPixels from YUV formats in each conversion mode.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest23 =
+        { (SDLTest_TestCaseFp)surface_testConvertToYUV, "surface_testConvertToYUV", "Tests SDL_ConvertPixels to YUV formats from RGB formats.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest24 =
+        { (SDLTest_TestCaseFp)surface_testGeneratedBlit, "surface_testGeneratedBlit", "Tests modulated and blended blits between 8888 formats against the per pixel math.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest25 =
+        { (SDLTest_TestCaseFp)surface_testRLEWideBlit, "surface_testRLEWideBlit", "Tests RLE accelerated blits to a 10-bit per channel surface.", TEST_ENABLED};
+
 /* Sequence of Surface test cases */
 static const SDLTest_TestCaseReference *surfaceTests[] =  {
     &surfaceTest1, &surfaceTest2, &surfaceTest3, &surfaceTest4, &surfaceTest5,
     &surfaceTest6, &surfaceTest7, &surfaceTest8, &surfaceTest9, &surfaceTest10,
-    &surfaceTest11, &surfaceTest12, NULL
+    &surfaceTest11, &surfaceTest12, &surfaceTest13, &surfaceTest14, &surfaceTest15,
+    &surfaceTest16, &surfaceTest17, &surfaceTest18, &surfaceTest19, &surfaceTest20,
+    &surfaceTest21, &surfaceTest22, &surfaceTest23, &surfaceTest24, &surfaceTest25, NULL
 };
 
 /* Surface test suite (global) */